@@ -0,0 +1,189 @@
+// ======================================================================
+// \title  ArenaAllocator.cpp
+// \author ortega
+// \brief  cpp file for the arena memory allocator of the setup-time allocations
+// ======================================================================
+
+#include "Components/ArenaAllocator/ArenaAllocator.hpp"
+#include "Fw/Logger/Logger.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <sys/mman.h>
+#include <cerrno>
+#include <cstring>
+
+namespace Components {
+
+namespace {
+//! Size of the huge pages the region is rounded to (x86-64 and aarch64 default)
+const U64 HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+//! Round a size up to a multiple of a power of two
+U64 roundUp(U64 size, U64 multiple) {
+    return (size + multiple - 1) & ~(multiple - 1);
+}
+}  // namespace
+
+ArenaAllocator ::ArenaAllocator() {
+    (void)memset(this->m_usage, 0, sizeof(this->m_usage));
+    (void)memset(&this->m_otherUsage, 0, sizeof(this->m_otherUsage));
+}
+
+ArenaAllocator ::~ArenaAllocator() {
+    if (this->m_region != nullptr) {
+        (void)munmap(this->m_region, static_cast<size_t>(this->m_mappedSize));
+    }
+}
+
+bool ArenaAllocator ::setup(U64 size, bool hugePages) {
+    FW_ASSERT(size > 0);
+    FW_ASSERT(this->m_region == nullptr);
+    const U64 capacity = roundUp(size, ALIGNMENT);
+
+    // The region is prefaulted so its pages are resident from startup instead of being faulted in by the first use
+    void* memory = MAP_FAILED;
+    if (hugePages) {
+        const U64 mappedSize = roundUp(capacity, HUGE_PAGE_SIZE);
+        memory = mmap(nullptr, static_cast<size_t>(mappedSize), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED) {
+            this->m_mappedSize = mappedSize;
+        } else {
+            Fw::Logger::log("[WARNING] Memory arena: no huge pages for %llu bytes (error %d), using normal pages\n",
+                            static_cast<unsigned long long>(mappedSize), errno);
+        }
+    }
+    if (memory == MAP_FAILED) {
+        memory = mmap(nullptr, static_cast<size_t>(capacity), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (memory == MAP_FAILED) {
+            Fw::Logger::log("[ERROR] Memory arena: failed to map %llu bytes (error %d)\n",
+                            static_cast<unsigned long long>(capacity), errno);
+            return false;
+        }
+        this->m_mappedSize = capacity;
+        hugePages = false;
+    }
+    this->m_region = static_cast<U8*>(memory);
+    this->m_capacity = capacity;
+    this->m_hugePages = hugePages;
+    return true;
+}
+
+void ArenaAllocator ::release() {
+    Os::ScopeLock lock(this->m_lock);
+    FW_ASSERT(this->m_live == 0, static_cast<FwAssertArgType>(this->m_live));
+    if (this->m_region != nullptr) {
+        (void)munmap(this->m_region, static_cast<size_t>(this->m_mappedSize));
+    }
+    this->m_region = nullptr;
+    this->m_capacity = 0;
+    this->m_mappedSize = 0;
+    this->m_offset = 0;
+    this->m_hugePages = false;
+}
+
+void* ArenaAllocator ::allocate(const NATIVE_UINT_TYPE identifier, NATIVE_UINT_TYPE& size, bool& recoverable) {
+    Os::ScopeLock lock(this->m_lock);
+    recoverable = false;
+    FW_ASSERT(this->m_region != nullptr, static_cast<FwAssertArgType>(identifier));
+
+    const U64 bytes = roundUp(size, ALIGNMENT);
+    if (bytes > this->m_capacity - this->m_offset) {
+        // The region is sized for the topology: running out is a configuration error to fix before flight
+        Fw::Logger::log("[FATAL] Memory arena exhausted: identifier %u requested %u bytes with %llu of %llu free\n",
+                        identifier, size, static_cast<unsigned long long>(this->m_capacity - this->m_offset),
+                        static_cast<unsigned long long>(this->m_capacity));
+        this->logUsage();
+        FW_ASSERT(0, static_cast<FwAssertArgType>(identifier), static_cast<FwAssertArgType>(size),
+                  static_cast<FwAssertArgType>(this->m_capacity - this->m_offset));
+    }
+    void* const memory = &this->m_region[this->m_offset];
+    this->m_offset += bytes;
+    this->m_peak = FW_MAX(this->m_peak, this->m_offset);
+    this->m_live++;
+
+    Usage* usage = this->findUsage(identifier);
+    usage->bytes += bytes;
+    usage->allocations++;
+    return memory;
+}
+
+void ArenaAllocator ::deallocate(const NATIVE_UINT_TYPE identifier, void* ptr) {
+    Os::ScopeLock lock(this->m_lock);
+    FW_ASSERT(ptr != nullptr, static_cast<FwAssertArgType>(identifier));
+    FW_ASSERT((static_cast<U8*>(ptr) >= this->m_region) && (static_cast<U8*>(ptr) < &this->m_region[this->m_offset]),
+              static_cast<FwAssertArgType>(identifier));
+    FW_ASSERT(this->m_live > 0, static_cast<FwAssertArgType>(identifier));
+    this->m_live--;
+    // Allocations are not freed one by one: the whole region is reused once all of them are back
+    if (this->m_live == 0) {
+        this->m_offset = 0;
+    }
+}
+
+U64 ArenaAllocator ::getCapacity() const {
+    return this->m_capacity;
+}
+
+U64 ArenaAllocator ::getUsed() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_offset;
+}
+
+U64 ArenaAllocator ::getPeak() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_peak;
+}
+
+bool ArenaAllocator ::isHugePages() const {
+    return this->m_hugePages;
+}
+
+U32 ArenaAllocator ::getIdentifierCount() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_identifiers;
+}
+
+ArenaAllocator::Usage ArenaAllocator ::getUsage(U32 index) const {
+    Os::ScopeLock lock(this->m_lock);
+    FW_ASSERT(index < this->m_identifiers, static_cast<FwAssertArgType>(index));
+    return this->m_usage[index];
+}
+
+void ArenaAllocator ::report() const {
+    Os::ScopeLock lock(this->m_lock);
+    this->logUsage();
+}
+
+ArenaAllocator::Usage* ArenaAllocator ::findUsage(NATIVE_UINT_TYPE identifier) {
+    for (U32 index = 0; index < this->m_identifiers; index++) {
+        if (this->m_usage[index].identifier == identifier) {
+            return &this->m_usage[index];
+        }
+    }
+    if (this->m_identifiers < MAX_IDENTIFIERS) {
+        Usage* usage = &this->m_usage[this->m_identifiers++];
+        usage->identifier = identifier;
+        return usage;
+    }
+    return &this->m_otherUsage;
+}
+
+void ArenaAllocator ::logUsage() const {
+    Fw::Logger::log("[INFO] Memory arena: %llu of %llu bytes used, peak %llu, %s pages\n",
+                    static_cast<unsigned long long>(this->m_offset), static_cast<unsigned long long>(this->m_capacity),
+                    static_cast<unsigned long long>(this->m_peak), this->m_hugePages ? "huge" : "normal");
+    for (U32 index = 0; index < this->m_identifiers; index++) {
+        Fw::Logger::log("[INFO] Memory arena: identifier %u: %llu bytes in %u allocations\n",
+                        this->m_usage[index].identifier,
+                        static_cast<unsigned long long>(this->m_usage[index].bytes),
+                        this->m_usage[index].allocations);
+    }
+    if (this->m_otherUsage.allocations > 0) {
+        Fw::Logger::log("[INFO] Memory arena: other identifiers: %llu bytes in %u allocations\n",
+                        static_cast<unsigned long long>(this->m_otherUsage.bytes), this->m_otherUsage.allocations);
+    }
+}
+
+}  // namespace Components
@@ -0,0 +1,108 @@
+// ======================================================================
+// \title  ArenaAllocator.hpp
+// \author ortega
+// \brief  hpp file for the arena memory allocator of the setup-time allocations
+// ======================================================================
+
+#ifndef Components_ArenaAllocator_HPP
+#define Components_ArenaAllocator_HPP
+
+#include "FpConfig.hpp"
+#include "Fw/Types/MemAllocator.hpp"
+#include "Os/Mutex.hpp"
+
+namespace Components {
+
+//! Bump allocator handing out the setup-time allocations of the topology from one region reserved up front
+//!
+//! The region is mapped once, optionally on huge pages, and prefaulted, so the memory footprint of the deployment is
+//! fixed at startup and the buffer pools are contiguous. Allocations are carved in order, aligned to a cache line, and
+//! accounted per identifier. Memory is only returned when every allocation has been deallocated. Exceeding the region
+//! is a configuration error: the allocator logs the identifier and sizes involved, then asserts.
+class ArenaAllocator : public Fw::MemAllocator {
+  public:
+    //! Alignment of every allocation
+    static const U32 ALIGNMENT = 64;
+
+    //! Number of identifiers accounted separately, the others are accounted together
+    static const U32 MAX_IDENTIFIERS = 16;
+
+    //! Memory handed out for one identifier
+    struct Usage {
+        NATIVE_UINT_TYPE identifier;  //!< Allocation identifier
+        U64 bytes;                    //!< Bytes allocated, including alignment padding
+        U32 allocations;              //!< Number of allocations
+    };
+
+    //! Construct an allocator without a region, see setup
+    ArenaAllocator();
+
+    //! Release the region
+    ~ArenaAllocator();
+
+    //! Reserve and prefault the region
+    //!
+    //! \return true when the region is reserved. Huge pages that cannot be reserved fall back to normal pages.
+    bool setup(U64 size,       //!< Size of the region in bytes
+               bool hugePages  //!< Back the region with huge pages, rounding the size up to a whole huge page
+    );
+
+    //! Unmap the region. All allocations must have been returned.
+    void release();
+
+    //! Carve an allocation from the region, asserting when it does not fit
+    void* allocate(const NATIVE_UINT_TYPE identifier,  //!< Identifier of the allocation
+                   NATIVE_UINT_TYPE& size,             //!< Requested size, unchanged on success
+                   bool& recoverable                   //!< Set to false, the memory is not recoverable across runs
+                   ) override;
+
+    //! Return an allocation. The region is reused once every allocation was returned.
+    void deallocate(const NATIVE_UINT_TYPE identifier,  //!< Identifier of the allocation
+                    void* ptr                           //!< The allocation
+                    ) override;
+
+    //! \return the size of the region in bytes
+    U64 getCapacity() const;
+
+    //! \return the number of bytes handed out, including alignment padding
+    U64 getUsed() const;
+
+    //! \return the highest number of bytes handed out at once
+    U64 getPeak() const;
+
+    //! \return true when the region is backed by huge pages
+    bool isHugePages() const;
+
+    //! \return the number of identifiers accounted so far
+    U32 getIdentifierCount() const;
+
+    //! \return the usage of an accounted identifier
+    Usage getUsage(U32 index  //!< Index below getIdentifierCount(), in first allocation order
+    ) const;
+
+    //! Log the use of the region and of every identifier
+    void report() const;
+
+  private:
+    //! Accounting entry of an identifier, creating it when there is room
+    Usage* findUsage(NATIVE_UINT_TYPE identifier);
+
+    //! Log the use of the region, with the lock held
+    void logUsage() const;
+
+    U8* m_region = nullptr;              //!< Start of the region, nullptr before setup
+    U64 m_capacity = 0;                  //!< Usable size of the region
+    U64 m_mappedSize = 0;                //!< Size of the mapping
+    U64 m_offset = 0;                    //!< Bytes handed out
+    U64 m_peak = 0;                      //!< Highest offset reached
+    U32 m_live = 0;                      //!< Allocations not returned yet
+    bool m_hugePages = false;            //!< The region is on huge pages
+    Usage m_usage[MAX_IDENTIFIERS];      //!< Accounting per identifier
+    U32 m_identifiers = 0;               //!< Number of entries used in m_usage
+    Usage m_otherUsage;                  //!< Accounting of the identifiers beyond MAX_IDENTIFIERS
+    mutable Os::Mutex m_lock;            //!< Serializes allocations
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,32 @@
+// ======================================================================
+// \title  ArenaAllocatorTestMain.cpp
+// \author ortega
+// \brief  cpp file for ArenaAllocator test main function
+// ======================================================================
+
+#include "ArenaAllocatorTester.hpp"
+
+TEST(Nominal, TestAllocate) {
+    Components::ArenaAllocatorTester tester;
+    tester.testAllocate();
+}
+
+TEST(Nominal, TestReuse) {
+    Components::ArenaAllocatorTester tester;
+    tester.testReuse();
+}
+
+TEST(Nominal, TestHugePages) {
+    Components::ArenaAllocatorTester tester;
+    tester.testHugePages();
+}
+
+TEST(OffNominal, TestExhausted) {
+    Components::ArenaAllocatorTester tester;
+    tester.testExhausted();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
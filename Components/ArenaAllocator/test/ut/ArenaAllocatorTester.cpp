@@ -0,0 +1,109 @@
+// ======================================================================
+// \title  ArenaAllocatorTester.cpp
+// \author ortega
+// \brief  cpp file for ArenaAllocator test harness implementation class
+// ======================================================================
+
+#include "ArenaAllocatorTester.hpp"
+
+#include <cstring>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 ArenaAllocatorTester::TEST_ARENA_SIZE;
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void ArenaAllocatorTester ::testAllocate() {
+    ASSERT_TRUE(this->allocator.setup(TEST_ARENA_SIZE - 10, false));
+    ASSERT_EQ(this->allocator.getCapacity(), TEST_ARENA_SIZE);
+    ASSERT_FALSE(this->allocator.isHugePages());
+
+    bool recoverable = true;
+    NATIVE_UINT_TYPE size = 100;
+    U8* first = static_cast<U8*>(this->allocator.allocate(1, size, recoverable));
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(size, 100U);
+    ASSERT_FALSE(recoverable);
+    ASSERT_EQ(reinterpret_cast<PlatformPointerCastType>(first) % ArenaAllocator::ALIGNMENT, 0U);
+
+    // Each allocation starts on the next cache line after the previous one
+    size = 64;
+    U8* second = static_cast<U8*>(this->allocator.allocate(2, size, recoverable));
+    ASSERT_EQ(second, first + 128);
+    size = 1;
+    U8* third = static_cast<U8*>(this->allocator.allocate(1, size, recoverable));
+    ASSERT_EQ(third, second + 64);
+    (void)memset(first, 0xFF, 100);
+    (void)memset(second, 0xFF, 64);
+    ASSERT_EQ(this->allocator.getUsed(), 256U);
+    ASSERT_EQ(this->allocator.getPeak(), 256U);
+
+    ASSERT_EQ(this->allocator.getIdentifierCount(), 2U);
+    ArenaAllocator::Usage usage = this->allocator.getUsage(0);
+    ASSERT_EQ(usage.identifier, 1U);
+    ASSERT_EQ(usage.bytes, 192U);
+    ASSERT_EQ(usage.allocations, 2U);
+    usage = this->allocator.getUsage(1);
+    ASSERT_EQ(usage.identifier, 2U);
+    ASSERT_EQ(usage.bytes, 64U);
+    ASSERT_EQ(usage.allocations, 1U);
+    this->allocator.report();
+
+    this->allocator.deallocate(1, first);
+    this->allocator.deallocate(2, second);
+    this->allocator.deallocate(1, third);
+    this->allocator.release();
+    ASSERT_EQ(this->allocator.getCapacity(), 0U);
+}
+
+void ArenaAllocatorTester ::testReuse() {
+    ASSERT_TRUE(this->allocator.setup(TEST_ARENA_SIZE, false));
+    bool recoverable = false;
+    NATIVE_UINT_TYPE size = TEST_ARENA_SIZE / 2;
+    void* first = this->allocator.allocate(1, size, recoverable);
+    void* second = this->allocator.allocate(2, size, recoverable);
+    ASSERT_EQ(this->allocator.getUsed(), TEST_ARENA_SIZE);
+
+    // Memory returned while other allocations are live is not reused
+    this->allocator.deallocate(1, first);
+    ASSERT_EQ(this->allocator.getUsed(), TEST_ARENA_SIZE);
+    this->allocator.deallocate(2, second);
+    ASSERT_EQ(this->allocator.getUsed(), 0U);
+    ASSERT_EQ(this->allocator.getPeak(), TEST_ARENA_SIZE);
+
+    // The whole region is available again
+    size = TEST_ARENA_SIZE;
+    void* whole = this->allocator.allocate(3, size, recoverable);
+    ASSERT_EQ(whole, first);
+    this->allocator.deallocate(3, whole);
+}
+
+void ArenaAllocatorTester ::testHugePages() {
+    ASSERT_TRUE(this->allocator.setup(TEST_ARENA_SIZE, true));
+    ASSERT_EQ(this->allocator.getCapacity(), TEST_ARENA_SIZE);
+    bool recoverable = false;
+    NATIVE_UINT_TYPE size = TEST_ARENA_SIZE;
+    U8* memory = static_cast<U8*>(this->allocator.allocate(1, size, recoverable));
+    ASSERT_NE(memory, nullptr);
+    (void)memset(memory, 0xFF, size);
+    this->allocator.deallocate(1, memory);
+}
+
+void ArenaAllocatorTester ::testExhausted() {
+    ASSERT_TRUE(this->allocator.setup(TEST_ARENA_SIZE, false));
+    bool recoverable = false;
+    NATIVE_UINT_TYPE size = TEST_ARENA_SIZE - ArenaAllocator::ALIGNMENT;
+    void* memory = this->allocator.allocate(1, size, recoverable);
+    ASSERT_NE(memory, nullptr);
+
+    // One byte too many for the remaining cache line
+    size = ArenaAllocator::ALIGNMENT + 1;
+    ASSERT_DEATH(this->allocator.allocate(2, size, recoverable), "");
+    this->allocator.deallocate(1, memory);
+}
+
+}  // namespace Components
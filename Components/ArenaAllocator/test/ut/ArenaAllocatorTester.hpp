@@ -0,0 +1,49 @@
+// ======================================================================
+// \title  ArenaAllocatorTester.hpp
+// \author ortega
+// \brief  hpp file for ArenaAllocator test harness implementation class
+// ======================================================================
+
+#ifndef Components_ArenaAllocatorTester_HPP
+#define Components_ArenaAllocatorTester_HPP
+
+#include <gtest/gtest.h>
+
+#include "Components/ArenaAllocator/ArenaAllocator.hpp"
+
+namespace Components {
+
+class ArenaAllocatorTester {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    //! Size of the region used by the tests
+    static const U32 TEST_ARENA_SIZE = 4096;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Allocations are aligned, contiguous and accounted per identifier
+    void testAllocate();
+
+    //! The region is reused once every allocation is returned, the peak is kept
+    void testReuse();
+
+    //! A huge page region, or its normal page fallback, serves allocations
+    void testHugePages();
+
+    //! An allocation beyond the region asserts
+    void testExhausted();
+
+  private:
+    //! The allocator under test
+    ArenaAllocator allocator;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,205 @@
+// ======================================================================
+// \title  AsyncTextLogger.cpp
+// \author ortega
+// \brief  cpp file for AsyncTextLogger component implementation class
+// ======================================================================
+
+#include "Components/AsyncTextLogger/AsyncTextLogger.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <time.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+namespace Components {
+
+static_assert((ASYNC_TEXT_LOGGER_RECORDS & (ASYNC_TEXT_LOGGER_RECORDS - 1)) == 0,
+              "Ring positions wrap around the 32-bit counters, so the ring size must be a power of two");
+
+const FwSizeType AsyncTextLogger::BATCH_SIZE;
+const U32 AsyncTextLogger::FLUSH_PERIOD_US;
+
+namespace {
+//! Room kept in the batch for one more event: the longest prefix and the whole text
+const FwSizeType LINE_MAX_SIZE = 96 + FW_LOG_TEXT_BUFFER_SIZE;
+
+//! Severity names printed by Svc.PassiveTextLogger
+const char* severityName(U8 severity) {
+    switch (severity) {
+        case Fw::LogSeverity::FATAL:
+            return "FATAL";
+        case Fw::LogSeverity::WARNING_HI:
+            return "WARNING_HI";
+        case Fw::LogSeverity::WARNING_LO:
+            return "WARNING_LO";
+        case Fw::LogSeverity::COMMAND:
+            return "COMMAND";
+        case Fw::LogSeverity::ACTIVITY_HI:
+            return "ACTIVITY_HI";
+        case Fw::LogSeverity::ACTIVITY_LO:
+            return "ACTIVITY_LO";
+        case Fw::LogSeverity::DIAGNOSTIC:
+            return "DIAGNOSTIC";
+        default:
+            return "SEVERITY ERROR";
+    }
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+AsyncTextLogger ::AsyncTextLogger(const char* const compName)
+    : AsyncTextLoggerComponentBase(compName),
+      m_enqueue(0),
+      m_dequeue(0),
+      m_dropped(0),
+      m_droppedReported(0),
+      m_writes(0),
+      m_batchSize(0),
+      m_fd(STDOUT_FILENO),
+      m_running(false) {
+    for (U32 position = 0; position < ASYNC_TEXT_LOGGER_RECORDS; position++) {
+        this->m_records[position].sequence.store(position, std::memory_order_relaxed);
+    }
+}
+
+AsyncTextLogger ::~AsyncTextLogger() {}
+
+void AsyncTextLogger ::setOutput(int fd) {
+    FW_ASSERT(fd >= 0, static_cast<FwAssertArgType>(fd));
+    this->m_fd = fd;
+}
+
+void AsyncTextLogger ::start(const Fw::StringBase& name, FwSizeType priority, FwSizeType stackSize) {
+    FW_ASSERT(!this->m_running.load());
+    this->m_running.store(true);
+    Os::Task::Arguments arguments(name, AsyncTextLogger::loggerTask, this, priority, stackSize);
+    const Os::Task::Status status = this->m_task.start(arguments);
+    FW_ASSERT(status == Os::Task::OP_OK, static_cast<FwAssertArgType>(status));
+}
+
+void AsyncTextLogger ::stop() {
+    if (this->m_running.exchange(false)) {
+        (void)this->m_task.join();
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void AsyncTextLogger ::TextLogger_handler(FwIndexType portNum,
+                                          FwEventIdType id,
+                                          Fw::Time& timeTag,
+                                          const Fw::LogSeverity& severity,
+                                          Fw::TextLogString& text) {
+    // Claim the record at the enqueue position once the logger thread has released it; any number of threads may log
+    U32 position = this->m_enqueue.load(std::memory_order_relaxed);
+    Record* record = nullptr;
+    for (;;) {
+        record = &this->m_records[position & (ASYNC_TEXT_LOGGER_RECORDS - 1)];
+        const I32 lag = static_cast<I32>(record->sequence.load(std::memory_order_acquire) - position);
+        if (lag == 0) {
+            if (this->m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (lag < 0) {
+            // The logger thread has not written this record yet: the ring is full
+            this->m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = this->m_enqueue.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->id = id;
+    record->seconds = timeTag.getSeconds();
+    record->useconds = timeTag.getUSeconds();
+    record->timeBase = static_cast<FwTimeBaseStoreType>(timeTag.getTimeBase());
+    record->severity = static_cast<U8>(severity.e);
+    const FwSizeType length = FW_MIN(static_cast<FwSizeType>(text.length()), sizeof(record->text));
+    (void)memcpy(record->text, text.toChar(), static_cast<size_t>(length));
+    record->length = static_cast<U16>(length);
+    record->sequence.store(position + 1, std::memory_order_release);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void AsyncTextLogger ::loggerTask(void* component) {
+    FW_ASSERT(component != nullptr);
+    AsyncTextLogger* const logger = static_cast<AsyncTextLogger*>(component);
+    const struct timespec period = {0, static_cast<long>(FLUSH_PERIOD_US) * 1000};
+    while (logger->m_running.load()) {
+        (void)logger->drain();
+        (void)nanosleep(&period, nullptr);
+    }
+    // The events logged up to the stop request
+    (void)logger->drain();
+}
+
+U32 AsyncTextLogger ::drain() {
+    U32 events = 0;
+    for (;;) {
+        Record& record = this->m_records[this->m_dequeue & (ASYNC_TEXT_LOGGER_RECORDS - 1)];
+        if (record.sequence.load(std::memory_order_acquire) != this->m_dequeue + 1) {
+            break;
+        }
+        if ((BATCH_SIZE - this->m_batchSize) < LINE_MAX_SIZE) {
+            this->writeBatch();
+        }
+        const int written =
+            snprintf(&this->m_batch[this->m_batchSize], static_cast<size_t>(BATCH_SIZE - this->m_batchSize),
+                     "EVENT: (%u) (%u:%u,%u) %s: %.*s\n", static_cast<unsigned int>(record.id),
+                     static_cast<unsigned int>(record.timeBase), static_cast<unsigned int>(record.seconds),
+                     static_cast<unsigned int>(record.useconds), severityName(record.severity),
+                     static_cast<int>(record.length), record.text);
+        FW_ASSERT(written > 0, static_cast<FwAssertArgType>(written));
+        this->m_batchSize += FW_MIN(static_cast<FwSizeType>(written), BATCH_SIZE - this->m_batchSize - 1);
+        // Release the record to the producers
+        record.sequence.store(this->m_dequeue + ASYNC_TEXT_LOGGER_RECORDS, std::memory_order_release);
+        this->m_dequeue++;
+        events++;
+    }
+
+    const U32 dropped = this->m_dropped.load(std::memory_order_relaxed);
+    if (dropped != this->m_droppedReported) {
+        const int written = snprintf(&this->m_batch[this->m_batchSize],
+                                     static_cast<size_t>(BATCH_SIZE - this->m_batchSize),
+                                     "[WARNING] Text logger dropped %u events\n", dropped - this->m_droppedReported);
+        this->m_batchSize += FW_MIN(static_cast<FwSizeType>(FW_MAX(written, 0)), BATCH_SIZE - this->m_batchSize - 1);
+        this->m_droppedReported = dropped;
+        this->tlmWrite_DroppedTextEvents(dropped);
+    }
+    this->writeBatch();
+    return events;
+}
+
+void AsyncTextLogger ::writeBatch() {
+    if (this->m_batchSize == 0) {
+        return;
+    }
+    FwSizeType offset = 0;
+    while (offset < this->m_batchSize) {
+        const ssize_t written = ::write(this->m_fd, &this->m_batch[offset], this->m_batchSize - offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // Nowhere left to report the error: the batch is lost
+            break;
+        }
+        offset += static_cast<FwSizeType>(written);
+    }
+    this->m_batchSize = 0;
+    this->m_writes++;
+    this->tlmWrite_TextWrites(this->m_writes);
+}
+
+}  // namespace Components
@@ -0,0 +1,112 @@
+// ======================================================================
+// \title  AsyncTextLogger.hpp
+// \author ortega
+// \brief  hpp file for AsyncTextLogger component implementation class
+// ======================================================================
+
+#ifndef Components_AsyncTextLogger_HPP
+#define Components_AsyncTextLogger_HPP
+
+#include <atomic>
+
+#include "Components/AsyncTextLogger/AsyncTextLoggerComponentAc.hpp"
+#include "Components/AsyncTextLogger/FppConstantsAc.hpp"
+#include "Os/Task.hpp"
+
+namespace Components {
+
+class AsyncTextLogger : public AsyncTextLoggerComponentBase {
+  public:
+    //! Size of the buffer the events are formatted into before each write
+    static const FwSizeType BATCH_SIZE = 16384;
+
+    //! Period the logger thread sleeps for between batches, in microseconds
+    static const U32 FLUSH_PERIOD_US = 20000;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct AsyncTextLogger object
+    AsyncTextLogger(const char* const compName  //!< The component name
+    );
+
+    //! Destroy AsyncTextLogger object
+    ~AsyncTextLogger();
+
+    //! Set the file descriptor the events are written to. Defaults to the standard output.
+    void setOutput(int fd  //!< The file descriptor
+    );
+
+    //! Start the thread writing the events. Events logged before are kept in the ring until then.
+    void start(const Fw::StringBase& name,                   //!< Name of the logger thread
+               FwSizeType priority,                           //!< Priority of the logger thread, a low one
+               FwSizeType stackSize = Os::Task::TASK_DEFAULT  //!< Stack size of the logger thread
+    );
+
+    //! Stop the logger thread once it has written the events logged so far, and wait for it to exit
+    void stop();
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for TextLogger
+        //!
+        //! Copies the event into the ring, or counts it as dropped when the ring is full
+        void
+        TextLogger_handler(FwIndexType portNum,                //!< The port number
+                           FwEventIdType id,                   //!< Event ID
+                           Fw::Time& timeTag,                  //!< Time Tag
+                           const Fw::LogSeverity& severity,    //!< The severity argument
+                           Fw::TextLogString& text             //!< Text of log message
+                           ) override;
+
+    PRIVATE :
+        //! One text event in the ring. The sequence tells who owns the record: equal to the enqueue position it is free
+        //! for that producer, one more it holds that event for the logger thread.
+        struct Record {
+            std::atomic<U32> sequence;
+            FwEventIdType id;
+            U32 seconds;
+            U32 useconds;
+            FwTimeBaseStoreType timeBase;
+            U8 severity;
+            U16 length;  //!< Length of the text, not terminated
+            char text[FW_LOG_TEXT_BUFFER_SIZE];
+        };
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Entry point of the logger thread
+    static void loggerTask(void* component  //!< The AsyncTextLogger component
+    );
+
+    //! Format the events in the ring and write them, on the logger thread
+    //!
+    //! \return the number of events written
+    U32 drain();
+
+    //! Write a formatted batch, retrying partial writes
+    void writeBatch();
+
+    Record m_records[ASYNC_TEXT_LOGGER_RECORDS];  //! The ring
+    std::atomic<U32> m_enqueue;                   //! Position of the next event a producer claims
+    U32 m_dequeue;                                //! Position of the next event the logger thread writes
+    std::atomic<U32> m_dropped;                   //! Events dropped because the ring was full
+    U32 m_droppedReported;                        //! Dropped events already reported, on the logger thread
+    U32 m_writes;                                 //! Batched writes, on the logger thread
+    char m_batch[BATCH_SIZE];                     //! Formatted events of the current batch
+    FwSizeType m_batchSize;                       //! Bytes in m_batch
+    int m_fd;                                     //! Where the events are written
+    Os::Task m_task;                              //! The logger thread
+    std::atomic<bool> m_running;                  //! Flag: true while the logger thread runs
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,27 @@
+// ======================================================================
+// \title  AsyncTextLoggerTestMain.cpp
+// \author ortega
+// \brief  cpp file for AsyncTextLogger component test main function
+// ======================================================================
+
+#include "AsyncTextLoggerTester.hpp"
+
+TEST(Nominal, TestFormat) {
+    Components::AsyncTextLoggerTester tester;
+    tester.testFormat();
+}
+
+TEST(OffNominal, TestOverflow) {
+    Components::AsyncTextLoggerTester tester;
+    tester.testOverflow();
+}
+
+TEST(Nominal, TestThreaded) {
+    Components::AsyncTextLoggerTester tester;
+    tester.testThreaded();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+// ======================================================================
+// \title  AsyncTextLoggerTester.cpp
+// \author ortega
+// \brief  cpp file for AsyncTextLogger component test harness implementation class
+// ======================================================================
+
+#include "AsyncTextLoggerTester.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <thread>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 AsyncTextLoggerTester::LOGGING_THREADS;
+
+namespace {
+const char OUTPUT_FILE[] = "AsyncTextLoggerTest.txt";
+
+//! Number of lines of a text
+U32 countLines(const std::string& text) {
+    U32 lines = 0;
+    for (const char character : text) {
+        lines += (character == '\n') ? 1 : 0;
+    }
+    return lines;
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+AsyncTextLoggerTester ::AsyncTextLoggerTester()
+    : AsyncTextLoggerGTestBase("AsyncTextLoggerTester", AsyncTextLoggerTester::MAX_HISTORY_SIZE),
+      component("AsyncTextLogger"),
+      m_output(open(OUTPUT_FILE, O_RDWR | O_CREAT | O_TRUNC, 0644)) {
+    this->initComponents();
+    this->connectPorts();
+    this->component.setOutput(this->m_output);
+}
+
+AsyncTextLoggerTester ::~AsyncTextLoggerTester() {
+    (void)close(this->m_output);
+    (void)unlink(OUTPUT_FILE);
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void AsyncTextLoggerTester ::testFormat() {
+    this->logText(0x0E05, Fw::LogSeverity::ACTIVITY_LO, "LED is ON");
+    this->logText(0x0E06, Fw::LogSeverity::WARNING_HI, "Blink interval 0");
+    // Nothing is written on the logging thread
+    ASSERT_EQ(this->readOutput(), "");
+
+    ASSERT_EQ(this->component.drain(), 2U);
+    ASSERT_EQ(this->readOutput(),
+              "EVENT: (3589) (2:10,500) ACTIVITY_LO: LED is ON\n"
+              "EVENT: (3590) (2:10,500) WARNING_HI: Blink interval 0\n");
+    ASSERT_TLM_TextWrites_SIZE(1);
+    ASSERT_TLM_TextWrites(0, 1U);
+    ASSERT_TLM_DroppedTextEvents_SIZE(0);
+
+    // Nothing new, nothing written
+    ASSERT_EQ(this->component.drain(), 0U);
+    ASSERT_TLM_TextWrites_SIZE(1);
+}
+
+void AsyncTextLoggerTester ::testOverflow() {
+    for (U32 event = 0; event < ASYNC_TEXT_LOGGER_RECORDS + 5; event++) {
+        this->logText(event, Fw::LogSeverity::DIAGNOSTIC, "filler");
+    }
+    ASSERT_EQ(this->component.m_dropped.load(), 5U);
+
+    // The ring holds the first events; the drop is reported after them
+    ASSERT_EQ(this->component.drain(), ASYNC_TEXT_LOGGER_RECORDS);
+    const std::string output = this->readOutput();
+    ASSERT_EQ(countLines(output), ASYNC_TEXT_LOGGER_RECORDS + 1);
+    ASSERT_EQ(output.find("EVENT: (0) "), 0U);
+    ASSERT_NE(output.find("[WARNING] Text logger dropped 5 events\n"), std::string::npos);
+    ASSERT_TLM_DroppedTextEvents_SIZE(1);
+    ASSERT_TLM_DroppedTextEvents(0, 5U);
+    // The whole ring fits in one batch
+    ASSERT_TLM_TextWrites_SIZE(1);
+
+    // The ring is free again
+    this->logText(1, Fw::LogSeverity::DIAGNOSTIC, "after");
+    ASSERT_EQ(this->component.drain(), 1U);
+    ASSERT_EQ(this->component.m_dropped.load(), 5U);
+}
+
+void AsyncTextLoggerTester ::testThreaded() {
+    this->component.start(Os::TaskString("TextLogTest"), Os::Task::TASK_DEFAULT);
+    const U32 perThread = 100;
+    std::thread threads[LOGGING_THREADS];
+    for (U32 thread = 0; thread < LOGGING_THREADS; thread++) {
+        threads[thread] = std::thread([this, thread, perThread] {
+            for (U32 event = 0; event < perThread; event++) {
+                this->logText(thread, Fw::LogSeverity::ACTIVITY_HI, "threaded");
+            }
+        });
+    }
+    for (U32 thread = 0; thread < LOGGING_THREADS; thread++) {
+        threads[thread].join();
+    }
+    this->component.stop();
+
+    // Every event is written or counted as dropped
+    const std::string output = this->readOutput();
+    const U32 dropped = this->component.m_dropped.load();
+    ASSERT_EQ(countLines(output), LOGGING_THREADS * perThread - dropped + ((dropped > 0) ? 1 : 0));
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void AsyncTextLoggerTester ::logText(FwEventIdType id, const Fw::LogSeverity::T severity, const char* text) {
+    Fw::Time timeTag(TB_WORKSTATION_TIME, 0, 10, 500);
+    Fw::TextLogString string(text);
+    this->invoke_to_TextLogger(0, id, timeTag, severity, string);
+}
+
+std::string AsyncTextLoggerTester ::readOutput() {
+    std::string output;
+    char buffer[4096];
+    EXPECT_EQ(lseek(this->m_output, 0, SEEK_SET), 0);
+    ssize_t size = 0;
+    while ((size = read(this->m_output, buffer, sizeof(buffer))) > 0) {
+        output.append(buffer, static_cast<size_t>(size));
+    }
+    return output;
+}
+
+}  // namespace Components
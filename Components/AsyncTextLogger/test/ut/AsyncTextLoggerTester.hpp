@@ -0,0 +1,88 @@
+// ======================================================================
+// \title  AsyncTextLoggerTester.hpp
+// \author ortega
+// \brief  hpp file for AsyncTextLogger component test harness implementation class
+// ======================================================================
+
+#ifndef Components_AsyncTextLoggerTester_HPP
+#define Components_AsyncTextLoggerTester_HPP
+
+#include <string>
+
+#include "Components/AsyncTextLogger/AsyncTextLogger.hpp"
+#include "Components/AsyncTextLogger/AsyncTextLoggerGTestBase.hpp"
+
+namespace Components {
+
+class AsyncTextLoggerTester : public AsyncTextLoggerGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 100;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    //! Number of threads logging at once in the threaded test
+    static const U32 LOGGING_THREADS = 4;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object AsyncTextLoggerTester
+    AsyncTextLoggerTester();
+
+    //! Destroy object AsyncTextLoggerTester
+    ~AsyncTextLoggerTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Events are written in logging order, formatted like Svc.PassiveTextLogger, in one write
+    void testFormat();
+
+    //! Events beyond the ring are counted and reported, not waited for
+    void testOverflow();
+
+    //! Events logged from several threads are all written by the logger thread, the last ones on stop
+    void testThreaded();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! Log a text event
+    void logText(FwEventIdType id, const Fw::LogSeverity::T severity, const char* text);
+
+    //! \return everything written to the output file
+    std::string readOutput();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    AsyncTextLogger component;
+
+    //! File the component writes to
+    int m_output;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,110 @@
+// ======================================================================
+// \title  BootProfiler.cpp
+// \author ortega
+// \brief  cpp file for BootProfiler component implementation class
+// ======================================================================
+
+#include "Components/BootProfiler/BootProfiler.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Logger/Logger.hpp"
+#include "Fw/Types/StringUtils.hpp"
+
+#include <time.h>
+#include <cstring>
+
+namespace Components {
+
+const U32 BootProfiler::NO_PHASE;
+const U32 BootProfiler::PHASE_NAME_SIZE;
+
+namespace {
+const U64 NANOSECONDS_PER_MICROSECOND = 1000;
+const U64 NANOSECONDS_PER_SECOND = 1000000000ULL;
+
+//! Microseconds between two monotonic times, saturated to the event argument range
+U32 toMicroseconds(U64 from, U64 to) {
+    const U64 microseconds = (to > from) ? (to - from) / NANOSECONDS_PER_MICROSECOND : 0;
+    return static_cast<U32>(FW_MIN(microseconds, static_cast<U64>(0xFFFFFFFF)));
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+BootProfiler ::BootProfiler(const char* const compName) : BootProfilerComponentBase(compName) {
+    (void)memset(this->m_phases, 0, sizeof(this->m_phases));
+}
+
+BootProfiler ::~BootProfiler() {}
+
+void BootProfiler ::start() {
+    Os::ScopeLock lock(this->m_lock);
+    this->m_startNs = now();
+    this->m_phaseCount = 0;
+    this->m_phasesDropped = 0;
+}
+
+U32 BootProfiler ::begin(const char* name) {
+    FW_ASSERT(name != nullptr);
+    Os::ScopeLock lock(this->m_lock);
+    if (this->m_phaseCount >= BOOT_PROFILER_MAX_PHASES) {
+        this->m_phasesDropped++;
+        return NO_PHASE;
+    }
+    Phase& phase = this->m_phases[this->m_phaseCount];
+    (void)Fw::StringUtils::string_copy(phase.name, name, sizeof(phase.name));
+    phase.ended = false;
+    phase.startNs = now();
+    return this->m_phaseCount++;
+}
+
+void BootProfiler ::end(U32 phase) {
+    const U64 endNs = now();
+    if (phase == NO_PHASE) {
+        return;
+    }
+    Os::ScopeLock lock(this->m_lock);
+    FW_ASSERT(phase < this->m_phaseCount, static_cast<FwAssertArgType>(phase),
+              static_cast<FwAssertArgType>(this->m_phaseCount));
+    this->m_phases[phase].endNs = endNs;
+    this->m_phases[phase].ended = true;
+}
+
+U32 BootProfiler ::report(bool parallel) {
+    const U64 reportNs = now();
+    Os::ScopeLock lock(this->m_lock);
+    const U32 totalUs = toMicroseconds(this->m_startNs, reportNs);
+    U32 phases = 0;
+    for (U32 index = 0; index < this->m_phaseCount; index++) {
+        const Phase& phase = this->m_phases[index];
+        if (!phase.ended) {
+            continue;
+        }
+        const U32 startUs = toMicroseconds(this->m_startNs, phase.startNs);
+        const U32 durationUs = toMicroseconds(phase.startNs, phase.endNs);
+        Fw::Logger::log("[INFO] Boot phase %-24s at %8u us took %8u us\n", phase.name, startUs, durationUs);
+        this->log_ACTIVITY_LO_BootPhase(Fw::String(phase.name), startUs, durationUs);
+        phases++;
+    }
+    if (this->m_phasesDropped > 0) {
+        Fw::Logger::log("[WARNING] Boot profiler: %u phases not timed, raise BOOT_PROFILER_MAX_PHASES\n",
+                        this->m_phasesDropped);
+    }
+    Fw::Logger::log("[INFO] Boot completed in %u us over %u phases%s\n", totalUs, phases,
+                    parallel ? " (parallel bring-up)" : "");
+    this->log_ACTIVITY_HI_BootCompleted(totalUs, phases, parallel);
+    return totalUs;
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U64 BootProfiler ::now() {
+    struct timespec time;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<U64>(time.tv_sec) * NANOSECONDS_PER_SECOND + static_cast<U64>(time.tv_nsec);
+}
+
+}  // namespace Components
@@ -0,0 +1,82 @@
+// ======================================================================
+// \title  BootProfiler.hpp
+// \author ortega
+// \brief  hpp file for BootProfiler component implementation class
+// ======================================================================
+
+#ifndef Components_BootProfiler_HPP
+#define Components_BootProfiler_HPP
+
+#include "Components/BootProfiler/BootProfilerComponentAc.hpp"
+#include "Components/BootProfiler/FppConstantsAc.hpp"
+#include "Os/Mutex.hpp"
+
+namespace Components {
+
+class BootProfiler : public BootProfilerComponentBase {
+  public:
+    //! Phase index returned when every phase slot is taken. Ending it does nothing.
+    static const U32 NO_PHASE = 0xFFFFFFFF;
+
+    //! Longest phase name kept, including the terminating null
+    static const U32 PHASE_NAME_SIZE = 32;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct BootProfiler object
+    BootProfiler(const char* const compName  //!< The component name
+    );
+
+    //! Destroy BootProfiler object
+    ~BootProfiler();
+
+    //! Mark the start of the bring-up. Phases are timed relative to it. May be called before the component is
+    //! initialized.
+    void start();
+
+    //! Start timing a phase. Safe to call from any thread.
+    //!
+    //! \return the index of the phase, to pass to end, or NO_PHASE when all phase slots are taken
+    U32 begin(const char* name  //!< Name of the phase, truncated to PHASE_NAME_SIZE - 1 characters
+    );
+
+    //! Stop timing a phase. Safe to call from any thread.
+    void end(U32 phase  //!< Index returned by begin
+    );
+
+    //! Print the ended phases and the total bring-up time and log them as events. Call once the topology is
+    //! connected.
+    //!
+    //! \return the bring-up time in microseconds
+    U32 report(bool parallel  //!< Independent phases overlapped, reported with the total
+    );
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! \return the monotonic time in nanoseconds
+        static U64
+        now();
+
+    //! Timing of one phase
+    struct Phase {
+        char name[PHASE_NAME_SIZE];  //!< Name of the phase
+        U64 startNs;                 //!< Start of the phase, monotonic
+        U64 endNs;                   //!< End of the phase, monotonic
+        bool ended;                  //!< end was called
+    };
+
+    Os::Mutex m_lock;                            //! Guards the phases against the bring-up threads
+    Phase m_phases[BOOT_PROFILER_MAX_PHASES];    //! Phases in begin order
+    U32 m_phaseCount = 0;                        //! Number of phases begun
+    U32 m_phasesDropped = 0;                     //! Phases begun with every slot taken
+    U64 m_startNs = 0;                           //! Start of the bring-up, monotonic
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,27 @@
+// ======================================================================
+// \title  BootProfilerTestMain.cpp
+// \author ortega
+// \brief  cpp file for BootProfiler component test main function
+// ======================================================================
+
+#include "BootProfilerTester.hpp"
+
+TEST(Nominal, TestPhases) {
+    Components::BootProfilerTester tester;
+    tester.testPhases();
+}
+
+TEST(Nominal, TestOverlap) {
+    Components::BootProfilerTester tester;
+    tester.testOverlap();
+}
+
+TEST(OffNominal, TestFull) {
+    Components::BootProfilerTester tester;
+    tester.testFull();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
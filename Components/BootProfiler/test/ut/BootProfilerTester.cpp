@@ -0,0 +1,102 @@
+// ======================================================================
+// \title  BootProfilerTester.cpp
+// \author ortega
+// \brief  cpp file for BootProfiler component test harness implementation class
+// ======================================================================
+
+#include "BootProfilerTester.hpp"
+
+#include <unistd.h>
+#include <cstring>
+#include <thread>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 BootProfilerTester::TEST_PHASE_US;
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+BootProfilerTester ::BootProfilerTester()
+    : BootProfilerGTestBase("BootProfilerTester", BootProfilerTester::MAX_HISTORY_SIZE), component("BootProfiler") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+BootProfilerTester ::~BootProfilerTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void BootProfilerTester ::testPhases() {
+    this->component.start();
+    const U32 first = this->component.begin("first");
+    (void)usleep(TEST_PHASE_US);
+    this->component.end(first);
+    const U32 second = this->component.begin("second phase with a name longer than the event keeps");
+    (void)usleep(TEST_PHASE_US);
+    this->component.end(second);
+    (void)this->component.begin("unfinished");
+    const U32 totalUs = this->component.report(false);
+
+    ASSERT_EVENTS_BootPhase_SIZE(2);
+    ASSERT_STREQ(this->eventHistory_BootPhase->at(0).phase.toChar(), "first");
+    ASSERT_EQ(strlen(this->eventHistory_BootPhase->at(1).phase.toChar()), BootProfiler::PHASE_NAME_SIZE - 1);
+    ASSERT_GE(this->eventHistory_BootPhase->at(0).durationUs, TEST_PHASE_US);
+    ASSERT_GE(this->eventHistory_BootPhase->at(1).durationUs, TEST_PHASE_US);
+    // The second phase starts once the first ended
+    ASSERT_GE(this->eventHistory_BootPhase->at(1).startUs,
+              this->eventHistory_BootPhase->at(0).startUs + this->eventHistory_BootPhase->at(0).durationUs);
+    ASSERT_EVENTS_BootCompleted_SIZE(1);
+    ASSERT_EVENTS_BootCompleted(0, totalUs, 2, false);
+    ASSERT_GE(totalUs, 2 * TEST_PHASE_US);
+}
+
+void BootProfilerTester ::testOverlap() {
+    this->component.start();
+    const U32 outer = this->component.begin("outer");
+    std::thread worker([this]() {
+        const U32 inner = this->component.begin("inner");
+        (void)usleep(TEST_PHASE_US);
+        this->component.end(inner);
+    });
+    worker.join();
+    this->component.end(outer);
+    (void)this->component.report(true);
+
+    ASSERT_EVENTS_BootPhase_SIZE(2);
+    ASSERT_STREQ(this->eventHistory_BootPhase->at(0).phase.toChar(), "outer");
+    ASSERT_STREQ(this->eventHistory_BootPhase->at(1).phase.toChar(), "inner");
+    // The inner phase lies within the outer one
+    ASSERT_GE(this->eventHistory_BootPhase->at(0).durationUs, this->eventHistory_BootPhase->at(1).durationUs);
+    ASSERT_GE(this->eventHistory_BootPhase->at(1).startUs, this->eventHistory_BootPhase->at(0).startUs);
+    ASSERT_EQ(this->eventHistory_BootCompleted->at(0).parallel, true);
+}
+
+void BootProfilerTester ::testFull() {
+    this->component.start();
+    for (U32 index = 0; index < BOOT_PROFILER_MAX_PHASES; index++) {
+        const U32 phase = this->component.begin("phase");
+        ASSERT_EQ(phase, index);
+        this->component.end(phase);
+    }
+    const U32 dropped = this->component.begin("dropped");
+    ASSERT_EQ(dropped, BootProfiler::NO_PHASE);
+    this->component.end(dropped);
+    (void)this->component.report(false);
+
+    ASSERT_EVENTS_BootPhase_SIZE(BOOT_PROFILER_MAX_PHASES);
+    ASSERT_EQ(this->eventHistory_BootCompleted->at(0).phases, static_cast<U32>(BOOT_PROFILER_MAX_PHASES));
+
+    // Starting again forgets the phases of the previous bring-up
+    this->clearHistory();
+    this->component.start();
+    this->component.end(this->component.begin("again"));
+    (void)this->component.report(false);
+    ASSERT_EVENTS_BootPhase_SIZE(1);
+}
+
+}  // namespace Components
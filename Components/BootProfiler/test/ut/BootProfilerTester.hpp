@@ -0,0 +1,77 @@
+// ======================================================================
+// \title  BootProfilerTester.hpp
+// \author ortega
+// \brief  hpp file for BootProfiler component test harness implementation class
+// ======================================================================
+
+#ifndef Components_BootProfilerTester_HPP
+#define Components_BootProfilerTester_HPP
+
+#include "Components/BootProfiler/BootProfiler.hpp"
+#include "Components/BootProfiler/BootProfilerGTestBase.hpp"
+
+namespace Components {
+
+class BootProfilerTester : public BootProfilerGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 20;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    //! Time the timed test phases last, in microseconds
+    static const U32 TEST_PHASE_US = 2000;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object BootProfilerTester
+    BootProfilerTester();
+
+    //! Destroy object BootProfilerTester
+    ~BootProfilerTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Ended phases are reported in begin order with their start and duration, phases not ended are left out
+    void testPhases();
+
+    //! Phases begun on different threads overlap
+    void testOverlap();
+
+    //! Phases begun with every slot taken are not timed and do not disturb the others
+    void testFull();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    BootProfiler component;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,58 @@
+// ======================================================================
+// \title  CycleTimestamp.cpp
+// \author ortega
+// \brief  cpp file for CycleTimestamp component implementation class
+// ======================================================================
+
+#include "Components/CycleTimestamp/CycleTimestamp.hpp"
+#include "FpConfig.hpp"
+
+#include <chrono>
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+CycleTimestamp ::CycleTimestamp(const char* const compName)
+    : CycleTimestampComponentBase(compName), m_sequence(0), m_start(0), m_cycle(0) {}
+
+CycleTimestamp ::~CycleTimestamp() {}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void CycleTimestamp ::cycleIn_handler(FwIndexType portNum, Os::RawTime& cycleStart) {
+    const U64 now = static_cast<U64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+
+    // Only the cycle thread writes, so the sequence lock needs no compare-exchange
+    const U32 sequence = this->m_sequence.load(std::memory_order_relaxed);
+    this->m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    this->m_start.store(now, std::memory_order_relaxed);
+    this->m_cycle.store(this->m_cycle.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    this->m_sequence.store(sequence + 2, std::memory_order_release);
+
+    // Port may not be connected, so check before sending output
+    if (this->isConnected_cycleOut_OutputPort(0)) {
+        this->cycleOut_out(0, cycleStart);
+    }
+}
+
+U64 CycleTimestamp ::getCycleStart_handler(FwIndexType portNum, U32& cycle) {
+    U32 before = 0;
+    U64 start = 0;
+    do {
+        before = this->m_sequence.load(std::memory_order_acquire);
+        start = this->m_start.load(std::memory_order_relaxed);
+        cycle = this->m_cycle.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (((before & 1U) != 0) || (before != this->m_sequence.load(std::memory_order_relaxed)));
+    return start;
+}
+
+}  // namespace Components
@@ -0,0 +1,57 @@
+// ======================================================================
+// \title  CycleTimestamp.hpp
+// \author ortega
+// \brief  hpp file for CycleTimestamp component implementation class
+// ======================================================================
+
+#ifndef Components_CycleTimestamp_HPP
+#define Components_CycleTimestamp_HPP
+
+#include <atomic>
+
+#include "Components/CycleTimestamp/CycleTimestampComponentAc.hpp"
+
+namespace Components {
+
+class CycleTimestamp : public CycleTimestampComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct CycleTimestamp object
+    CycleTimestamp(const char* const compName  //!< The component name
+    );
+
+    //! Destroy CycleTimestamp object
+    ~CycleTimestamp();
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for cycleIn
+        //!
+        //! Records the cycle start and forwards the cycle
+        void
+        cycleIn_handler(FwIndexType portNum,  //!< The port number
+                        Os::RawTime& cycleStart  //!< Cycle start timestamp
+                        ) override;
+
+    //! Handler implementation for getCycleStart
+    //!
+    //! Returns the start time of the current cycle
+    U64 getCycleStart_handler(FwIndexType portNum,  //!< The port number
+                              U32& cycle            //!< Set to the index of the current cycle
+                              ) override;
+
+    std::atomic<U32> m_sequence;  //! Sequence lock over m_start and m_cycle, odd while the cycle thread updates them
+    std::atomic<U64> m_start;     //! Start of the current cycle in steady clock nanoseconds
+    std::atomic<U32> m_cycle;     //! Index of the current cycle
+};
+
+}  // namespace Components
+
+#endif
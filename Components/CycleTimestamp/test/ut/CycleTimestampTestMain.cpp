@@ -0,0 +1,17 @@
+// ======================================================================
+// \title  CycleTimestampTestMain.cpp
+// \author ortega
+// \brief  cpp file for CycleTimestamp component test main function
+// ======================================================================
+
+#include "CycleTimestampTester.hpp"
+
+TEST(Nominal, TestCycleStart) {
+    Components::CycleTimestampTester tester;
+    tester.testCycleStart();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,59 @@
+// ======================================================================
+// \title  CycleTimestampTester.cpp
+// \author ortega
+// \brief  cpp file for CycleTimestamp component test harness implementation class
+// ======================================================================
+
+#include "CycleTimestampTester.hpp"
+
+#include <chrono>
+
+namespace Components {
+
+namespace {
+U64 steadyNow() {
+    return static_cast<U64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+CycleTimestampTester ::CycleTimestampTester()
+    : CycleTimestampGTestBase("CycleTimestampTester", CycleTimestampTester::MAX_HISTORY_SIZE),
+      component("CycleTimestamp") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+CycleTimestampTester ::~CycleTimestampTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void CycleTimestampTester ::testCycleStart() {
+    // No cycle has started yet
+    U32 cycle = 10;
+    ASSERT_EQ(this->invoke_to_getCycleStart(0, cycle), 0U);
+    ASSERT_EQ(cycle, 0U);
+
+    // Every cycle is forwarded and its start recorded
+    Os::RawTime cycleStart;
+    for (U32 i = 1; i <= 3; i++) {
+        const U64 before = steadyNow();
+        this->invoke_to_cycleIn(0, cycleStart);
+        const U64 after = steadyNow();
+        ASSERT_from_cycleOut_SIZE(i);
+
+        const U64 start = this->invoke_to_getCycleStart(0, cycle);
+        ASSERT_EQ(cycle, i);
+        ASSERT_GE(start, before);
+        ASSERT_LE(start, after);
+    }
+}
+
+}  // namespace Components
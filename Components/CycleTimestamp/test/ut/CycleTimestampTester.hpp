@@ -0,0 +1,67 @@
+// ======================================================================
+// \title  CycleTimestampTester.hpp
+// \author ortega
+// \brief  hpp file for CycleTimestamp component test harness implementation class
+// ======================================================================
+
+#ifndef Components_CycleTimestampTester_HPP
+#define Components_CycleTimestampTester_HPP
+
+#include "Components/CycleTimestamp/CycleTimestamp.hpp"
+#include "Components/CycleTimestamp/CycleTimestampGTestBase.hpp"
+
+namespace Components {
+
+class CycleTimestampTester : public CycleTimestampGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object CycleTimestampTester
+    CycleTimestampTester();
+
+    //! Destroy object CycleTimestampTester
+    ~CycleTimestampTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void testCycleStart();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    CycleTimestamp component;
+};
+
+}  // namespace Components
+
+#endif
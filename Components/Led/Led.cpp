@@ -5,22 +5,143 @@
 // ======================================================================
 
 #include "Components/Led/Led.hpp"
+#include "Components/Led/PassiveLed.hpp"
 #include "FpConfig.hpp"
 
+#include <time.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+
 namespace Components {
 
+namespace {
+const U64 NANOSECONDS_PER_SECOND = 1000000000ULL;
+
+//! Period the PWM thread sleeps for while PWM is off, bounding how long stopPwm and PWM_ON_OFF take to be noticed
+const U64 PWM_IDLE_PERIOD_NS = 10000000ULL;
+
+//! Number of edge log segment files kept on disk, reused round robin
+const U32 EDGE_LOG_FILES = 64;
+
+//! Number of statistics windows per second of carrier
+const U32 PWM_WINDOWS_PER_SECOND = 10;
+
+//! Monotonic time in nanoseconds
+U64 monotonicNow() {
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<U64>(now.tv_sec) * NANOSECONDS_PER_SECOND + static_cast<U64>(now.tv_nsec);
+}
+
+//! Steady clock time in nanoseconds, the clock of the CycleStartGet port
+U64 steadyNow() {
+    return static_cast<U64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+//! Clamp a duration in nanoseconds to a timing sample
+U32 toSample(U64 nanoseconds) {
+    return static_cast<U32>(FW_MIN(nanoseconds, static_cast<U64>(0xFFFFFFFF)));
+}
+
+//! Sleep until an absolute monotonic time in nanoseconds
+void sleepUntil(U64 deadline) {
+    struct timespec wake;
+    wake.tv_sec = static_cast<time_t>(deadline / NANOSECONDS_PER_SECOND);
+    wake.tv_nsec = static_cast<long>(deadline % NANOSECONDS_PER_SECOND);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr) == EINTR) {
+    }
+}
+}  // namespace
+
 // ----------------------------------------------------------------------
 // Component construction and destruction
 // ----------------------------------------------------------------------
 
-Led ::Led(const char* const compName) : LedComponentBase(compName) {}
+// The parameter generation starts ahead of the snapshot so the first tick copies the parameters
+template <class Base>
+LedImpl<Base> ::LedImpl(const char* const compName)
+    : Base(compName),
+      m_paramGeneration(1),
+      m_pwmRunning(false),
+      m_pwmEnabled(false),
+      m_pwmActive(false),
+      m_pwmGate(true),
+      m_pwmDuty(50),
+      m_pwmFrequency(500),
+      m_pwmDutyError(0),
+      m_pwmJitterMean(0),
+      m_pwmJitterMax(0),
+      m_pwmStatsGeneration(0),
+      m_edgeLogFlush(false),
+      m_edgeLogPrefix("LedEdges"),
+      m_edgeSegmentsFilled(0),
+      m_edgeSegmentsWritten(0),
+      m_edgeLogRunning(false) {}
 
-Led ::~Led() {}
+template <class Base>
+LedImpl<Base> ::~LedImpl() {}
+
+template <class Base>
+void LedImpl<Base> ::startPwm(const Fw::StringBase& name,
+                              FwSizeType priority,
+                              FwSizeType stackSize,
+                              FwSizeType cpuAffinity) {
+    FW_ASSERT(!this->m_pwmRunning.load());
+    this->m_pwmRunning.store(true);
+    Os::Task::Arguments arguments(name, LedImpl::pwmTask, this, priority, stackSize, cpuAffinity);
+    const Os::Task::Status status = this->m_pwmTask.start(arguments);
+    FW_ASSERT(status == Os::Task::OP_OK, static_cast<FwAssertArgType>(status));
+}
+
+template <class Base>
+void LedImpl<Base> ::stopPwm() {
+    if (this->m_pwmRunning.exchange(false)) {
+        (void)this->m_pwmTask.join();
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::configureEdgeLog(const char* prefix) {
+    FW_ASSERT(prefix != nullptr);
+    this->m_edgeLogPrefix = prefix;
+}
+
+template <class Base>
+void LedImpl<Base> ::startEdgeLog(const Fw::StringBase& name,
+                                  FwSizeType priority,
+                                  FwSizeType stackSize,
+                                  FwSizeType cpuAffinity) {
+    FW_ASSERT(!this->m_edgeLogRunning.load());
+    this->m_edgeLogRunning.store(true);
+    Os::Task::Arguments arguments(name, LedImpl::edgeLogTask, this, priority, stackSize, cpuAffinity);
+    const Os::Task::Status status = this->m_edgeLogTask.start(arguments);
+    FW_ASSERT(status == Os::Task::OP_OK, static_cast<FwAssertArgType>(status));
+}
+
+template <class Base>
+void LedImpl<Base> ::stopEdgeLog() {
+    {
+        std::lock_guard<std::mutex> guard(this->m_edgeLogLock);
+        if (!this->m_edgeLogRunning.exchange(false)) {
+            return;
+        }
+    }
+    this->m_edgeLogWake.notify_one();
+    (void)this->m_edgeLogTask.join();
+}
+
+template <class Base>
+void LedImpl<Base> ::parameterUpdated(FwPrmIdType id) {
+    // Updates arrive on the command dispatcher thread: the tick path picks up the new values at its next tick
+    this->m_paramGeneration.fetch_add(1, std::memory_order_release);
 
-void Led ::parameterUpdated(FwPrmIdType id) {
     Fw::ParamValid isValid = Fw::ParamValid::INVALID;
     switch (id) {
-        case PARAMID_BLINK_INTERVAL: {
+        case Base::PARAMID_BLINK_INTERVAL: {
             // Read back the parameter value
             const U32 interval = this->paramGet_BLINK_INTERVAL(isValid);
             // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
@@ -30,70 +151,757 @@ void Led ::parameterUpdated(FwPrmIdType id) {
             this->log_ACTIVITY_HI_BlinkIntervalSet(interval);
             break;
         }
+        case Base::PARAMID_EVENT_MODE: {
+            const LedEventMode mode = this->paramGet_EVENT_MODE(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_EventModeSet(mode);
+            break;
+        }
+        case Base::PARAMID_SUMMARY_PERIOD: {
+            const U32 period = this->paramGet_SUMMARY_PERIOD(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_SummaryPeriodSet(period);
+            break;
+        }
+        case Base::PARAMID_TIMING_WINDOW: {
+            const U32 window = this->paramGet_TIMING_WINDOW(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_TimingWindowSet(window);
+            break;
+        }
+        case Base::PARAMID_PWM_DUTY: {
+            const U8 duty = this->paramGet_PWM_DUTY(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_PwmDutySet(duty);
+            break;
+        }
+        case Base::PARAMID_PWM_FREQUENCY: {
+            const U32 frequency = this->paramGet_PWM_FREQUENCY(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_PwmFrequencySet(frequency);
+            break;
+        }
         default:
             FW_ASSERT(0, static_cast<FwAssertArgType>(id));
             break;
     }
 }
 
+template <class Base>
+void LedImpl<Base> ::parametersLoaded() {
+    this->m_paramGeneration.fetch_add(1, std::memory_order_release);
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
 
-void Led ::run_handler(FwIndexType portNum, U32 context) {
-    // Read back the parameter value
-    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
-    U32 interval = this->paramGet_BLINK_INTERVAL(isValid);
-    FW_ASSERT((isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT),
-              static_cast<FwAssertArgType>(isValid));
+template <class Base>
+void LedImpl<Base> ::run_handler(FwIndexType portNum, U32 context) {
+    U32 sample = 0;
+    if (this->cycleLatency(sample)) {
+        this->recordLatency(sample);
+    }
+    this->advance(1);
 
-    // Only perform actions when set to blinking
-    if (this->m_blinking && (interval != 0)) {
-        // If toggling state
-        if (this->m_toggleCounter == 0) {
-            // Toggle state
-            this->m_state = (this->m_state == Fw::On::ON) ? Fw::On::OFF : Fw::On::ON;
-            this->m_transitions++;
-            this->tlmWrite_LedTransitions(this->m_transitions);
-
-            // Port may not be connected, so check before sending output
-            if (this->isConnected_gpioSet_OutputPort(0)) {
-                this->gpioSet_out(0, (Fw::On::ON == this->m_state) ? Fw::Logic::HIGH : Fw::Logic::LOW);
-            }
+    // Port may not be connected, so check before sending output
+    if (this->isConnected_tickDone_OutputPort(0)) {
+        this->tickDone_out(0, 0);
+    }
+}
 
-            this->log_ACTIVITY_LO_LedState(this->m_state);
+template <class Base>
+void LedImpl<Base> ::edgeLogRun_handler(FwIndexType portNum, U32 context) {
+    // Full segments are handed over as they complete, a partial one only on request. The files are written by the
+    // edge log thread, so a slow disk does not hold up the other members of the rate group.
+    bool flush = this->m_edgeLogFlush.exchange(false);
+    bool handed = false;
+    U32 filled = this->m_edgeSegmentsFilled.load(std::memory_order_relaxed);
+    while ((filled - this->m_edgeSegmentsWritten.load(std::memory_order_acquire)) < EDGE_LOG_SEGMENT_BUFFERS) {
+        const U32 available = this->m_edgeLog.available();
+        if ((available < LedEdgeLog::SEGMENT_RECORDS) && !(flush && (available > 0))) {
+            flush = false;
+            break;
+        }
+        EdgeSegment& segment = this->m_edgeSegments[filled % EDGE_LOG_SEGMENT_BUFFERS];
+        segment.sequence = this->m_edgeLogSequence++;
+        segment.records = this->m_edgeLog.takeSegment(segment.sequence, segment.data, segment.size);
+        filled++;
+        this->m_edgeSegmentsFilled.store(filled, std::memory_order_release);
+        handed = true;
+    }
+    // Both buffers are still being written: the remaining edges wait in the ring for the next call
+    if (flush && (this->m_edgeLog.available() > 0)) {
+        this->m_edgeLogFlush.store(true);
+    }
+    if (handed) {
+        { std::lock_guard<std::mutex> guard(this->m_edgeLogLock); }
+        this->m_edgeLogWake.notify_one();
+    }
+    this->tlmWrite_EdgeLogDropped(this->m_edgeLog.dropped());
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+template <class Base>
+void LedImpl<Base> ::BLINKING_ON_OFF_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::On onOff) {
+    this->m_toggleCounter = 0;               // Reset count on any successful command
+    this->m_blinking = Fw::On::ON == onOff;  // Update blinking state
+    this->m_logNextToggle = true;            // Report the commanded edge even when summarizing events
+    this->restartPattern();                  // Patterns start over from their first segment
+    this->m_lastRise = 0;                    // Edge periods are only measured within one blinking run
+
+    this->log_ACTIVITY_HI_SetBlinkingState(onOff);
+
+    this->tlmWrite_BlinkingState(onOff);
+
+    // Provide command response
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+template <class Base>
+void LedImpl<Base> ::PATTERN_SELECT_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, LedPatternId pattern) {
+    // Custom slots can only be played once a pattern file was loaded into them
+    if ((LedPatternId::BLINK != pattern) && (this->patternOf(pattern).count == 0)) {
+        this->log_WARNING_LO_PatternEmpty(pattern);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    this->m_pattern = pattern;
+    this->m_toggleCounter = 0;
+    this->m_logNextToggle = true;
+    this->restartPattern();
+
+    this->log_ACTIVITY_HI_PatternSelected(pattern);
+    this->tlmWrite_ActivePattern(pattern);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+template <class Base>
+void LedImpl<Base> ::PATTERN_LOAD_cmdHandler(FwOpcodeType opCode,
+                                             U32 cmdSeq,
+                                             U8 slot,
+                                             const Fw::CmdStringArg& fileName) {
+    LedPatternStore store;
+    const LedPatternStatus status =
+        (slot < LED_PATTERN_CUSTOM_SLOTS) ? store.load(fileName.toChar()) : LedPatternStatus::OK;
+    this->installPattern(opCode, cmdSeq, slot, store, status);
+}
+
+template <class Base>
+void LedImpl<Base> ::PATTERN_LOOP_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U32 count) {
+    this->m_patternRepeats = count;
+    this->restartPattern();
+    this->log_ACTIVITY_HI_PatternLoopSet(count);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+template <class Base>
+void LedImpl<Base> ::PWM_ON_OFF_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::On onOff) {
+    if (!this->m_pwmRunning.load()) {
+        this->log_WARNING_LO_PwmNotStarted();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+        return;
+    }
+    // The PWM thread takes or hands back the GPIO at its next period
+    this->m_pwmEnabled.store(Fw::On::ON == onOff, std::memory_order_release);
+
+    this->log_ACTIVITY_HI_SetPwmState(onOff);
+    this->tlmWrite_PwmState(onOff);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+template <class Base>
+void LedImpl<Base> ::EDGE_LOG_FLUSH_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    // The partial segment is handed over by the next edgeLogRun call and written by the edge log thread
+    this->m_edgeLogFlush.store(true);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Edge log thread
+// ----------------------------------------------------------------------
+
+template <class Base>
+void LedImpl<Base> ::edgeLogTask(void* component) {
+    FW_ASSERT(component != nullptr);
+    LedImpl* const led = static_cast<LedImpl*>(component);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(led->m_edgeLogLock);
+            led->m_edgeLogWake.wait(lock, [led] {
+                return !led->m_edgeLogRunning.load() ||
+                       (led->m_edgeSegmentsWritten.load(std::memory_order_relaxed) !=
+                        led->m_edgeSegmentsFilled.load(std::memory_order_acquire));
+            });
+        }
+        // The segments handed over before the stop are still written
+        led->writeEdgeSegments();
+        if (!led->m_edgeLogRunning.load()) {
+            break;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------
+// PWM thread
+// ----------------------------------------------------------------------
+
+template <class Base>
+void LedImpl<Base> ::pwmTask(void* component) {
+    FW_ASSERT(component != nullptr);
+    LedImpl* const led = static_cast<LedImpl*>(component);
+    PwmCarrier carrier;
+    carrier.periodStart = monotonicNow();
+    while (led->m_pwmRunning.load()) {
+        led->pwmStep(carrier);
+    }
+    // Leave the GPIO to the tick path on exit
+    Os::ScopeLock lock(led->m_gpioLock);
+    led->m_pwmActive.store(false, std::memory_order_release);
+}
+
+template <class Base>
+void LedImpl<Base> ::pwmStep(PwmCarrier& carrier) {
+    if (!this->m_pwmEnabled.load(std::memory_order_acquire)) {
+        if (this->m_pwmActive.load(std::memory_order_relaxed)) {
+            // Hand the GPIO back to the tick path with the level it last asked for. The lock keeps a tick from
+            // driving a new level between the handback and this write.
+            Os::ScopeLock lock(this->m_gpioLock);
+            this->m_pwmActive.store(false, std::memory_order_release);
+            (void)this->pwmDrive(carrier, this->m_ledOn, monotonicNow());
+            carrier = PwmCarrier();
+        }
+        carrier.periodStart = monotonicNow() + PWM_IDLE_PERIOD_NS;
+        sleepUntil(carrier.periodStart);
+        return;
+    }
+    if (!this->m_pwmActive.load(std::memory_order_relaxed)) {
+        // Take the GPIO over from the tick path, which left it at the level of the LED
+        Os::ScopeLock lock(this->m_gpioLock);
+        carrier.level = this->m_ledOn;
+        this->m_pwmActive.store(true, std::memory_order_release);
+        carrier.periodStart = monotonicNow();
+    }
+
+    const U32 frequency = this->m_pwmFrequency.load(std::memory_order_relaxed);
+    const U64 period = NANOSECONDS_PER_SECOND / frequency;
+    const U64 high = period * this->m_pwmDuty.load(std::memory_order_relaxed) / 100;
+    const U64 start = carrier.periodStart;
+
+    if (this->m_pwmGate.load(std::memory_order_acquire) && (high > 0)) {
+        const U64 rise = this->pwmDrive(carrier, true, start);
+        U64 onTime = period;
+        if (high < period) {
+            sleepUntil(start + high);
+            onTime = this->pwmDrive(carrier, false, start + high) - rise;
+        }
+        carrier.gatedTime += period;
+        carrier.commandedOnTime += high;
+        carrier.onTime += onTime;
+    } else {
+        (void)this->pwmDrive(carrier, false, start);
+    }
+
+    // Periods are absolute deadlines: a late period is shortened rather than shifting the ones after it, and periods
+    // missed completely are skipped
+    carrier.periodStart = start + period;
+    const U64 now = monotonicNow();
+    if (now >= carrier.periodStart) {
+        carrier.periodStart += ((now - carrier.periodStart) / period + 1) * period;
+    }
+
+    carrier.periods++;
+    const U32 windowPeriods = FW_MAX(frequency / PWM_WINDOWS_PER_SECOND, 1U);
+    if (carrier.periods >= windowPeriods) {
+        this->pwmPublish(carrier);
+    }
+    sleepUntil(carrier.periodStart);
+}
+
+template <class Base>
+U64 LedImpl<Base> ::pwmDrive(PwmCarrier& carrier, bool level, U64 deadline) {
+    if (carrier.level == level) {
+        return monotonicNow();
+    }
+    if (this->isConnected_gpioSet_OutputPort(0)) {
+        this->gpioSet_out(0, level ? Fw::Logic::HIGH : Fw::Logic::LOW);
+    }
+    carrier.level = level;
+    const U64 now = monotonicNow();
+    const U64 lateness = (now > deadline) ? (now - deadline) : 0;
+    const U32 jitter = static_cast<U32>(FW_MIN(lateness, static_cast<U64>(0xFFFFFFFF)));
+    carrier.jitterSum += jitter;
+    carrier.jitterMax = FW_MAX(carrier.jitterMax, jitter);
+    carrier.edges++;
+    return now;
+}
+
+template <class Base>
+void LedImpl<Base> ::pwmPublish(PwmCarrier& carrier) {
+    // Windows spent entirely gated off have no duty cycle to compare against
+    I32 dutyError = 0;
+    if (carrier.gatedTime > 0) {
+        const I64 difference = static_cast<I64>(carrier.onTime) - static_cast<I64>(carrier.commandedOnTime);
+        dutyError = static_cast<I32>(difference * 10000 / static_cast<I64>(carrier.gatedTime));
+    }
+    this->m_pwmDutyError.store(dutyError, std::memory_order_relaxed);
+    this->m_pwmJitterMean.store((carrier.edges > 0) ? static_cast<U32>(carrier.jitterSum / carrier.edges) : 0,
+                                std::memory_order_relaxed);
+    this->m_pwmJitterMax.store(carrier.jitterMax, std::memory_order_relaxed);
+    this->m_pwmStatsGeneration.fetch_add(1, std::memory_order_release);
+
+    const U64 periodStart = carrier.periodStart;
+    const bool level = carrier.level;
+    carrier = PwmCarrier();
+    carrier.periodStart = periodStart;
+    carrier.level = level;
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+template <class Base>
+void LedImpl<Base> ::advance(U32 ticks) {
+    FW_ASSERT(ticks > 0);
+    this->m_ticks += ticks;
+
+    // The parameter lock is only taken when a parameter changed since the last tick
+    const U32 generation = this->m_paramGeneration.load(std::memory_order_acquire);
+    if (generation != this->m_snapshotGeneration) {
+        this->m_snapshotGeneration = generation;
+        this->loadParamSnapshot();
+    }
+    const U32 interval = this->m_params.blinkInterval;
+    const LedEventMode mode = this->m_params.eventMode;
+
+    // Patterns decide the state of the LED on every tick
+    if (this->m_blinking && (LedPatternId::BLINK != this->m_pattern)) {
+        bool on = (Fw::On::ON == this->m_state);
+        U64 transitions = 0;
+        for (U32 tick = 0; tick < ticks; tick++) {
+            const bool next = this->m_player.tick();
+            transitions += (next != on) ? 1 : 0;
+            on = next;
+            if (this->m_player.isDone()) {
+                break;
+            }
+        }
+        const Fw::On next = on ? Fw::On::ON : Fw::On::OFF;
+        if (next != this->m_state) {
+            this->toggle(mode);
+        }
+        this->countTransitions(transitions);
+        // A pattern played the requested number of times stops blinking
+        if (this->m_player.isDone()) {
+            this->m_blinking = false;
+            this->log_ACTIVITY_LO_PatternComplete(this->m_pattern);
+            this->tlmWrite_BlinkingState(Fw::On::OFF);
         }
+    }
+    // Symmetric blinking
+    else if (this->m_blinking && (interval != 0)) {
+        // The LED toggles on the ticks where the counter is 0: only an odd number of them changes its state
+        const U64 counter = this->m_toggleCounter;
+        const U64 toggles = (counter + ticks + interval - 1) / interval - (counter + interval - 1) / interval;
+        if ((toggles % 2) == 1) {
+            this->toggle(mode);
+        }
+        this->countTransitions(toggles);
 
-        this->m_toggleCounter = (this->m_toggleCounter + 1) % interval;
+        this->m_toggleCounter = static_cast<U32>((counter + ticks) % interval);
     }
     // We are not blinking
     else {
         if (this->m_state == Fw::On::ON) {
-            // Port may not be connected, so check before sending output
-            if (this->isConnected_gpioSet_OutputPort(0)) {
-                this->gpioSet_out(0, Fw::Logic::LOW);
-            }
+            this->driveGpio(Fw::On::OFF);
 
+            // An explicit state change is always reported as an edge
             this->m_state = Fw::On::OFF;
             this->log_ACTIVITY_LO_LedState(this->m_state);
         }
     }
+
+    if (LedEventMode::SUMMARY == mode) {
+        for (U32 tick = 0; tick < ticks; tick++) {
+            this->updateSummary(this->m_params.summaryPeriod);
+        }
+    } else if (this->m_summaryTicks != 0) {
+        this->resetSummary();
+    }
+
+    this->m_timingTicks += ticks;
+    if (this->m_timingTicks >= this->m_params.timingWindow) {
+        this->reportTiming();
+    }
+
+    // The PWM carrier runs steadily when not blinking and follows the blinking otherwise
+    this->m_pwmGate.store((!this->m_blinking) || (Fw::On::ON == this->m_state), std::memory_order_release);
+    const U32 statsGeneration = this->m_pwmStatsGeneration.load(std::memory_order_acquire);
+    if (statsGeneration != this->m_pwmStatsPublished) {
+        this->m_pwmStatsPublished = statsGeneration;
+        this->tlmWrite_PwmDutyError(static_cast<F32>(this->m_pwmDutyError.load(std::memory_order_relaxed)) / 100.0f);
+        this->tlmWrite_PwmEdgeJitterMean(this->m_pwmJitterMean.load(std::memory_order_relaxed));
+        this->tlmWrite_PwmEdgeJitterMax(this->m_pwmJitterMax.load(std::memory_order_relaxed));
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::loadParamSnapshot() {
+    // Read back the parameter value
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    this->m_params.blinkInterval = this->paramGet_BLINK_INTERVAL(isValid);
+    FW_ASSERT((isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT),
+              static_cast<FwAssertArgType>(isValid));
+
+    // Event reporting parameters fall back to their defaults until they have been loaded
+    const LedEventMode mode = this->paramGet_EVENT_MODE(isValid);
+    const bool modeValid = (isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT);
+    this->m_params.eventMode = modeValid ? mode : LedEventMode(LedEventMode::PER_EDGE);
+    const U32 period = this->paramGet_SUMMARY_PERIOD(isValid);
+    const bool periodValid = (isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT);
+    this->m_params.summaryPeriod = periodValid ? period : ParamSnapshot().summaryPeriod;
+    const U32 window = this->paramGet_TIMING_WINDOW(isValid);
+    const bool windowValid = (isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT);
+    this->m_params.timingWindow = windowValid ? FW_MIN(FW_MAX(window, 1U), static_cast<U32>(LED_TIMING_MAX_SAMPLES))
+                                              : ParamSnapshot().timingWindow;
+
+    // The PWM thread reads its parameters from atomics, clamped to the range it can generate
+    const U8 duty = this->paramGet_PWM_DUTY(isValid);
+    if ((isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT)) {
+        this->m_pwmDuty.store(FW_MIN(static_cast<U32>(duty), 100U), std::memory_order_relaxed);
+    }
+    const U32 frequency = this->paramGet_PWM_FREQUENCY(isValid);
+    if ((isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT)) {
+        this->m_pwmFrequency.store(FW_MIN(FW_MAX(frequency, 1U), static_cast<U32>(LED_PWM_MAX_FREQUENCY)),
+                                   std::memory_order_relaxed);
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::toggle(LedEventMode mode) {
+    // Toggle state
+    this->m_state = (this->m_state == Fw::On::ON) ? Fw::On::OFF : Fw::On::ON;
+    this->driveGpio(this->m_state);
+
+    this->reportToggle(mode);
+}
+
+template <class Base>
+void LedImpl<Base> ::countTransitions(U64 transitions) {
+    if (transitions != 0) {
+        this->m_transitions += transitions;
+        this->tlmWrite_LedTransitions(this->m_transitions);
+    }
+}
+
+template <class Base>
+bool LedImpl<Base> ::cycleLatency(U32& sample) {
+    if (!this->isConnected_cycleStart_OutputPort(0)) {
+        return false;
+    }
+    U32 cycle = 0;
+    const U64 start = this->cycleStart_out(0, cycle);
+    const U64 now = steadyNow();
+    if ((start == 0) || (now < start)) {
+        return false;
+    }
+    sample = toSample(now - start);
+    return true;
+}
+
+template <class Base>
+void LedImpl<Base> ::recordLatency(U32 sample) {
+    if (this->m_latencyCount < LED_TIMING_MAX_SAMPLES) {
+        this->m_latencySamples[this->m_latencyCount++] = sample;
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::installPattern(FwOpcodeType opCode,
+                                    U32 cmdSeq,
+                                    U8 slot,
+                                    const LedPatternStore& store,
+                                    LedPatternStatus status) {
+    if (slot >= LED_PATTERN_CUSTOM_SLOTS) {
+        this->log_WARNING_LO_InvalidPatternSlot(slot);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    if (LedPatternStatus::OK != status) {
+        this->log_WARNING_LO_PatternLoadError(slot, status);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+        return;
+    }
+    this->m_customPatterns[slot] = store;
+    this->log_ACTIVITY_HI_PatternLoaded(slot, this->m_customPatterns[slot].pattern().count);
+
+    // Reloading the slot being played restarts it with the new table
+    if (static_cast<U32>(LedPatternId::CUSTOM_0 + slot) == static_cast<U32>(this->m_pattern.e)) {
+        this->restartPattern();
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+template <class Base>
+LedTimingStats LedImpl<Base> ::timingStats(U32* samples, U32 count) {
+    FW_ASSERT(samples != nullptr);
+    FW_ASSERT((count > 0) && (count <= LED_TIMING_MAX_SAMPLES), static_cast<FwAssertArgType>(count));
+    U64 sum = 0;
+    for (U32 i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    // Nearest rank 99th percentile
+    const U32 rank = (count * 99 + 99) / 100 - 1;
+    std::nth_element(samples, samples + rank, samples + count);
+    const U32 p99 = samples[rank];
+    const U32 minimum = *std::min_element(samples, samples + count);
+    const U32 maximum = *std::max_element(samples, samples + count);
+    return LedTimingStats(minimum / 1000, maximum / 1000, static_cast<U32>(sum / count / 1000), p99 / 1000);
+}
+
+template <class Base>
+void LedImpl<Base> ::reportTiming() {
+    if (this->m_latencyCount > 0) {
+        this->tlmWrite_DispatchLatency(LedImpl::timingStats(this->m_latencySamples, this->m_latencyCount));
+    }
+    if (this->m_periodCount > 0) {
+        this->tlmWrite_EdgePeriod(LedImpl::timingStats(this->m_periodSamples, this->m_periodCount));
+    }
+    this->m_latencyCount = 0;
+    this->m_periodCount = 0;
+    this->m_timingTicks = 0;
+}
+
+template <class Base>
+void LedImpl<Base> ::writeEdgeSegments() {
+    U32 written = this->m_edgeSegmentsWritten.load(std::memory_order_relaxed);
+    while (written != this->m_edgeSegmentsFilled.load(std::memory_order_acquire)) {
+        const EdgeSegment& segment = this->m_edgeSegments[written % EDGE_LOG_SEGMENT_BUFFERS];
+        Fw::String fileName;
+        fileName.format("%s_%02" PRIu32 ".bin", this->m_edgeLogPrefix.toChar(), segment.sequence % EDGE_LOG_FILES);
+        const Os::File::Status status = LedEdgeLog::writeFile(fileName.toChar(), segment.data, segment.size);
+        const U32 records = segment.records;
+        const U32 sequence = segment.sequence;
+        // The buffer goes back to edgeLogRun once the file is written
+        written++;
+        this->m_edgeSegmentsWritten.store(written, std::memory_order_release);
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_EdgeLogWriteError(fileName, static_cast<I32>(status));
+            continue;
+        }
+        this->m_edgeLogRecords += records;
+        this->tlmWrite_EdgeLogRecords(this->m_edgeLogRecords);
+
+        // Port may not be connected, the segment then stays on disk
+        if (this->isConnected_sendFile_OutputPort(0)) {
+            const Svc::SendFileResponse response = this->sendFile_out(0, fileName, fileName, 0, 0);
+            if (response.getstatus() != Svc::SendFileStatus::STATUS_OK) {
+                this->log_WARNING_LO_EdgeLogSendError(fileName, response.getstatus());
+                continue;
+            }
+            this->tlmWrite_EdgeLogSegments(sequence + 1);
+        }
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::driveGpio(Fw::On state) {
+    // Blink-level edges are recorded even while the PWM thread owns the GPIO, carrier edges are not
+    const Fw::Time now = this->getTime();
+    LedEdgeLog::Record record;
+    record.seconds = now.getSeconds();
+    record.useconds = now.getUSeconds();
+    record.tick = this->m_ticks;
+    record.state = (Fw::On::ON == state) ? 1 : 0;
+    (void)this->m_edgeLog.push(record);
+
+    {
+        // The level and the write are one step against the PWM thread taking the GPIO over or handing it back
+        Os::ScopeLock lock(this->m_gpioLock);
+        this->m_ledOn = (Fw::On::ON == state);
+        // Port may not be connected, so check before sending output
+        if ((!this->m_pwmActive.load(std::memory_order_relaxed)) && this->isConnected_gpioSet_OutputPort(0)) {
+            this->gpioSet_out(0, (Fw::On::ON == state) ? Fw::Logic::HIGH : Fw::Logic::LOW);
+        }
+    }
+
+    // Rising edges are timed once the GPIO was written
+    if (Fw::On::ON == state) {
+        const U64 now = steadyNow();
+        if ((this->m_lastRise != 0) && (this->m_periodCount < LED_TIMING_MAX_SAMPLES)) {
+            this->m_periodSamples[this->m_periodCount++] = toSample(now - this->m_lastRise);
+        }
+        this->m_lastRise = now;
+    }
+}
+
+template <class Base>
+LedPattern LedImpl<Base> ::patternOf(LedPatternId pattern) const {
+    if (pattern.e >= LedPatternId::CUSTOM_0) {
+        const U32 slot = static_cast<U32>(pattern.e - LedPatternId::CUSTOM_0);
+        FW_ASSERT(slot < LED_PATTERN_CUSTOM_SLOTS, static_cast<FwAssertArgType>(slot));
+        return this->m_customPatterns[slot].pattern();
+    }
+    return LedPattern::builtin(pattern);
+}
+
+template <class Base>
+void LedImpl<Base> ::restartPattern() {
+    if (LedPatternId::BLINK == this->m_pattern) {
+        this->m_player.stop();
+    } else {
+        this->m_player.start(this->patternOf(this->m_pattern), this->m_patternRepeats);
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::reportToggle(LedEventMode mode) {
+    // Summarized toggles are only counted, except for the first one following a command
+    const bool logToggle =
+        (LedEventMode::PER_EDGE == mode) || ((LedEventMode::SUMMARY == mode) && this->m_logNextToggle);
+    this->m_logNextToggle = false;
+    if (logToggle) {
+        this->log_ACTIVITY_LO_LedState(this->m_state);
+    }
+    if (LedEventMode::SUMMARY == mode) {
+        this->m_summaryToggles++;
+        this->m_lastToggleTime = this->getTime();
+    }
+}
+
+template <class Base>
+void LedImpl<Base> ::updateSummary(U32 period) {
+    this->m_summaryTicks++;
+    if (Fw::On::ON == this->m_state) {
+        this->m_summaryOnTicks++;
+    }
+    if (this->m_summaryTicks < period) {
+        return;
+    }
+    // Periods without any toggle are not worth an event
+    if (this->m_summaryToggles != 0) {
+        this->log_ACTIVITY_LO_LedSummary(this->m_summaryToggles, this->m_summaryOnTicks,
+                                         this->m_summaryTicks - this->m_summaryOnTicks,
+                                         this->m_lastToggleTime.getSeconds(), this->m_lastToggleTime.getUSeconds());
+    }
+    this->resetSummary();
+}
+
+template <class Base>
+void LedImpl<Base> ::resetSummary() {
+    this->m_summaryTicks = 0;
+    this->m_summaryToggles = 0;
+    this->m_summaryOnTicks = 0;
 }
 
 // ----------------------------------------------------------------------
-// Handler implementations for commands
+// Component variants
 // ----------------------------------------------------------------------
 
-void Led ::BLINKING_ON_OFF_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::On onOff) {
-    this->m_toggleCounter = 0;               // Reset count on any successful command
-    this->m_blinking = Fw::On::ON == onOff;  // Update blinking state
+// Both variants are compiled here so the implementation stays out of the header
+template class LedImpl<LedComponentBase>;
+template class LedImpl<PassiveLedComponentBase>;
 
-    this->log_ACTIVITY_HI_SetBlinkingState(onOff);
+const U32 Led::LATENCY_QUEUE_SIZE;
 
-    this->tlmWrite_BlinkingState(onOff);
+Led ::Led(const char* const compName)
+    : LedImpl<LedComponentBase>(compName),
+      m_latencyHead(0),
+      m_latencyTail(0),
+      m_pendingTicks(0),
+      m_coalesceTicks(true),
+      m_droppedTicks(0) {}
 
-    // Provide command response
-    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+Led ::~Led() {}
+
+void Led ::parameterUpdated(FwPrmIdType id) {
+    if (id != PARAMID_TICK_POLICY) {
+        LedImpl<LedComponentBase>::parameterUpdated(id);
+        return;
+    }
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    const LedTickPolicy policy = this->paramGet_TICK_POLICY(isValid);
+    FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+    this->m_coalesceTicks.store(LedTickPolicy::COALESCE == policy);
+    this->log_ACTIVITY_HI_TickPolicySet(policy);
+}
+
+void Led ::parametersLoaded() {
+    LedImpl<LedComponentBase>::parametersLoaded();
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    const LedTickPolicy policy = this->paramGet_TICK_POLICY(isValid);
+    if ((isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT)) {
+        this->m_coalesceTicks.store(LedTickPolicy::COALESCE == policy);
+    }
+}
+
+void Led ::run_handler(FwIndexType portNum, U32 context) {
+    // The tick is timed here, against its own cycle, and the sample handed to the component thread with it
+    U32 sample = 0;
+    if (this->cycleLatency(sample)) {
+        const U32 head = this->m_latencyHead.load(std::memory_order_relaxed);
+        if ((head - this->m_latencyTail.load(std::memory_order_acquire)) < LATENCY_QUEUE_SIZE) {
+            this->m_latencyQueue[head % LATENCY_QUEUE_SIZE] = sample;
+            this->m_latencyHead.store(head + 1, std::memory_order_release);
+        }
+    }
+    // Only the first tick since the last one ran queues a message, the others are picked up by it
+    if (this->m_pendingTicks.fetch_add(1, std::memory_order_acq_rel) == 0) {
+        this->tick_internalInterfaceInvoke();
+    }
+}
+
+void Led ::tick_internalInterfaceHandler() {
+    const U32 ticks = this->m_pendingTicks.exchange(0, std::memory_order_acq_rel);
+    if (ticks == 0) {
+        return;
+    }
+    this->drainLatency();
+    if (this->m_coalesceTicks.load()) {
+        this->m_coalescedTicks += ticks - 1;
+        this->advance(ticks);
+    } else {
+        this->m_droppedTicks.fetch_add(ticks - 1);
+        this->advance(1);
+    }
+
+    // Only sent when they change, overload is the exception
+    const U32 dropped = this->m_droppedTicks.load();
+    if (dropped != this->m_droppedReported) {
+        this->m_droppedReported = dropped;
+        this->tlmWrite_DroppedTicks(dropped);
+    }
+    if (this->m_coalescedTicks != this->m_coalescedReported) {
+        this->m_coalescedReported = this->m_coalescedTicks;
+        this->tlmWrite_CoalescedTicks(this->m_coalescedTicks);
+    }
+
+    // Port may not be connected, so check before sending output
+    if (this->isConnected_tickDone_OutputPort(0)) {
+        this->tickDone_out(0, 0);
+    }
+}
+
+void Led ::drainLatency() {
+    const U32 head = this->m_latencyHead.load(std::memory_order_acquire);
+    U32 tail = this->m_latencyTail.load(std::memory_order_relaxed);
+    for (; tail != head; tail++) {
+        this->recordLatency(this->m_latencyQueue[tail % LATENCY_QUEUE_SIZE]);
+    }
+    this->m_latencyTail.store(tail, std::memory_order_release);
+}
+
+void Led ::tick_internalInterfaceOverflowHook() {
+    // Only the tick message is dropped, commands assert on a full queue: its ticks are lost and the next tick queues a
+    // new message
+    this->m_droppedTicks.fetch_add(this->m_pendingTicks.exchange(0, std::memory_order_acq_rel));
+    if (this->isConnected_tickDone_OutputPort(0)) {
+        this->tickDone_out(0, 0);
+    }
 }
 
 }  // namespace Components
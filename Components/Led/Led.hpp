@@ -7,30 +7,99 @@
 #ifndef Components_Led_HPP
 #define Components_Led_HPP
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "Components/Led/FppConstantsAc.hpp"
 #include "Components/Led/LedComponentAc.hpp"
+#include "Components/Led/LedEdgeLog.hpp"
+#include "Components/Led/LedPattern.hpp"
+#include "Fw/Types/String.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
 
 namespace Components {
 
-class Led : public LedComponentBase {
+//! Implementation of the Led component, shared by its active and passive variants
+//!
+//! Base is the autocoded base class, LedComponentBase or PassiveLedComponentBase. The variants only differ in the
+//! thread the ticks and commands are handled on, so both are instantiated from this template in Led.cpp.
+template <class Base>
+class LedImpl : public Base {
   public:
     // ----------------------------------------------------------------------
     // Component construction and destruction
     // ----------------------------------------------------------------------
 
-    //! Construct Led object
-    Led(const char* const compName  //!< The component name
+    //! Construct LedImpl object
+    LedImpl(const char* const compName  //!< The component name
     );
 
-    //! Destroy Led object
-    ~Led();
+    //! Destroy LedImpl object
+    ~LedImpl();
 
-    PRIVATE :
+    //! Start the thread generating the PWM carrier. PWM_ON_OFF is rejected until it is started.
+    void startPwm(const Fw::StringBase& name,                 //!< Name of the PWM thread
+                  FwSizeType priority,                         //!< Priority of the PWM thread
+                  FwSizeType stackSize = Os::Task::TASK_DEFAULT,  //!< Stack size of the PWM thread
+                  FwSizeType cpuAffinity = Os::Task::TASK_DEFAULT  //!< CPU the PWM thread is bound to
+    );
+
+    //! Stop the PWM thread and wait for it to exit
+    void stopPwm();
+
+    //! Set the path prefix of the edge log segment files. Defaults to "LedEdges".
+    void configureEdgeLog(const char* prefix  //!< Path prefix, completed with the segment slot and ".bin"
+    );
+
+    //! Start the thread writing the edge log segment files. edgeLogRun only hands the segments over, so they stay in
+    //! memory until it is started.
+    void startEdgeLog(const Fw::StringBase& name,                 //!< Name of the edge log thread
+                      FwSizeType priority,                         //!< Priority of the edge log thread
+                      FwSizeType stackSize = Os::Task::TASK_DEFAULT,  //!< Stack size of the edge log thread
+                      FwSizeType cpuAffinity = Os::Task::TASK_DEFAULT  //!< CPU the edge log thread is bound to
+    );
+
+    //! Stop the edge log thread once it has written the segments already handed over, and wait for it to exit
+    void stopEdgeLog();
+
+    PROTECTED :
         //! Emit parameter updated EVR
         //!
         void
         parameterUpdated(FwPrmIdType id  //!< The parameter ID
                          ) override;
 
+    //! Invalidate the parameter snapshot once parameters are loaded
+    //!
+    void parametersLoaded() override;
+
+    //! Run rate group ticks. The ticks after the first only advance the blink counters: the LED is driven once, to the
+    //! state it would have after all of them.
+    void advance(U32 ticks  //!< Number of ticks to run, at least 1
+    );
+
+    //! Delay since the start of the current cycle. Called from run, on the rate group thread, so each tick is timed
+    //! against its own cycle.
+    //!
+    //! \return false when the cycle start is unknown
+    bool cycleLatency(U32& sample  //!< Receives the delay in nanoseconds
+    );
+
+    //! Add a dispatch latency sample to the timing window, on the thread running the ticks
+    void recordLatency(U32 sample  //!< The delay in nanoseconds
+    );
+
+    //! Install a pattern read by PATTERN_LOAD into a custom slot and send the command response. The file is read by
+    //! the caller, so a variant serializing commands with the ticks only needs to hold its lock around this call.
+    void installPattern(FwOpcodeType opCode,           //!< The opcode
+                        U32 cmdSeq,                    //!< The command sequence number
+                        U8 slot,                       //!< The custom slot to load
+                        const LedPatternStore& store,  //!< The pattern read from the file
+                        LedPatternStatus status        //!< Result of reading the file
+    );
+
     PRIVATE :
 
         // ----------------------------------------------------------------------
@@ -39,12 +108,19 @@ class Led : public LedComponentBase {
 
         //! Handler implementation for run
         //!
-        //! Port receiving calls from the rate group
+        //! Port receiving calls from the rate group, runs one tick then calls tickDone
         void
         run_handler(FwIndexType portNum,  //!< The port number
                     U32 context  //!< The call order
                     ) override;
 
+    //! Handler implementation for edgeLogRun
+    //!
+    //! Port writing the recorded edges to segment files
+    void edgeLogRun_handler(FwIndexType portNum,  //!< The port number
+                            U32 context           //!< The call order
+                            ) override;
+
     PRIVATE :
         // ----------------------------------------------------------------------
         // Handler implementations for commands
@@ -59,12 +135,275 @@ class Led : public LedComponentBase {
                                    Fw::On onOff          //!< Indicates whether the blinking should be on or off
                                    ) override;
 
+    //! Handler implementation for command PATTERN_SELECT
+    //!
+    //! Command to select the blink pattern played while blinking
+    void PATTERN_SELECT_cmdHandler(FwOpcodeType opCode,   //!< The opcode
+                                   U32 cmdSeq,            //!< The command sequence number
+                                   LedPatternId pattern  //!< The pattern to play
+                                   ) override;
+
+    //! Handler implementation for command PATTERN_LOAD
+    //!
+    //! Command to load a pattern file into a custom pattern slot
+    void PATTERN_LOAD_cmdHandler(FwOpcodeType opCode,             //!< The opcode
+                                 U32 cmdSeq,                      //!< The command sequence number
+                                 U8 slot,                         //!< The custom slot to load
+                                 const Fw::CmdStringArg& fileName  //!< Path of the pattern file
+                                 ) override;
+
+    //! Handler implementation for command PATTERN_LOOP
+    //!
+    //! Command to set how many times patterns are played before blinking stops
+    void PATTERN_LOOP_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                 U32 cmdSeq,           //!< The command sequence number
+                                 U32 count             //!< Number of times the pattern is played, 0 to loop forever
+                                 ) override;
+
+    //! Handler implementation for command PWM_ON_OFF
+    //!
+    //! Command to turn the PWM brightness mode on or off
+    void PWM_ON_OFF_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                               U32 cmdSeq,           //!< The command sequence number
+                               Fw::On onOff          //!< Indicates whether PWM should be on or off
+                               ) override;
+
+    //! Handler implementation for command EDGE_LOG_FLUSH
+    //!
+    //! Command to write the edges recorded so far to a segment file
+    void EDGE_LOG_FLUSH_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                   U32 cmdSeq            //!< The command sequence number
+                                   ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Copy the parameters into the snapshot read by the tick path
+        void
+        loadParamSnapshot();
+
+    //! State of the PWM carrier, owned by the PWM thread
+    struct PwmCarrier {
+        U64 periodStart = 0;     //! Monotonic deadline of the current period start in nanoseconds
+        bool level = false;      //! Level last driven by the carrier
+        U32 periods = 0;         //! Periods in the statistics window
+        U64 gatedTime = 0;       //! Length of the periods in the window with the carrier gated on
+        U64 commandedOnTime = 0; //! Commanded high time of the gated periods
+        U64 onTime = 0;          //! Measured high time of the gated periods
+        U64 jitterSum = 0;       //! Summed lateness of the edges in the window
+        U32 jitterMax = 0;       //! Largest lateness of an edge in the window
+        U32 edges = 0;           //! Number of edges in the window
+    };
+
+    //! Entry point of the PWM thread
+    static void pwmTask(void* component  //!< The Led component
+    );
+
+    //! Generate one PWM period, or idle while PWM is off, then sleep until the next period
+    void pwmStep(PwmCarrier& carrier  //!< The carrier state
+    );
+
+    //! Drive the GPIO from the PWM thread when the level changes
+    //!
+    //! \return the monotonic time in nanoseconds after the write, or when the level did not change
+    U64 pwmDrive(PwmCarrier& carrier,  //!< The carrier state
+                 bool level,           //!< The level to drive
+                 U64 deadline          //!< Monotonic time at which the edge was due, accounted as edge jitter
+    );
+
+    //! Publish the statistics of the window and start a new one
+    void pwmPublish(PwmCarrier& carrier  //!< The carrier state
+    );
+
+    //! Drive the GPIO from the tick path unless the PWM thread owns it
+    void driveGpio(Fw::On state  //!< The state of the LED
+    );
+
+    //! Compute the statistics of timing samples, reordering them
+    //!
+    //! \return the statistics in microseconds
+    static LedTimingStats timingStats(U32* samples,  //!< Samples in nanoseconds
+                                      U32 count      //!< Number of samples, at least 1
+    );
+
+    //! Send the timing telemetry of the window and start a new one
+    void reportTiming();
+
+    //! Entry point of the edge log thread
+    static void edgeLogTask(void* component  //!< The Led component
+    );
+
+    //! Write the segments handed over by edgeLogRun to segment files and hand them to file downlink. Runs on the edge
+    //! log thread.
+    void writeEdgeSegments();
+
+    //! Flip the LED, driving the GPIO and reporting the edge
+    void toggle(LedEventMode mode  //!< The current event mode
+    );
+
+    //! Add the transitions applied by the ticks to the LedTransitions count, including the ones a batch of ticks
+    //! cancelled out
+    void countTransitions(U64 transitions  //!< Number of transitions
+    );
+
+    //! The table of a pattern, empty for BLINK and for custom slots that were never loaded
+    LedPattern patternOf(LedPatternId pattern  //!< The pattern to look up
+    ) const;
+
+    //! Restart the selected pattern from its first segment
+    void restartPattern();
+
+    //! Report a toggle of the LED according to the event mode
+    void reportToggle(LedEventMode mode  //!< The current event mode
+    );
+
+    //! Account for one tick in the event summary and emit the summary once the period is over
+    void updateSummary(U32 period  //!< The summary period in ticks
+    );
+
+    //! Clear the event summary counters
+    void resetSummary();
+
+    //! Plain copy of the parameters used by the tick path. Only the thread running the ticks reads or writes it.
+    struct ParamSnapshot {
+        U32 blinkInterval = 1;                            //! BLINK_INTERVAL
+        LedEventMode eventMode = LedEventMode::PER_EDGE;  //! EVENT_MODE
+        U32 summaryPeriod = 10;                           //! SUMMARY_PERIOD
+        U32 timingWindow = 10;                            //! TIMING_WINDOW, clamped to 1..LED_TIMING_MAX_SAMPLES
+    };
+
+    ParamSnapshot m_params;              //! Parameter snapshot read by the tick path
+    std::atomic<U32> m_paramGeneration;  //! Bumped whenever parameters are loaded or updated
+    U32 m_snapshotGeneration = 0;        //! Value of m_paramGeneration when m_params was last copied
     Fw::On m_state = Fw::On::OFF;  //! Keeps track if LED is on or off
     U64 m_transitions = 0;         //! The number of on/off transitions that have occurred
                                    //! from FSW boot up
     U32 m_toggleCounter = 0;       //! Keeps track of how many ticks the LED has been on for
     bool m_blinking = false;       //! Flag: if true then LED blinking will occur else
                                    //! no blinking will happen
+    bool m_logNextToggle = false;  //! Flag: if true the next toggle is logged even in SUMMARY event mode
+    U32 m_summaryTicks = 0;        //! Ticks accounted in the current event summary
+    U32 m_summaryToggles = 0;      //! Toggles in the current event summary
+    U32 m_summaryOnTicks = 0;      //! Ticks spent on in the current event summary
+    Fw::Time m_lastToggleTime;     //! Time of the last toggle
+    LedPatternId m_pattern = LedPatternId::BLINK;  //! The pattern played while blinking
+    U32 m_patternRepeats = 0;                      //! Number of times patterns are played, 0 for forever
+    LedPatternPlayer m_player;                     //! Plays m_pattern unless it is BLINK
+    LedPatternStore m_customPatterns[LED_PATTERN_CUSTOM_SLOTS];  //! Patterns loaded from pattern files
+
+    // PWM state shared between the tick path and the PWM thread
+    Os::Task m_pwmTask;                      //! The PWM thread
+    std::atomic<bool> m_pwmRunning;          //! Flag: true while the PWM thread runs
+    std::atomic<bool> m_pwmEnabled;          //! Flag: true when PWM is commanded on
+    Os::Mutex m_gpioLock;                    //! Serializes the tick path writes with the GPIO takeover and handback
+    std::atomic<bool> m_pwmActive;           //! Flag: true while the PWM thread owns the GPIO, set under m_gpioLock
+    std::atomic<bool> m_pwmGate;             //! Flag: true when the carrier is gated on by the blink layer
+    bool m_ledOn = false;                    //! Level of the LED as driven by the tick path, under m_gpioLock
+    std::atomic<U32> m_pwmDuty;              //! PWM_DUTY, clamped to 100
+    std::atomic<U32> m_pwmFrequency;         //! PWM_FREQUENCY, clamped to 1..LED_PWM_MAX_FREQUENCY
+    std::atomic<I32> m_pwmDutyError;         //! Duty error of the last window in hundredths of a percent
+    std::atomic<U32> m_pwmJitterMean;        //! Mean edge lateness of the last window in nanoseconds
+    std::atomic<U32> m_pwmJitterMax;         //! Largest edge lateness of the last window in nanoseconds
+    std::atomic<U32> m_pwmStatsGeneration;   //! Bumped when a statistics window is published
+    U32 m_pwmStatsPublished = 0;             //! Value of m_pwmStatsGeneration last sent as telemetry
+
+    //! Number of segment buffers between edgeLogRun and the edge log thread: one is filled while the other is written
+    static const U32 EDGE_LOG_SEGMENT_BUFFERS = 2;
+
+    //! Serialized edge log segment handed from edgeLogRun to the edge log thread
+    struct EdgeSegment {
+        U8 data[LedEdgeLog::SEGMENT_SIZE];  //! The serialized segment
+        FwSizeType size;                    //! Serialized size of the segment
+        U32 sequence;                       //! Sequence number of the segment
+        U32 records;                        //! Number of edges in the segment
+    };
+
+    // Edge log: the tick path produces, edgeLogRun consumes into segment buffers, the edge log thread writes them
+    LedEdgeLog m_edgeLog;                    //! Ring of the recorded edges
+    U32 m_ticks = 0;                         //! Number of ticks run, recorded with the edges
+    std::atomic<bool> m_edgeLogFlush;        //! Flag: true when a partial segment should be written
+    Fw::String m_edgeLogPrefix;              //! Path prefix of the segment files
+    U32 m_edgeLogSequence = 0;               //! Sequence number of the next segment, used by edgeLogRun only
+    U32 m_edgeLogRecords = 0;                //! Number of edges written to segment files, edge log thread only
+    EdgeSegment m_edgeSegments[EDGE_LOG_SEGMENT_BUFFERS];  //! Segments being handed to the edge log thread
+    std::atomic<U32> m_edgeSegmentsFilled;   //! Segment buffers filled, written by edgeLogRun
+    std::atomic<U32> m_edgeSegmentsWritten;  //! Segment buffers written out, written by the edge log thread
+    Os::Task m_edgeLogTask;                  //! The edge log thread
+    std::atomic<bool> m_edgeLogRunning;      //! Flag: true while the edge log thread runs
+    std::mutex m_edgeLogLock;                //! Guards the wake-up of the edge log thread
+    std::condition_variable m_edgeLogWake;   //! Signalled when segments are handed over or the thread is stopped
+
+    // Timing statistics of the current window, in nanoseconds
+    U32 m_latencySamples[LED_TIMING_MAX_SAMPLES];  //! Delays from the cycle start to the run call
+    U32 m_latencyCount = 0;                        //! Number of latency samples
+    U32 m_periodSamples[LED_TIMING_MAX_SAMPLES];   //! Periods between rising edges
+    U32 m_periodCount = 0;                         //! Number of period samples
+    U64 m_lastRise = 0;                            //! Steady clock time of the last rising edge, 0 before the first
+    U32 m_timingTicks = 0;                         //! Ticks in the current window
+};
+
+//! Led component: ticks and commands are queued and handled on the component thread
+//!
+//! At most one tick message is queued at a time. Ticks arriving while it waits are counted and, according to the
+//! TICK_POLICY parameter, run with it or discarded, so a stalled component thread never fills the queue with ticks.
+class Led : public LedImpl<LedComponentBase> {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct Led object
+    Led(const char* const compName  //!< The component name
+    );
+
+    //! Destroy Led object
+    ~Led();
+
+    PRIVATE :
+        //! Emit parameter updated EVR
+        //!
+        void
+        parameterUpdated(FwPrmIdType id  //!< The parameter ID
+                         ) override;
+
+    //! Read the tick policy once parameters are loaded
+    //!
+    void parametersLoaded() override;
+
+    //! Handler implementation for run
+    //!
+    //! Counts the tick on the rate group thread and queues a tick message unless one is already pending
+    void run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
+    //! Handler implementation for the tick internal port
+    //!
+    //! Runs the pending ticks on the component thread
+    void tick_internalInterfaceHandler() override;
+
+    //! Overflow hook for the tick internal port
+    //!
+    //! Accounts for a tick message dropped because the queue was full of commands
+    void tick_internalInterfaceOverflowHook() override;
+
+    //! Record the latency samples queued by run
+    void drainLatency();
+
+    //! Latency samples queued by run, for the ticks run or dropped since. Beyond it the samples are not recorded.
+    static const U32 LATENCY_QUEUE_SIZE = 64;
+
+    U32 m_latencyQueue[LATENCY_QUEUE_SIZE];  //! Latency samples taken by run, in nanoseconds
+    std::atomic<U32> m_latencyHead;          //! Number of samples queued, written by run
+    std::atomic<U32> m_latencyTail;          //! Number of samples recorded, written by the component thread
+    std::atomic<U32> m_pendingTicks;    //! Ticks counted since the tick message was queued, 0 when none is queued
+    std::atomic<bool> m_coalesceTicks;  //! TICK_POLICY is COALESCE
+    std::atomic<U32> m_droppedTicks;    //! Number of ticks discarded
+    U32 m_coalescedTicks = 0;           //! Number of ticks run together with a previous one
+    U32 m_droppedReported = 0;          //! Value of m_droppedTicks last sent as telemetry
+    U32 m_coalescedReported = 0;        //! Value of m_coalescedTicks last sent as telemetry
 };
 
 }  // namespace Components
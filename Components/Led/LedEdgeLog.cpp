@@ -0,0 +1,88 @@
+// ======================================================================
+// \title  LedEdgeLog.cpp
+// \author ortega
+// \brief  cpp file for the ring buffer recording the GPIO edges of the Led component
+// ======================================================================
+
+#include "Components/Led/LedEdgeLog.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/Serializable.hpp"
+
+namespace Components {
+
+const U32 LedEdgeLog::SEGMENT_RECORDS;
+const U32 LedEdgeLog::CAPACITY;
+const U32 LedEdgeLog::SEGMENT_SIZE;
+const U32 LedEdgeLog::EDGE_LOG_MAGIC;
+const U8 LedEdgeLog::EDGE_LOG_VERSION;
+
+// Head and tail are free-running counters: their difference is the fill level, and the capacity being a power of two
+// keeps the ring index consistent when they wrap
+static_assert((LedEdgeLog::CAPACITY & (LedEdgeLog::CAPACITY - 1)) == 0, "Edge log capacity must be a power of two");
+
+LedEdgeLog ::LedEdgeLog() : m_head(0), m_tail(0), m_dropped(0) {}
+
+bool LedEdgeLog ::push(const Record& record) {
+    const U32 head = this->m_head.load(std::memory_order_relaxed);
+    if ((head - this->m_tail.load(std::memory_order_acquire)) >= CAPACITY) {
+        this->m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    this->m_records[head % CAPACITY] = record;
+    this->m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+U32 LedEdgeLog ::available() const {
+    return this->m_head.load(std::memory_order_acquire) - this->m_tail.load(std::memory_order_relaxed);
+}
+
+U32 LedEdgeLog ::takeSegment(U32 sequence, U8* buffer, FwSizeType& size) {
+    FW_ASSERT(buffer != nullptr);
+    const U32 tail = this->m_tail.load(std::memory_order_relaxed);
+    const U32 records = FW_MIN(this->available(), SEGMENT_RECORDS);
+
+    Fw::ExternalSerializeBuffer segment(buffer, SEGMENT_SIZE);
+    Fw::SerializeStatus status = segment.serialize(EDGE_LOG_MAGIC);
+    status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(EDGE_LOG_VERSION) : status;
+    status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(sequence) : status;
+    status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(static_cast<U16>(records)) : status;
+    status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(this->dropped()) : status;
+    for (U32 i = 0; (i < records) && (status == Fw::FW_SERIALIZE_OK); i++) {
+        const Record& record = this->m_records[(tail + i) % CAPACITY];
+        status = segment.serialize(record.seconds);
+        status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(record.useconds) : status;
+        status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(record.tick) : status;
+        status = (status == Fw::FW_SERIALIZE_OK) ? segment.serialize(record.state) : status;
+    }
+    // The buffer is sized for a full segment
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    size = segment.getBuffLength();
+
+    // The records are copied out, so the producer may reuse their slots
+    this->m_tail.store(tail + records, std::memory_order_release);
+    return records;
+}
+
+Os::File::Status LedEdgeLog ::writeFile(const char* fileName, const U8* buffer, FwSizeType size) {
+    FW_ASSERT(fileName != nullptr);
+    FW_ASSERT(buffer != nullptr);
+    Os::File file;
+    Os::File::Status status = file.open(fileName, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE);
+    if (status != Os::File::OP_OK) {
+        return status;
+    }
+    FwSignedSizeType written = static_cast<FwSignedSizeType>(size);
+    status = file.write(buffer, written, Os::File::WaitType::WAIT);
+    file.close();
+    if ((status == Os::File::OP_OK) && (written != static_cast<FwSignedSizeType>(size))) {
+        status = Os::File::NO_SPACE;
+    }
+    return status;
+}
+
+U32 LedEdgeLog ::dropped() const {
+    return this->m_dropped.load(std::memory_order_relaxed);
+}
+
+}  // namespace Components
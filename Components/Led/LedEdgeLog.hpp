@@ -0,0 +1,100 @@
+// ======================================================================
+// \title  LedEdgeLog.hpp
+// \author ortega
+// \brief  hpp file for the ring buffer recording the GPIO edges of the Led component
+// ======================================================================
+
+#ifndef Components_LedEdgeLog_HPP
+#define Components_LedEdgeLog_HPP
+
+#include <atomic>
+
+#include "FpConfig.hpp"
+#include "Os/File.hpp"
+
+namespace Components {
+
+//! Lock-free single producer, single consumer ring of LED edges written out in fixed-size segment files
+//!
+//! The tick path pushes one record per edge. The consumer serializes the records into a segment buffer once a full
+//! segment is available, and the buffer is written to a segment file off the consumer's thread. Edges pushed while
+//! the ring is full are dropped and counted.
+//!
+//! Segment files are big-endian: a header holding the magic (EDGE_LOG_MAGIC), the format version (U8), the segment
+//! sequence number (U32), the number of records (U16) and the number of edges dropped since boot (U32), followed by
+//! the records. A record holds the time of the edge in seconds and microseconds (U32, U32), the index of the tick
+//! that drove it (U32) and the new state, 1 for on and 0 for off (U8).
+class LedEdgeLog {
+  public:
+    //! Number of records in a segment file
+    static const U32 SEGMENT_RECORDS = 256;
+
+    //! Number of segments the ring can hold
+    static const U32 SEGMENTS = 4;
+
+    //! Capacity of the ring in records
+    static const U32 CAPACITY = SEGMENT_RECORDS * SEGMENTS;
+
+    //! Magic number opening every segment file ("LEDE")
+    static const U32 EDGE_LOG_MAGIC = 0x4C454445;
+
+    //! Version of the segment file format
+    static const U8 EDGE_LOG_VERSION = 1;
+
+    //! Serialized size of the segment header
+    static const U32 HEADER_SIZE = sizeof(U32) + sizeof(U8) + sizeof(U32) + sizeof(U16) + sizeof(U32);
+
+    //! Serialized size of a record
+    static const U32 RECORD_SIZE = 3 * sizeof(U32) + sizeof(U8);
+
+    //! Serialized size of a full segment
+    static const U32 SEGMENT_SIZE = HEADER_SIZE + SEGMENT_RECORDS * RECORD_SIZE;
+
+    //! One LED edge
+    struct Record {
+        U32 seconds;   //! Time of the edge, seconds part
+        U32 useconds;  //! Time of the edge, microseconds part
+        U32 tick;      //! Index of the tick that drove the edge
+        U8 state;      //! New state of the LED, 1 for on
+    };
+
+    LedEdgeLog();
+
+    //! Record an edge. Producer side only.
+    //!
+    //! \return false when the ring is full and the edge was dropped
+    bool push(const Record& record  //!< The edge
+    );
+
+    //! \return the number of records waiting to be written. Consumer side only.
+    U32 available() const;
+
+    //! Serialize up to one segment of records and release them from the ring. Consumer side only.
+    //!
+    //! \return the number of records serialized
+    U32 takeSegment(U32 sequence,    //!< Sequence number of the segment
+                    U8* buffer,      //!< Receives the segment, SEGMENT_SIZE bytes
+                    FwSizeType& size  //!< Set to the serialized size of the segment
+    );
+
+    //! Write a serialized segment to a segment file
+    //!
+    //! \return OP_OK when the whole segment was written
+    static Os::File::Status writeFile(const char* fileName,  //!< Path of the segment file
+                                      const U8* buffer,      //!< The serialized segment
+                                      FwSizeType size        //!< Size of the serialized segment
+    );
+
+    //! \return the number of edges dropped since construction
+    U32 dropped() const;
+
+  private:
+    Record m_records[CAPACITY];                        //! Ring storage
+    alignas(64) std::atomic<U32> m_head;               //! Records pushed, written by the producer
+    alignas(64) std::atomic<U32> m_tail;               //! Records released, written by the consumer
+    std::atomic<U32> m_dropped;                        //! Edges dropped because the ring was full
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,161 @@
+// ======================================================================
+// \title  LedPattern.cpp
+// \author ortega
+// \brief  cpp file for the run-length blink patterns played by the Led component
+// ======================================================================
+
+#include "Components/Led/LedPattern.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Os/File.hpp"
+
+namespace Components {
+
+namespace {
+// Built-in patterns. Durations are in rate group ticks and alternate on/off starting with on.
+
+//! Two short beats then a pause
+const U16 HEARTBEAT_SEGMENTS[] = {1, 1, 1, 7};
+
+//! Morse "SOS": dot = 1 tick on, dash = 3 ticks on, 1 tick between symbols, 3 between letters, 7 between words
+const U16 SOS_SEGMENTS[] = {1, 1, 1, 1, 1, 3, 3, 1, 3, 1, 3, 3, 1, 1, 1, 1, 1, 7};
+
+//! Fault code 3: three short blinks then a long pause
+const U16 FAULT_SEGMENTS[] = {1, 1, 1, 1, 1, 5};
+
+//! Serialized size of the pattern file header: magic and segment count
+const U32 HEADER_SIZE = sizeof(U32) + sizeof(U16);
+}  // namespace
+
+// ----------------------------------------------------------------------
+// LedPattern
+// ----------------------------------------------------------------------
+
+LedPattern LedPattern ::builtin(LedPatternId id) {
+    LedPattern pattern;
+    switch (id.e) {
+        case LedPatternId::HEARTBEAT:
+            pattern.segments = HEARTBEAT_SEGMENTS;
+            pattern.count = FW_NUM_ARRAY_ELEMENTS(HEARTBEAT_SEGMENTS);
+            break;
+        case LedPatternId::SOS:
+            pattern.segments = SOS_SEGMENTS;
+            pattern.count = FW_NUM_ARRAY_ELEMENTS(SOS_SEGMENTS);
+            break;
+        case LedPatternId::FAULT:
+            pattern.segments = FAULT_SEGMENTS;
+            pattern.count = FW_NUM_ARRAY_ELEMENTS(FAULT_SEGMENTS);
+            break;
+        default:
+            break;
+    }
+    return pattern;
+}
+
+// ----------------------------------------------------------------------
+// LedPatternStore
+// ----------------------------------------------------------------------
+
+LedPatternStatus LedPatternStore ::load(const char* fileName) {
+    FW_ASSERT(fileName != nullptr);
+    // Read one byte past the largest valid pattern to detect oversized files
+    U8 data[HEADER_SIZE + MAX_SEGMENTS * sizeof(U16) + 1];
+
+    Os::File file;
+    if (file.open(fileName, Os::File::OPEN_READ) != Os::File::OP_OK) {
+        return LedPatternStatus::FILE_ERROR;
+    }
+    FwSignedSizeType size = static_cast<FwSignedSizeType>(sizeof(data));
+    const Os::File::Status status = file.read(data, size, Os::File::WaitType::WAIT);
+    file.close();
+    if (status != Os::File::OP_OK) {
+        return LedPatternStatus::FILE_ERROR;
+    }
+    return this->load(data, static_cast<U32>(size));
+}
+
+LedPatternStatus LedPatternStore ::load(const U8* data, U32 size) {
+    FW_ASSERT(data != nullptr);
+    if (size < HEADER_SIZE) {
+        return LedPatternStatus::BAD_HEADER;
+    }
+    Fw::ExternalSerializeBuffer buffer(const_cast<U8*>(data), size);
+    Fw::SerializeStatus status = buffer.setBuffLen(size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+
+    U32 magic = 0;
+    U16 count = 0;
+    (void)buffer.deserialize(magic);
+    (void)buffer.deserialize(count);
+    if ((magic != LED_PATTERN_MAGIC) || (count == 0) || (count > MAX_SEGMENTS)) {
+        return LedPatternStatus::BAD_HEADER;
+    }
+    if (size != HEADER_SIZE + count * sizeof(U16)) {
+        return LedPatternStatus::BAD_LENGTH;
+    }
+
+    // Validate every segment before replacing the stored pattern
+    U16 segments[MAX_SEGMENTS];
+    for (U32 i = 0; i < count; i++) {
+        status = buffer.deserialize(segments[i]);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        if (segments[i] == 0) {
+            return LedPatternStatus::BAD_SEGMENT;
+        }
+    }
+    for (U32 i = 0; i < count; i++) {
+        this->m_segments[i] = segments[i];
+    }
+    this->m_count = count;
+    return LedPatternStatus::OK;
+}
+
+LedPattern LedPatternStore ::pattern() const {
+    LedPattern pattern;
+    pattern.segments = this->m_segments;
+    pattern.count = this->m_count;
+    return pattern;
+}
+
+// ----------------------------------------------------------------------
+// LedPatternPlayer
+// ----------------------------------------------------------------------
+
+void LedPatternPlayer ::start(const LedPattern& pattern, U32 repeats) {
+    this->m_pattern = pattern;
+    this->m_segment = 0;
+    this->m_remaining = (pattern.count > 0) ? pattern.segments[0] : 0;
+    this->m_repeats = repeats;
+    this->m_played = 0;
+    this->m_done = (pattern.count == 0);
+}
+
+void LedPatternPlayer ::stop() {
+    this->m_done = true;
+}
+
+bool LedPatternPlayer ::tick() {
+    if (this->m_done) {
+        return false;
+    }
+    if (this->m_remaining == 0) {
+        this->m_segment++;
+        if (this->m_segment >= this->m_pattern.count) {
+            this->m_played++;
+            if ((this->m_repeats != 0) && (this->m_played >= this->m_repeats)) {
+                this->m_done = true;
+                return false;
+            }
+            this->m_segment = 0;
+        }
+        this->m_remaining = this->m_pattern.segments[this->m_segment];
+    }
+    this->m_remaining--;
+    return (this->m_segment % 2) == 0;
+}
+
+bool LedPatternPlayer ::isDone() const {
+    return this->m_done;
+}
+
+}  // namespace Components
@@ -0,0 +1,94 @@
+// ======================================================================
+// \title  LedPattern.hpp
+// \author ortega
+// \brief  hpp file for the run-length blink patterns played by the Led component
+// ======================================================================
+
+#ifndef Components_LedPattern_HPP
+#define Components_LedPattern_HPP
+
+#include "Components/Led/LedPatternIdEnumAc.hpp"
+#include "Components/Led/LedPatternStatusEnumAc.hpp"
+#include "FpConfig.hpp"
+
+namespace Components {
+
+//! A blink pattern: durations in ticks of alternating segments, starting with the LED on
+//!
+//! Segment N is an on segment when N is even and an off segment when N is odd. Every duration is non-zero, so a
+//! player advances by at most one segment per tick.
+struct LedPattern {
+    const U16* segments = nullptr;  //! Segment durations in ticks
+    U32 count = 0;                  //! Number of segments, 0 for an empty pattern
+
+    //! The compile-time table of a built-in pattern
+    //!
+    //! \return the pattern, empty for BLINK and the custom slots which are not built in
+    static LedPattern builtin(LedPatternId id  //!< The pattern to look up
+    );
+};
+
+//! Storage for a pattern loaded from a binary pattern file
+//!
+//! Pattern files are big-endian: a U32 magic (LED_PATTERN_MAGIC), a U16 segment count and that many U16 segment
+//! durations in ticks. The file must not hold any further bytes.
+class LedPatternStore {
+  public:
+    //! Maximum number of segments of a loaded pattern
+    static const U32 MAX_SEGMENTS = 64;
+
+    //! Magic number opening every pattern file ("LEDP")
+    static const U32 LED_PATTERN_MAGIC = 0x4C454450;
+
+    //! Load the pattern held in a file, keeping the previous pattern on error
+    //!
+    //! \return OK on success, the reason the file was rejected otherwise
+    LedPatternStatus load(const char* fileName  //!< Path of the pattern file
+    );
+
+    //! Load a pattern from the serialized contents of a pattern file
+    //!
+    //! \return OK on success, the reason the data was rejected otherwise
+    LedPatternStatus load(const U8* data,  //!< Serialized pattern
+                          U32 size         //!< Size of the serialized pattern in bytes
+    );
+
+    //! The pattern held by the store, empty until a pattern is loaded
+    LedPattern pattern() const;
+
+  private:
+    U16 m_segments[MAX_SEGMENTS];  //! Segment durations in ticks
+    U32 m_count = 0;               //! Number of segments loaded
+};
+
+//! Plays a pattern one tick at a time in constant time per tick
+class LedPatternPlayer {
+  public:
+    //! Start playing a pattern from its first segment
+    void start(const LedPattern& pattern,  //!< The pattern to play, which must outlive the playback
+               U32 repeats                 //!< Number of times the pattern is played, 0 to loop forever
+    );
+
+    //! Stop playing, leaving the LED off
+    void stop();
+
+    //! Advance playback by one tick
+    //!
+    //! \return true when the LED is on during this tick
+    bool tick();
+
+    //! \return true once every repeat of the pattern has been played
+    bool isDone() const;
+
+  private:
+    LedPattern m_pattern;  //! The pattern being played
+    U32 m_segment = 0;     //! Index of the current segment
+    U32 m_remaining = 0;   //! Ticks left in the current segment
+    U32 m_repeats = 0;     //! Number of times to play the pattern, 0 for forever
+    U32 m_played = 0;      //! Number of times the pattern has been played completely
+    bool m_done = true;    //! Flag: true when no pattern is playing
+};
+
+}  // namespace Components
+
+#endif
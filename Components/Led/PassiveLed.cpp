@@ -0,0 +1,36 @@
+// ======================================================================
+// \title  PassiveLed.cpp
+// \author ortega
+// \brief  cpp file for PassiveLed component implementation class
+// ======================================================================
+
+#include "Components/Led/PassiveLed.hpp"
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+PassiveLed ::PassiveLed(const char* const compName) : LedImpl<PassiveLedComponentBase>(compName) {}
+
+PassiveLed ::~PassiveLed() {}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void PassiveLed ::PATTERN_LOAD_cmdHandler(FwOpcodeType opCode,
+                                          U32 cmdSeq,
+                                          U8 slot,
+                                          const Fw::CmdStringArg& fileName) {
+    // The file read may block on the filesystem: keep it outside the lock so the rate group ticks are not held up
+    LedPatternStore store;
+    const LedPatternStatus status =
+        (slot < LED_PATTERN_CUSTOM_SLOTS) ? store.load(fileName.toChar()) : LedPatternStatus::OK;
+    this->lock();
+    this->installPattern(opCode, cmdSeq, slot, store, status);
+    this->unLock();
+}
+
+}  // namespace Components
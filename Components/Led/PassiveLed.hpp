@@ -0,0 +1,48 @@
+// ======================================================================
+// \title  PassiveLed.hpp
+// \author ortega
+// \brief  hpp file for PassiveLed component implementation class
+// ======================================================================
+
+#ifndef Components_PassiveLed_HPP
+#define Components_PassiveLed_HPP
+
+#include "Components/Led/Led.hpp"
+#include "Components/Led/PassiveLedComponentAc.hpp"
+
+namespace Components {
+
+//! PassiveLed component: ticks run on the rate group thread and commands on the command dispatcher thread, both
+//! under the component lock. The implementation is shared with Led.
+class PassiveLed : public LedImpl<PassiveLedComponentBase> {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct PassiveLed object
+    PassiveLed(const char* const compName  //!< The component name
+    );
+
+    //! Destroy PassiveLed object
+    ~PassiveLed();
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Handler implementations for commands
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for command PATTERN_LOAD
+        //!
+        //! Reads the pattern file without the component lock, then installs the pattern under it
+        void
+        PATTERN_LOAD_cmdHandler(FwOpcodeType opCode,             //!< The opcode
+                                U32 cmdSeq,                      //!< The command sequence number
+                                U8 slot,                         //!< The custom slot to load
+                                const Fw::CmdStringArg& fileName  //!< Path of the pattern file
+                                ) override;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,207 @@
+// ======================================================================
+// \title  LedBenchTester.cpp
+// \author ortega
+// \brief  cpp file for the Led component benchmark harness
+// ======================================================================
+
+#include "LedBenchTester.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+LedBenchTester ::LedBenchTester(bool threaded)
+    : LedGTestBase("LedBenchTester", LedBenchTester::MAX_HISTORY_SIZE),
+      component("Led"),
+      m_threaded(threaded),
+      m_gpioWrites(0),
+      m_paramSink(0) {
+    this->initComponents();
+    this->connectPorts(threaded);
+    this->component.loadParameters();
+
+    // Blink on every tick so each tick toggles, logs and writes the GPIO
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    this->clearHistory();
+}
+
+LedBenchTester ::~LedBenchTester() {}
+
+// ----------------------------------------------------------------------
+// Benchmarks
+// ----------------------------------------------------------------------
+
+LedBenchTester::Result LedBenchTester ::benchTickDirect(U64 operations) {
+    return this->measure("tick_direct", operations, [this](U64) { this->component.advance(1); });
+}
+
+LedBenchTester::Result LedBenchTester ::benchTickQueued(U64 operations) {
+    return this->measure("tick_queued", operations, [this](U64) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    });
+}
+
+LedBenchTester::Result LedBenchTester ::benchTickEnqueue(U64 operations) {
+    // The queue holds TEST_INSTANCE_QUEUE_DEPTH messages: each timed enqueue is drained before the next one
+    Result result = {"tick_enqueue", 0, 0.0, 0.0};
+    U64 elapsed = 0;
+    U64 allocations = 0;
+    for (U64 done = 0; done < operations; done++) {
+        const U64 allocationsBefore = allocationCount();
+        const auto start = std::chrono::steady_clock::now();
+        this->invoke_to_run(0, 0);
+        const auto stop = std::chrono::steady_clock::now();
+        allocations += allocationCount() - allocationsBefore;
+        elapsed += static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        this->component.doDispatch();
+        if ((done % BATCH_SIZE) == (BATCH_SIZE - 1)) {
+            this->clearHistory();
+        }
+    }
+    result.operations = operations;
+    result.nsPerOp = static_cast<F64>(elapsed) / static_cast<F64>(operations);
+    result.allocsPerOp = static_cast<F64>(allocations) / static_cast<F64>(operations);
+    return result;
+}
+
+LedBenchTester::Result LedBenchTester ::benchCommand(U64 operations) {
+    return this->measure("command", operations, [this](U64 i) {
+        this->sendCmd_BLINKING_ON_OFF(0, static_cast<U32>(i), Fw::On::ON);
+        this->component.doDispatch();
+    });
+}
+
+LedBenchTester::Result LedBenchTester ::benchParamUpdate(U64 operations) {
+    return this->measure("param_update", operations, [this](U64 i) {
+        this->paramSet_BLINK_INTERVAL(1 + static_cast<U32>(i % 4), Fw::ParamValid::VALID);
+        this->paramSend_BLINK_INTERVAL(0, 0);
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    });
+}
+
+LedBenchTester::Result LedBenchTester ::benchParamGet(U64 operations) {
+    return this->measure("param_get", operations, [this](U64) {
+        Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+        this->m_paramSink = this->m_paramSink + this->component.paramGet_BLINK_INTERVAL(isValid);
+        this->m_paramSink = this->m_paramSink + static_cast<U32>(this->component.paramGet_EVENT_MODE(isValid).e);
+        this->m_paramSink = this->m_paramSink + this->component.paramGet_SUMMARY_PERIOD(isValid);
+    });
+}
+
+LedBenchTester::Result LedBenchTester ::benchParamSnapshot(U64 operations) {
+    this->component.advance(1);  // Take the initial snapshot
+    return this->measure("param_snapshot", operations, [this](U64) {
+        if (this->component.m_paramGeneration.load(std::memory_order_acquire) !=
+            this->component.m_snapshotGeneration) {
+            this->component.loadParamSnapshot();
+        }
+        this->m_paramSink = this->m_paramSink + this->component.m_params.blinkInterval;
+        this->m_paramSink = this->m_paramSink + static_cast<U32>(this->component.m_params.eventMode.e);
+        this->m_paramSink = this->m_paramSink + this->component.m_params.summaryPeriod;
+    });
+}
+
+LedBenchTester::Result LedBenchTester ::benchTickThreaded(U64 operations, U32& threads) {
+    FW_ASSERT(this->m_threaded);
+    this->component.start();
+    threads = threadCount();
+    const Result result = this->measure("tick_threaded", operations, [this](U64) {
+        const U32 writes = this->m_gpioWrites.load(std::memory_order_acquire);
+        this->invoke_to_run(0, 0);
+        // Yield rather than spin so the component thread also gets to run on a single core
+        while (this->m_gpioWrites.load(std::memory_order_acquire) == writes) {
+            std::this_thread::yield();
+        }
+    });
+    this->component.exit();
+    (void)this->component.join();
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+U64 LedBenchTester ::from_cycleStart_handler(const NATIVE_INT_TYPE portNum, U32& cycle) {
+    cycle = 0;
+    return 0;
+}
+
+Drv::GpioStatus LedBenchTester ::from_gpioSet_handler(const NATIVE_INT_TYPE portNum, const Fw::Logic& state) {
+    this->m_gpioWrites.fetch_add(1, std::memory_order_release);
+    return Drv::GpioStatus::OP_OK;
+}
+
+Svc::SendFileResponse LedBenchTester ::from_sendFile_handler(const NATIVE_INT_TYPE portNum,
+                                                            const Fw::StringBase& sourceFileName,
+                                                            const Fw::StringBase& destFileName,
+                                                            U32 offset,
+                                                            U32 length) {
+    return Svc::SendFileResponse(Svc::SendFileStatus::STATUS_OK, 0);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void LedBenchTester ::connectPorts(bool threaded) {
+    // Input ports of the component
+    this->connect_to_cmdIn(0, this->component.get_cmdIn_InputPort(0));
+    this->connect_to_run(0, this->component.get_run_InputPort(0));
+    this->connect_to_edgeLogRun(0, this->component.get_edgeLogRun_InputPort(0));
+
+    // Output ports of the component
+    this->component.set_cmdRegOut_OutputPort(0, this->get_from_cmdRegOut(0));
+    this->component.set_cmdResponseOut_OutputPort(0, this->get_from_cmdResponseOut(0));
+    this->component.set_prmGetOut_OutputPort(0, this->get_from_prmGetOut(0));
+    this->component.set_prmSetOut_OutputPort(0, this->get_from_prmSetOut(0));
+    this->component.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
+    this->component.set_cycleStart_OutputPort(0, this->get_from_cycleStart(0));
+    this->component.set_gpioSet_OutputPort(0, this->get_from_gpioSet(0));
+    this->component.set_sendFile_OutputPort(0, this->get_from_sendFile(0));
+    if (!threaded) {
+        this->component.set_logOut_OutputPort(0, this->get_from_logOut(0));
+#if FW_ENABLE_TEXT_LOGGING == 1
+        this->component.set_logTextOut_OutputPort(0, this->get_from_logTextOut(0));
+#endif
+        this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+    }
+}
+
+void LedBenchTester ::initComponents() {
+    this->init();
+    this->component.init(LedBenchTester::TEST_INSTANCE_QUEUE_DEPTH, LedBenchTester::TEST_INSTANCE_ID);
+}
+
+template <typename Operation>
+LedBenchTester::Result LedBenchTester ::measure(const char* name, U64 operations, Operation operation) {
+    Result result = {name, 0, 0.0, 0.0};
+    U64 elapsed = 0;
+    U64 allocations = 0;
+    for (U64 done = 0; done < operations; done += BATCH_SIZE) {
+        const U64 batch = FW_MIN(static_cast<U64>(BATCH_SIZE), operations - done);
+        const U64 allocationsBefore = allocationCount();
+        const auto start = std::chrono::steady_clock::now();
+        for (U64 i = 0; i < batch; i++) {
+            operation(done + i);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        allocations += allocationCount() - allocationsBefore;
+        elapsed += static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        this->clearHistory();
+    }
+    result.operations = operations;
+    result.nsPerOp = static_cast<F64>(elapsed) / static_cast<F64>(operations);
+    result.allocsPerOp = static_cast<F64>(allocations) / static_cast<F64>(operations);
+    return result;
+}
+
+}  // namespace Components
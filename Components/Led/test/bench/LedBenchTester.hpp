@@ -0,0 +1,160 @@
+// ======================================================================
+// \title  LedBenchTester.hpp
+// \author ortega
+// \brief  hpp file for the Led component benchmark harness
+// ======================================================================
+
+#ifndef Components_LedBenchTester_HPP
+#define Components_LedBenchTester_HPP
+
+#include "Components/Led/Led.hpp"
+#include "Components/Led/LedGTestBase.hpp"
+
+#include <atomic>
+
+namespace Components {
+
+//! Number of heap allocations since the start of the benchmark executable
+U64 allocationCount();
+
+//! Number of threads of the benchmark process, 0 when it cannot be read
+U32 threadCount();
+
+//! Harness driving the Led component through its ports millions of times
+//!
+//! Histories are cleared between batches of operations, outside of the timed regions, so they never fill up.
+class LedBenchTester : public LedGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Number of operations timed between two history clears
+    static const U32 BATCH_SIZE = 100;
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 4 * BATCH_SIZE;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+    //! Result of one benchmark
+    struct Result {
+        const char* name;  //!< Name of the benchmark
+        U64 operations;    //!< Number of operations timed
+        F64 nsPerOp;       //!< Mean time of an operation in nanoseconds
+        F64 allocsPerOp;   //!< Mean number of heap allocations per operation
+    };
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object LedBenchTester
+    //!
+    //! A threaded harness leaves the event and telemetry ports unconnected: their histories are not thread-safe
+    explicit LedBenchTester(bool threaded = false  //!< Whether the component thread will be started
+    );
+
+    //! Destroy object LedBenchTester
+    ~LedBenchTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Benchmarks
+    // ----------------------------------------------------------------------
+
+    //! Run a tick directly, without the queue
+    Result benchTickDirect(U64 operations);
+
+    //! Tick through invoke_to_run and doDispatch of the tick message
+    Result benchTickQueued(U64 operations);
+
+    //! Count a tick and enqueue the tick message through invoke_to_run, the dispatch is not timed
+    Result benchTickEnqueue(U64 operations);
+
+    //! Send BLINKING_ON_OFF through the command port and dispatch it
+    Result benchCommand(U64 operations);
+
+    //! Update BLINK_INTERVAL and run the tick that reloads the parameter snapshot
+    Result benchParamUpdate(U64 operations);
+
+    //! Read the parameters of a tick through paramGet, taking the parameter lock for each, as the tick path once did
+    Result benchParamGet(U64 operations);
+
+    //! Read the parameters of a tick from the snapshot, after checking its generation, as the tick path does
+    Result benchParamSnapshot(U64 operations);
+
+    //! Tick through invoke_to_run with the component thread started, timed until the GPIO write is seen by the
+    //! caller. This is the latency a rate group tick incurs before the LED changes. Requires a threaded harness.
+    Result benchTickThreaded(U64 operations,
+                             U32& threads  //!< Set to the number of threads of the process while the component runs
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_cycleStart
+    //!
+    U64 from_cycleStart_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                U32& cycle                      //!< Set to the index of the current cycle
+    );
+
+    //! Handler for from_gpioSet
+    //!
+    Drv::GpioStatus from_gpioSet_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                         const Fw::Logic& state          //!< The GPIO state
+    );
+
+    //! Handler for from_sendFile
+    //!
+    Svc::SendFileResponse from_sendFile_handler(const NATIVE_INT_TYPE portNum,        //!< The port number
+                                                const Fw::StringBase& sourceFileName,  //!< Path of file to downlink
+                                                const Fw::StringBase& destFileName,  //!< Path to store at destination
+                                                U32 offset,                          //!< Offset in the file
+                                                U32 length                           //!< Amount of data to downlink
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts(bool threaded  //!< Whether to leave the event and telemetry ports unconnected
+    );
+
+    //! Initialize components
+    void initComponents();
+
+    //! Time an operation in batches of BATCH_SIZE, clearing the histories between batches
+    template <typename Operation>
+    Result measure(const char* name, U64 operations, Operation operation);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    Led component;
+
+    //! Whether the harness was built for benchTickThreaded
+    const bool m_threaded;
+
+    //! Number of GPIO writes, incremented by the component thread in the threaded benchmark
+    std::atomic<U32> m_gpioWrites;
+
+    //! Sum of the parameters read by the parameter benchmarks, so the reads are not optimized away
+    volatile U32 m_paramSink;
+};
+
+}  // namespace Components
+
+#endif
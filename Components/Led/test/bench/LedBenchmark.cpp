@@ -0,0 +1,178 @@
+// ======================================================================
+// \title  LedBenchmark.cpp
+// \author ortega
+// \brief  cpp file for the Led component benchmark main function
+//
+// Usage: Components_Led_bench <results.json> [operations]
+//
+// Runs every benchmark the given number of times (default 1000000), prints the results and writes them as JSON to the
+// given path so releases can be compared. The active Led and the PassiveLed variants are compared on the tick latency
+// and on the number of threads they need. It is a standalone executable: ctest does not run it.
+// ======================================================================
+
+#include "LedBenchTester.hpp"
+#include "PassiveLedBenchTester.hpp"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace {
+std::atomic<U64> allocations(0);
+}
+
+// Every heap allocation of the executable is counted
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = std::malloc((size == 0) ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace Components {
+U64 allocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+U32 threadCount() {
+    FILE* status = std::fopen("/proc/self/status", "r");
+    if (status == nullptr) {
+        return 0;
+    }
+    U32 threads = 0;
+    char line[128];
+    while (std::fgets(line, sizeof(line), status) != nullptr) {
+        if (std::strncmp(line, "Threads:", 8) == 0) {
+            threads = static_cast<U32>(std::strtoul(line + 8, nullptr, 10));
+            break;
+        }
+    }
+    (void)std::fclose(status);
+    return threads;
+}
+}  // namespace Components
+
+namespace {
+//! Mean time of the benchmark with the given name. Every benchmark looked up by main is run, so it is always found.
+F64 nsPerOp(const std::vector<Components::LedBenchTester::Result>& results, const char* name) {
+    for (const Components::LedBenchTester::Result& result : results) {
+        if (std::strcmp(result.name, name) == 0) {
+            return result.nsPerOp;
+        }
+    }
+    FW_ASSERT(0);
+    return 0.0;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    if ((argc < 2) || (argc > 3)) {
+        (void)std::fprintf(stderr, "Usage: %s <results.json> [operations]\n", argv[0]);
+        return 1;
+    }
+    const char* const jsonPath = argv[1];
+    const U64 operations = (argc == 3) ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    if (operations == 0) {
+        (void)std::fprintf(stderr, "The operation count must be a positive integer\n");
+        return 1;
+    }
+
+    // A fresh component per benchmark keeps their state independent
+    std::vector<Components::LedBenchTester::Result> results;
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchTickDirect(operations));
+    }
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchTickQueued(operations));
+    }
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchTickEnqueue(operations));
+    }
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchCommand(operations));
+    }
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchParamUpdate(operations));
+    }
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchParamGet(operations));
+    }
+    {
+        Components::LedBenchTester tester;
+        results.push_back(tester.benchParamSnapshot(operations));
+    }
+    U32 activeThreads = 0;
+    {
+        Components::LedBenchTester tester(true);
+        results.push_back(tester.benchTickThreaded(operations, activeThreads));
+    }
+    U32 passiveThreads = 0;
+    {
+        Components::PassiveLedBenchTester tester;
+        results.push_back(tester.benchTick(operations, passiveThreads));
+    }
+    {
+        Components::PassiveLedBenchTester tester;
+        results.push_back(tester.benchCommand(operations));
+    }
+    // Serializing the tick, queueing it and handing it to the dispatcher on top of the handler itself
+    const F64 queueOverhead = nsPerOp(results, "tick_queued") - nsPerOp(results, "tick_direct");
+    // Time the parameter snapshot saves each tick over reading the parameters through paramGet
+    const F64 snapshotSaving = nsPerOp(results, "param_get") - nsPerOp(results, "param_snapshot");
+
+    FILE* json = std::fopen(jsonPath, "w");
+    if (json == nullptr) {
+        (void)std::fprintf(stderr, "Cannot open %s\n", jsonPath);
+        return 1;
+    }
+    (void)std::fprintf(json, "{\n  \"component\": \"Led\",\n  \"operations\": %llu,\n  \"results\": [\n",
+                       static_cast<unsigned long long>(operations));
+    for (size_t i = 0; i < results.size(); i++) {
+        const Components::LedBenchTester::Result& result = results[i];
+        (void)std::printf("%-16s %10.1f ns/op %8.3f allocs/op\n", result.name, result.nsPerOp, result.allocsPerOp);
+        (void)std::fprintf(json, "    {\"name\": \"%s\", \"ns_per_op\": %.1f, \"allocs_per_op\": %.3f}%s\n",
+                           result.name, result.nsPerOp, result.allocsPerOp, (i + 1 < results.size()) ? "," : "");
+    }
+    (void)std::fprintf(json,
+                       "  ],\n  \"queue_overhead_ns_per_tick\": %.1f,\n"
+                       "  \"param_snapshot_saving_ns_per_tick\": %.1f,\n"
+                       "  \"threads\": {\"active\": %" PRIu32 ", \"passive\": %" PRIu32 "}\n}\n",
+                       queueOverhead, snapshotSaving, activeThreads, passiveThreads);
+    (void)std::fclose(json);
+    (void)std::printf("queue overhead %.1f ns/tick, parameter snapshot saving %.1f ns/tick, threads %" PRIu32
+                      " active / %" PRIu32 " passive, results written to %s\n",
+                      queueOverhead, snapshotSaving, activeThreads, passiveThreads, jsonPath);
+    return 0;
+}
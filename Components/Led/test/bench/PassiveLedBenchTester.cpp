@@ -0,0 +1,121 @@
+// ======================================================================
+// \title  PassiveLedBenchTester.cpp
+// \author ortega
+// \brief  cpp file for the PassiveLed component benchmark harness
+// ======================================================================
+
+#include "PassiveLedBenchTester.hpp"
+
+#include <chrono>
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+PassiveLedBenchTester ::PassiveLedBenchTester()
+    : PassiveLedGTestBase("PassiveLedBenchTester", PassiveLedBenchTester::MAX_HISTORY_SIZE),
+      component("PassiveLed") {
+    this->initComponents();
+    this->connectPorts();
+    this->component.loadParameters();
+
+    // Blink on every tick so each tick toggles, logs and writes the GPIO
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->clearHistory();
+}
+
+PassiveLedBenchTester ::~PassiveLedBenchTester() {}
+
+// ----------------------------------------------------------------------
+// Benchmarks
+// ----------------------------------------------------------------------
+
+LedBenchTester::Result PassiveLedBenchTester ::benchTick(U64 operations, U32& threads) {
+    threads = threadCount();
+    return this->measure("tick_passive", operations, [this](U64) { this->invoke_to_run(0, 0); });
+}
+
+LedBenchTester::Result PassiveLedBenchTester ::benchCommand(U64 operations) {
+    return this->measure("command_passive", operations, [this](U64 i) {
+        this->sendCmd_BLINKING_ON_OFF(0, static_cast<U32>(i), Fw::On::ON);
+    });
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+U64 PassiveLedBenchTester ::from_cycleStart_handler(const NATIVE_INT_TYPE portNum, U32& cycle) {
+    cycle = 0;
+    return 0;
+}
+
+Drv::GpioStatus PassiveLedBenchTester ::from_gpioSet_handler(const NATIVE_INT_TYPE portNum, const Fw::Logic& state) {
+    return Drv::GpioStatus::OP_OK;
+}
+
+Svc::SendFileResponse PassiveLedBenchTester ::from_sendFile_handler(const NATIVE_INT_TYPE portNum,
+                                                                   const Fw::StringBase& sourceFileName,
+                                                                   const Fw::StringBase& destFileName,
+                                                                   U32 offset,
+                                                                   U32 length) {
+    return Svc::SendFileResponse(Svc::SendFileStatus::STATUS_OK, 0);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void PassiveLedBenchTester ::connectPorts() {
+    // Input ports of the component
+    this->connect_to_cmdIn(0, this->component.get_cmdIn_InputPort(0));
+    this->connect_to_run(0, this->component.get_run_InputPort(0));
+    this->connect_to_edgeLogRun(0, this->component.get_edgeLogRun_InputPort(0));
+
+    // Output ports of the component
+    this->component.set_cmdRegOut_OutputPort(0, this->get_from_cmdRegOut(0));
+    this->component.set_cmdResponseOut_OutputPort(0, this->get_from_cmdResponseOut(0));
+    this->component.set_logOut_OutputPort(0, this->get_from_logOut(0));
+#if FW_ENABLE_TEXT_LOGGING == 1
+    this->component.set_logTextOut_OutputPort(0, this->get_from_logTextOut(0));
+#endif
+    this->component.set_prmGetOut_OutputPort(0, this->get_from_prmGetOut(0));
+    this->component.set_prmSetOut_OutputPort(0, this->get_from_prmSetOut(0));
+    this->component.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
+    this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+    this->component.set_cycleStart_OutputPort(0, this->get_from_cycleStart(0));
+    this->component.set_gpioSet_OutputPort(0, this->get_from_gpioSet(0));
+    this->component.set_sendFile_OutputPort(0, this->get_from_sendFile(0));
+}
+
+void PassiveLedBenchTester ::initComponents() {
+    this->init();
+    this->component.init(PassiveLedBenchTester::TEST_INSTANCE_ID);
+}
+
+template <typename Operation>
+LedBenchTester::Result PassiveLedBenchTester ::measure(const char* name, U64 operations, Operation operation) {
+    LedBenchTester::Result result = {name, 0, 0.0, 0.0};
+    U64 elapsed = 0;
+    U64 allocations = 0;
+    for (U64 done = 0; done < operations; done += BATCH_SIZE) {
+        const U64 batch = FW_MIN(static_cast<U64>(BATCH_SIZE), operations - done);
+        const U64 allocationsBefore = allocationCount();
+        const auto start = std::chrono::steady_clock::now();
+        for (U64 i = 0; i < batch; i++) {
+            operation(done + i);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        allocations += allocationCount() - allocationsBefore;
+        elapsed += static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        this->clearHistory();
+    }
+    result.operations = operations;
+    result.nsPerOp = static_cast<F64>(elapsed) / static_cast<F64>(operations);
+    result.allocsPerOp = static_cast<F64>(allocations) / static_cast<F64>(operations);
+    return result;
+}
+
+}  // namespace Components
@@ -0,0 +1,108 @@
+// ======================================================================
+// \title  PassiveLedBenchTester.hpp
+// \author ortega
+// \brief  hpp file for the PassiveLed component benchmark harness
+// ======================================================================
+
+#ifndef Components_PassiveLedBenchTester_HPP
+#define Components_PassiveLedBenchTester_HPP
+
+#include "Components/Led/PassiveLed.hpp"
+#include "Components/Led/PassiveLedGTestBase.hpp"
+#include "LedBenchTester.hpp"
+
+namespace Components {
+
+//! Harness driving the PassiveLed component through its ports, for comparison with LedBenchTester
+class PassiveLedBenchTester : public PassiveLedGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Number of operations timed between two history clears
+    static const U32 BATCH_SIZE = LedBenchTester::BATCH_SIZE;
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = LedBenchTester::MAX_HISTORY_SIZE;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object PassiveLedBenchTester
+    PassiveLedBenchTester();
+
+    //! Destroy object PassiveLedBenchTester
+    ~PassiveLedBenchTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Benchmarks
+    // ----------------------------------------------------------------------
+
+    //! Tick through invoke_to_run, which runs the whole tick on the caller's thread under the component lock
+    LedBenchTester::Result benchTick(U64 operations,
+                                     U32& threads  //!< Set to the number of threads of the process
+    );
+
+    //! Send BLINKING_ON_OFF through the command port, handled on the caller's thread under the component lock
+    LedBenchTester::Result benchCommand(U64 operations);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_cycleStart
+    //!
+    U64 from_cycleStart_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                U32& cycle                      //!< Set to the index of the current cycle
+    );
+
+    //! Handler for from_gpioSet
+    //!
+    Drv::GpioStatus from_gpioSet_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                         const Fw::Logic& state          //!< The GPIO state
+    );
+
+    //! Handler for from_sendFile
+    //!
+    Svc::SendFileResponse from_sendFile_handler(const NATIVE_INT_TYPE portNum,        //!< The port number
+                                                const Fw::StringBase& sourceFileName,  //!< Path of file to downlink
+                                                const Fw::StringBase& destFileName,  //!< Path to store at destination
+                                                U32 offset,                          //!< Offset in the file
+                                                U32 length                           //!< Amount of data to downlink
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! Time an operation in batches of BATCH_SIZE, clearing the histories between batches
+    template <typename Operation>
+    LedBenchTester::Result measure(const char* name, U64 operations, Operation operation);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    PassiveLed component;
+};
+
+}  // namespace Components
+
+#endif
@@ -1,7 +1,16 @@
+import os
+import statistics
+import sys
 import time
 
+import pytest
 from fprime_gds.common.testing_fw import predicates
 
+sys.path.insert(
+    0, os.path.join(os.path.dirname(__file__), "..", "..", "..", "SimGpioDriver", "tools")
+)
+from sim_gpio_ring import SimGpioRing  # noqa: E402
+
 
 def test_blinking(fprime_test_api):
     """Test that LED component can respond to ground commands"""
@@ -65,3 +74,90 @@ def test_blinking(fprime_test_api):
         "LedBlinker.led.BlinkingState", "OFF"
     )
     fprime_test_api.assert_telemetry(blink_state_off_tlm, timeout=2)
+
+
+def count_led_events(fprime_test_api, start):
+    """Count the LedState and LedSummary events received since the given event history index"""
+    states = fprime_test_api.assert_event_count(
+        predicates.greater_than_or_equal_to(0), "LedBlinker.led.LedState", start=start
+    )
+    summaries = fprime_test_api.assert_event_count(
+        predicates.greater_than_or_equal_to(0), "LedBlinker.led.LedSummary", start=start
+    )
+    return len(states), len(summaries)
+
+
+def test_event_summary(fprime_test_api):
+    """Test that the SUMMARY event mode reduces the LED events sent to the ground"""
+    window = 8  # Seconds of blinking observed in each event mode
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINK_INTERVAL_PRM_SET", [1])
+    fprime_test_api.send_and_assert_command("LedBlinker.led.SUMMARY_PERIOD_PRM_SET", [4])
+
+    # Per-edge events: one LedState per toggle
+    fprime_test_api.send_and_assert_command("LedBlinker.led.EVENT_MODE_PRM_SET", ["PER_EDGE"])
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINKING_ON_OFF", ["ON"])
+    start = fprime_test_api.event_history.size()
+    time.sleep(window)
+    per_edge_states, per_edge_summaries = count_led_events(fprime_test_api, start)
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINKING_ON_OFF", ["OFF"])
+
+    # Summarized events: the commanded edge plus one summary per period
+    fprime_test_api.send_and_assert_command("LedBlinker.led.EVENT_MODE_PRM_SET", ["SUMMARY"])
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINKING_ON_OFF", ["ON"])
+    start = fprime_test_api.event_history.size()
+    time.sleep(window)
+    summary_states, summary_summaries = count_led_events(fprime_test_api, start)
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINKING_ON_OFF", ["OFF"])
+    fprime_test_api.send_and_assert_command("LedBlinker.led.EVENT_MODE_PRM_SET", ["PER_EDGE"])
+
+    per_edge_total = per_edge_states + per_edge_summaries
+    summary_total = summary_states + summary_summaries
+    fprime_test_api.log(
+        f"LED events over {window} s: {per_edge_total} per edge, {summary_total} summarized "
+        f"({per_edge_total - summary_total} fewer)"
+    )
+    assert fprime_test_api.test_assert(
+        summary_states <= 1, "Expected only the commanded edge as LedState in SUMMARY mode", True
+    )
+    assert fprime_test_api.test_assert(
+        summary_summaries > 0, "Expected LedSummary events in SUMMARY mode", True
+    )
+    assert fprime_test_api.test_assert(
+        summary_total < per_edge_total, "Expected SUMMARY mode to send fewer LED events", True
+    )
+
+
+@pytest.mark.skipif(
+    "LEDBLINKER_SIM_GPIO" not in os.environ,
+    reason="LEDBLINKER_SIM_GPIO must name the shared memory ring given to LedBlinker -g",
+)
+def test_sim_gpio_edge_timing(fprime_test_api):
+    """Test that the LED edges reach the GPIO evenly spaced, measured on the simulated GPIO ring"""
+    ring = SimGpioRing(os.environ["LEDBLINKER_SIM_GPIO"])
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINK_INTERVAL_PRM_SET", [1])
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINKING_ON_OFF", ["ON"])
+    ring.read()  # Drop the edges written before blinking settled
+    time.sleep(5)
+    records = ring.read()
+    fprime_test_api.send_and_assert_command("LedBlinker.led.BLINKING_ON_OFF", ["OFF"])
+    lost = ring.lost
+    ring.close()
+
+    assert fprime_test_api.test_assert(lost == 0, f"Expected no lost GPIO writes, lost {lost}", True)
+    # Each write must flip the line
+    levels = [level for _, _, level in records]
+    assert fprime_test_api.test_assert(
+        all(a != b for a, b in zip(levels, levels[1:])), "Expected alternating GPIO levels", True
+    )
+    intervals = [b[0] - a[0] for a, b in zip(records, records[1:])]
+    assert fprime_test_api.test_assert(
+        len(intervals) >= 3, f"Expected GPIO writes while blinking, got {len(records)}", True
+    )
+    median = statistics.median(intervals)
+    worst = max(abs(interval - median) for interval in intervals)
+    fprime_test_api.log(
+        f"{len(records)} GPIO writes, median interval {median / 1e6:.3f} ms, worst deviation {worst / 1e6:.3f} ms"
+    )
+    assert fprime_test_api.test_assert(
+        worst <= median / 10, "Expected every GPIO write interval within 10% of the median", True
+    )
@@ -16,6 +16,46 @@ TEST(Nominal, TestBlinkInterval) {
     tester.testBlinkInterval();
 }
 
+TEST(Nominal, TestEventSummary) {
+    Components::LedTester tester;
+    tester.testEventSummary();
+}
+
+TEST(Nominal, TestParamSnapshot) {
+    Components::LedTester tester;
+    tester.testParamSnapshot();
+}
+
+TEST(Nominal, TestPatterns) {
+    Components::LedTester tester;
+    tester.testPatterns();
+}
+
+TEST(Nominal, TestPatternLoad) {
+    Components::LedTester tester;
+    tester.testPatternLoad();
+}
+
+TEST(Nominal, TestPwm) {
+    Components::LedTester tester;
+    tester.testPwm();
+}
+
+TEST(Nominal, TestEdgeLog) {
+    Components::LedTester tester;
+    tester.testEdgeLog();
+}
+
+TEST(Nominal, TestTiming) {
+    Components::LedTester tester;
+    tester.testTiming();
+}
+
+TEST(Nominal, TestTickCoalescing) {
+    Components::LedTester tester;
+    tester.testTickCoalescing();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
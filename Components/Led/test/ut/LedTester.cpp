@@ -6,6 +6,11 @@
 
 #include "LedTester.hpp"
 
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
 namespace Components {
 
 // ----------------------------------------------------------------------
@@ -99,10 +104,505 @@ void LedTester ::testBlinkInterval() {
     ASSERT_TLM_LedTransitions(this->tlmHistory_LedTransitions->size() - 1, blinkInterval);
 }
 
+void LedTester ::testEventSummary() {
+    this->component.loadParameters();
+
+    // Summarize events every 4 cycles
+    this->paramSet_EVENT_MODE(LedEventMode::SUMMARY, Fw::ParamValid::VALID);
+    this->paramSend_EVENT_MODE(0, 0);
+    ASSERT_EVENTS_EventModeSet(0, LedEventMode::SUMMARY);
+    this->paramSet_SUMMARY_PERIOD(4, Fw::ParamValid::VALID);
+    this->paramSend_SUMMARY_PERIOD(0, 0);
+    ASSERT_EVENTS_SummaryPeriodSet(0, 4);
+
+    Fw::Time toggleTime(TB_NONE, 12, 34);
+    this->setTestTime(toggleTime);
+
+    // Enable LED Blinking
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();  // Trigger execution of async command
+
+    // Cycles 1-4: only the commanded edge is logged, then the period closes with a summary
+    for (U32 i = 0; i < 4; i++) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();  // Trigger execution of async input port invocation
+    }
+    ASSERT_EVENTS_LedState_SIZE(1);
+    ASSERT_EVENTS_LedState(0, Fw::On::ON);
+    ASSERT_EVENTS_LedSummary_SIZE(1);
+    ASSERT_EVENTS_LedSummary(0, 4, 2, 2, 12, 34);
+
+    // Cycles 5-7 toggle silently, the GPIO is still driven on every edge
+    for (U32 i = 0; i < 3; i++) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    }
+    ASSERT_EVENTS_LedState_SIZE(1);
+    ASSERT_from_gpioSet_SIZE(7);
+
+    // Stopping the blinking turns the LED off, which is always logged as an edge
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::OFF);
+    this->component.doDispatch();
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EVENTS_LedState_SIZE(2);
+    ASSERT_EVENTS_LedState(1, Fw::On::OFF);
+    ASSERT_EVENTS_LedSummary_SIZE(2);
+    ASSERT_EVENTS_LedSummary(1, 3, 2, 2, 12, 34);
+}
+
+void LedTester ::testParamSnapshot() {
+    this->component.loadParameters();
+
+    // The first tick copies the loaded parameters
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_params.blinkInterval, 1U);
+    ASSERT_EQ(this->component.m_params.eventMode, LedEventMode::PER_EDGE);
+    const U32 generation = this->component.m_snapshotGeneration;
+
+    // An update only bumps the generation, the snapshot is refreshed by the next tick
+    this->paramSet_BLINK_INTERVAL(3, Fw::ParamValid::VALID);
+    this->paramSend_BLINK_INTERVAL(0, 0);
+    ASSERT_EQ(this->component.m_params.blinkInterval, 1U);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_params.blinkInterval, 3U);
+    ASSERT_NE(this->component.m_snapshotGeneration, generation);
+
+    // Without an update the ticks keep the snapshot
+    const U32 updated = this->component.m_snapshotGeneration;
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_snapshotGeneration, updated);
+
+    // The snapshot holds the values paramGet returns
+    this->paramSet_EVENT_MODE(LedEventMode::SUMMARY, Fw::ParamValid::VALID);
+    this->paramSend_EVENT_MODE(0, 0);
+    this->paramSet_SUMMARY_PERIOD(25, Fw::ParamValid::VALID);
+    this->paramSend_SUMMARY_PERIOD(0, 0);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_NE(this->component.m_snapshotGeneration, updated);
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    ASSERT_EQ(this->component.m_params.blinkInterval, this->component.paramGet_BLINK_INTERVAL(isValid));
+    ASSERT_EQ(this->component.m_params.eventMode, this->component.paramGet_EVENT_MODE(isValid));
+    ASSERT_EQ(this->component.m_params.summaryPeriod, this->component.paramGet_SUMMARY_PERIOD(isValid));
+    ASSERT_EQ(this->component.m_params.timingWindow, this->component.paramGet_TIMING_WINDOW(isValid));
+}
+
+void LedTester ::testPatterns() {
+    this->component.loadParameters();
+
+    // Custom slots cannot be selected before a pattern file was loaded into them
+    this->sendCmd_PATTERN_SELECT(0, 0, LedPatternId::CUSTOM_2);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, Led::OPCODE_PATTERN_SELECT, 0, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_PatternEmpty(0, LedPatternId::CUSTOM_2);
+
+    // Play the heartbeat once: on 1, off 1, on 1, off 7
+    this->sendCmd_PATTERN_LOOP(0, 0, 1);
+    this->component.doDispatch();
+    this->sendCmd_PATTERN_SELECT(0, 0, LedPatternId::HEARTBEAT);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(2, Led::OPCODE_PATTERN_SELECT, 0, Fw::CmdResponse::OK);
+    ASSERT_TLM_ActivePattern(0, LedPatternId::HEARTBEAT);
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    this->clearHistory();
+
+    for (U32 i = 0; i < 10; i++) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    }
+    ASSERT_from_gpioSet_SIZE(4);
+    ASSERT_from_gpioSet(0, Fw::Logic::HIGH);
+    ASSERT_from_gpioSet(1, Fw::Logic::LOW);
+    ASSERT_from_gpioSet(2, Fw::Logic::HIGH);
+    ASSERT_from_gpioSet(3, Fw::Logic::LOW);
+    ASSERT_EVENTS_PatternComplete_SIZE(0);
+
+    // The tick after the last segment completes the pattern and stops blinking
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EVENTS_PatternComplete_SIZE(1);
+    ASSERT_EVENTS_PatternComplete(0, LedPatternId::HEARTBEAT);
+    ASSERT_TLM_BlinkingState(0, Fw::On::OFF);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_gpioSet_SIZE(4);
+
+    // Going back to BLINK restores the symmetric blinking
+    this->sendCmd_PATTERN_SELECT(0, 0, LedPatternId::BLINK);
+    this->component.doDispatch();
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    this->clearHistory();
+    for (U32 i = 0; i < 3; i++) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    }
+    ASSERT_from_gpioSet_SIZE(3);
+}
+
+void LedTester ::testPatternLoad() {
+    this->component.loadParameters();
+
+    // Pattern file: magic, two segments, on for 2 ticks, off for 3 ticks
+    const U8 pattern[] = {0x4C, 0x45, 0x44, 0x50, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03};
+    const char* const fileName = "LedPatternTest.bin";
+    FILE* file = fopen(fileName, "wb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(pattern, 1, sizeof(pattern), file), sizeof(pattern));
+    fclose(file);
+
+    // Malformed patterns are rejected and keep the slot unchanged
+    LedPatternStore store;
+    U8 badMagic[sizeof(pattern)];
+    memcpy(badMagic, pattern, sizeof(pattern));
+    badMagic[0] = 0;
+    ASSERT_EQ(store.load(badMagic, sizeof(badMagic)), LedPatternStatus::BAD_HEADER);
+    ASSERT_EQ(store.load(pattern, sizeof(pattern) - 1), LedPatternStatus::BAD_LENGTH);
+    U8 zeroSegment[sizeof(pattern)];
+    memcpy(zeroSegment, pattern, sizeof(pattern));
+    zeroSegment[9] = 0;
+    ASSERT_EQ(store.load(zeroSegment, sizeof(zeroSegment)), LedPatternStatus::BAD_SEGMENT);
+    ASSERT_EQ(store.pattern().count, 0U);
+    ASSERT_EQ(store.load("DoesNotExist.bin"), LedPatternStatus::FILE_ERROR);
+
+    // Slots beyond LED_PATTERN_CUSTOM_SLOTS do not exist
+    this->sendCmd_PATTERN_LOAD(0, 0, static_cast<U8>(LED_PATTERN_CUSTOM_SLOTS), Fw::CmdStringArg(fileName));
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, Led::OPCODE_PATTERN_LOAD, 0, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_InvalidPatternSlot_SIZE(1);
+
+    this->sendCmd_PATTERN_LOAD(0, 0, 1, Fw::CmdStringArg(fileName));
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(1, Led::OPCODE_PATTERN_LOAD, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_PatternLoaded(0, 1, 2);
+    (void)remove(fileName);
+
+    // The loaded pattern loops forever by default
+    this->sendCmd_PATTERN_SELECT(0, 0, LedPatternId::CUSTOM_1);
+    this->component.doDispatch();
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    this->clearHistory();
+    for (U32 i = 0; i < 10; i++) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    }
+    ASSERT_from_gpioSet_SIZE(4);
+    ASSERT_from_gpioSet(0, Fw::Logic::HIGH);
+    ASSERT_from_gpioSet(1, Fw::Logic::LOW);
+    ASSERT_from_gpioSet(2, Fw::Logic::HIGH);
+    ASSERT_from_gpioSet(3, Fw::Logic::LOW);
+    ASSERT_TLM_LedTransitions(3, 4);
+    ASSERT_EVENTS_PatternComplete_SIZE(0);
+}
+
+void LedTester ::testPwm() {
+    this->component.loadParameters();
+
+    // PWM needs its thread
+    this->sendCmd_PWM_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, Led::OPCODE_PWM_ON_OFF, 0, Fw::CmdResponse::EXECUTION_ERROR);
+    ASSERT_EVENTS_PwmNotStarted_SIZE(1);
+
+    // 100 Hz carrier at 25 percent. The PWM periods are stepped from the test thread in place of the PWM thread.
+    this->paramSet_PWM_FREQUENCY(100, Fw::ParamValid::VALID);
+    this->paramSend_PWM_FREQUENCY(0, 0);
+    this->paramSet_PWM_DUTY(25, Fw::ParamValid::VALID);
+    this->paramSend_PWM_DUTY(0, 0);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_pwmFrequency.load(), 100U);
+    ASSERT_EQ(this->component.m_pwmDuty.load(), 25U);
+    this->component.m_pwmRunning = true;
+    this->sendCmd_PWM_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(1, Led::OPCODE_PWM_ON_OFF, 0, Fw::CmdResponse::OK);
+    ASSERT_TLM_PwmState(0, Fw::On::ON);
+    this->clearHistory();
+
+    // Not blinking: the carrier runs steadily, one rising and one falling edge per period
+    Led::PwmCarrier carrier;
+    for (U32 i = 0; i < 3; i++) {
+        this->component.pwmStep(carrier);
+    }
+    ASSERT_TRUE(this->component.m_pwmActive.load());
+    ASSERT_from_gpioSet_SIZE(6);
+    for (U32 i = 0; i < 6; i += 2) {
+        ASSERT_from_gpioSet(i, Fw::Logic::HIGH);
+        ASSERT_from_gpioSet(i + 1, Fw::Logic::LOW);
+    }
+
+    // The statistics are published by the tick path
+    this->component.pwmPublish(carrier);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_TLM_PwmDutyError_SIZE(1);
+    ASSERT_LT(fabsf(this->tlmHistory_PwmDutyError->at(0).arg), 5.0f);
+    ASSERT_TLM_PwmEdgeJitterMax_SIZE(1);
+
+    // Blinking gates the carrier and the tick path leaves the GPIO to the PWM thread
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_TLM_LedTransitions_SIZE(2);
+    ASSERT_from_gpioSet_SIZE(6);
+    ASSERT_FALSE(this->component.m_pwmGate.load());
+    this->component.pwmStep(carrier);
+    ASSERT_from_gpioSet_SIZE(6);
+
+    // Turning PWM off hands the GPIO back to the tick path
+    this->sendCmd_PWM_ON_OFF(0, 0, Fw::On::OFF);
+    this->component.doDispatch();
+    this->component.pwmStep(carrier);
+    ASSERT_FALSE(this->component.m_pwmActive.load());
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_gpioSet_SIZE(7);
+    ASSERT_from_gpioSet(6, Fw::Logic::HIGH);
+}
+
+void LedTester ::testEdgeLog() {
+    this->component.loadParameters();
+    this->component.configureEdgeLog("LedEdgeTest");
+
+    // Edges are recorded without any event in NONE event mode
+    this->paramSet_EVENT_MODE(LedEventMode::NONE, Fw::ParamValid::VALID);
+    this->paramSend_EVENT_MODE(0, 0);
+    this->setTestTime(Fw::Time(TB_NONE, 100, 5));
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    for (U32 i = 0; i < 3; i++) {
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+    }
+    ASSERT_EVENTS_LedState_SIZE(0);
+    ASSERT_EQ(this->component.m_edgeLog.available(), 3U);
+
+    // Partial segments wait for a flush
+    this->invoke_to_edgeLogRun(0, 0);
+    ASSERT_from_sendFile_SIZE(0);
+    ASSERT_TLM_EdgeLogDropped(0, 0);
+    this->sendCmd_EDGE_LOG_FLUSH(0, 0);
+    this->component.doDispatch();
+    this->invoke_to_edgeLogRun(0, 0);
+    ASSERT_EQ(this->component.m_edgeLog.available(), 0U);
+    ASSERT_EQ(this->component.m_edgeSegmentsFilled.load(), 1U);
+
+    // The rate group only hands the segment over: the file is written by the edge log thread
+    ASSERT_from_sendFile_SIZE(0);
+    ASSERT_TLM_EdgeLogRecords_SIZE(0);
+    this->component.writeEdgeSegments();
+    ASSERT_EQ(this->component.m_edgeSegmentsWritten.load(), 1U);
+    ASSERT_from_sendFile_SIZE(1);
+    ASSERT_TLM_EdgeLogRecords(0, 3);
+    ASSERT_TLM_EdgeLogSegments(0, 1);
+
+    // Header, then ticks 1 to 3 toggling on, off, on
+    U8 data[LedEdgeLog::HEADER_SIZE + 3 * LedEdgeLog::RECORD_SIZE + 1];
+    FILE* file = fopen("LedEdgeTest_00.bin", "rb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fread(data, 1, sizeof(data), file), sizeof(data) - 1);
+    fclose(file);
+    (void)remove("LedEdgeTest_00.bin");
+    Fw::ExternalSerializeBuffer buffer(data, sizeof(data) - 1);
+    buffer.setBuffLen(sizeof(data) - 1);
+    U32 magic = 0;
+    U8 version = 0;
+    U32 sequence = 1;
+    U16 count = 0;
+    U32 dropped = 1;
+    buffer.deserialize(magic);
+    buffer.deserialize(version);
+    buffer.deserialize(sequence);
+    buffer.deserialize(count);
+    buffer.deserialize(dropped);
+    ASSERT_EQ(magic, LedEdgeLog::EDGE_LOG_MAGIC);
+    ASSERT_EQ(version, LedEdgeLog::EDGE_LOG_VERSION);
+    ASSERT_EQ(sequence, 0U);
+    ASSERT_EQ(count, 3U);
+    ASSERT_EQ(dropped, 0U);
+    for (U32 i = 0; i < 3; i++) {
+        U32 seconds = 0;
+        U32 useconds = 0;
+        U32 tick = 0;
+        U8 state = 0;
+        buffer.deserialize(seconds);
+        buffer.deserialize(useconds);
+        buffer.deserialize(tick);
+        buffer.deserialize(state);
+        ASSERT_EQ(seconds, 100U);
+        ASSERT_EQ(useconds, 5U);
+        ASSERT_EQ(tick, i + 1);
+        ASSERT_EQ(state, (i % 2 == 0) ? 1U : 0U);
+    }
+
+    // A full ring drops and counts the edges
+    LedEdgeLog log;
+    LedEdgeLog::Record record = {0, 0, 0, 1};
+    for (U32 i = 0; i < LedEdgeLog::CAPACITY; i++) {
+        ASSERT_TRUE(log.push(record));
+    }
+    ASSERT_FALSE(log.push(record));
+    ASSERT_EQ(log.dropped(), 1U);
+    ASSERT_EQ(log.available(), LedEdgeLog::CAPACITY);
+}
+
+void LedTester ::testTiming() {
+    this->component.loadParameters();
+    this->paramSet_TIMING_WINDOW(4, Fw::ParamValid::VALID);
+    this->paramSend_TIMING_WINDOW(0, 0);
+    ASSERT_EVENTS_TimingWindowSet(0, 4);
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+
+    // Every tick of the window is 2 ms late on its cycle; rising edges come every other tick
+    for (U32 i = 0; i < 4; i++) {
+        this->m_cycleStart = static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count()) -
+                             2000000;
+        this->invoke_to_run(0, 0);
+        this->component.doDispatch();
+        if (i < 3) {
+            ASSERT_TLM_DispatchLatency_SIZE(0);
+        }
+    }
+    ASSERT_TLM_DispatchLatency_SIZE(1);
+    const LedTimingStats latency = this->tlmHistory_DispatchLatency->at(0).arg;
+    ASSERT_GE(latency.getmin(), 2000U);
+    ASSERT_LE(latency.getmin(), latency.getp99());
+    ASSERT_LE(latency.getp99(), latency.getmax());
+    ASSERT_LE(latency.getmin(), latency.getmean());
+    ASSERT_LE(latency.getmean(), latency.getmax());
+    ASSERT_TLM_EdgePeriod_SIZE(1);
+    ASSERT_EQ(this->component.m_latencyCount, 0U);
+
+    // Statistics of known samples, in nanoseconds
+    U32 samples[100];
+    for (U32 i = 0; i < 100; i++) {
+        samples[i] = (i + 1) * 1000;
+    }
+    const LedTimingStats stats = Led::timingStats(samples, 100);
+    ASSERT_EQ(stats.getmin(), 1U);
+    ASSERT_EQ(stats.getmax(), 100U);
+    ASSERT_EQ(stats.getmean(), 50U);
+    ASSERT_EQ(stats.getp99(), 99U);
+}
+
+void LedTester ::testTickCoalescing() {
+    this->component.loadParameters();
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+
+    // Ticks arriving while one is queued are counted, not queued: one dispatch runs all three
+    for (U32 i = 0; i < 3; i++) {
+        this->m_cycleStart = static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count());
+        this->invoke_to_run(0, 0);
+    }
+    this->m_cycleStart = 0;
+    ASSERT_EQ(this->component.m_pendingTicks.load(), 3U);
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_pendingTicks.load(), 0U);
+    // Each tick was timed by run against its own cycle
+    ASSERT_EQ(this->component.m_latencyCount, 3U);
+    // Three toggles at interval 1 leave the LED on after a single edge
+    ASSERT_from_gpioSet_SIZE(1);
+    ASSERT_from_gpioSet(0, Fw::Logic::HIGH);
+    ASSERT_TLM_CoalescedTicks_SIZE(1);
+    ASSERT_TLM_CoalescedTicks(0, 2U);
+    // Every toggle the ticks applied is counted as a transition, not only the edge
+    ASSERT_TLM_LedTransitions_SIZE(1);
+    ASSERT_TLM_LedTransitions(0, 3U);
+    ASSERT_EQ(this->component.m_ticks, 3U);
+    ASSERT_from_tickDone_SIZE(1);
+
+    // The toggle counter advances by all the ticks: at interval 4 the next toggle is due 4 ticks after the last one
+    this->paramSet_BLINK_INTERVAL(4, Fw::ParamValid::VALID);
+    this->paramSend_BLINK_INTERVAL(0, 0);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_gpioSet_SIZE(2);
+    ASSERT_EQ(this->component.m_toggleCounter, 1U);
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_gpioSet_SIZE(2);
+    ASSERT_EQ(this->component.m_toggleCounter, 3U);
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_gpioSet_SIZE(3);
+    ASSERT_EQ(this->component.m_toggleCounter, 1U);
+    ASSERT_TLM_CoalescedTicks_SIZE(3);
+    ASSERT_TLM_CoalescedTicks(2, 4U);
+    ASSERT_TLM_LedTransitions_SIZE(3);
+    ASSERT_TLM_LedTransitions(2, 5U);
+    this->clearHistory();
+
+    // With the DROP policy the extra ticks are discarded
+    this->paramSet_TICK_POLICY(LedTickPolicy::DROP, Fw::ParamValid::VALID);
+    this->paramSend_TICK_POLICY(0, 0);
+    ASSERT_EVENTS_TickPolicySet_SIZE(1);
+    ASSERT_EVENTS_TickPolicySet(0, LedTickPolicy::DROP);
+    for (U32 i = 0; i < 3; i++) {
+        this->invoke_to_run(0, 0);
+    }
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_toggleCounter, 2U);
+    ASSERT_TLM_DroppedTicks_SIZE(1);
+    ASSERT_TLM_DroppedTicks(0, 2U);
+    ASSERT_TLM_CoalescedTicks_SIZE(0);
+
+    // A queue full of commands drops the tick message instead of asserting, the next tick queues a new one
+    for (NATIVE_INT_TYPE i = 0; i < TEST_INSTANCE_QUEUE_DEPTH; i++) {
+        this->sendCmd_EDGE_LOG_FLUSH(0, static_cast<U32>(i));
+    }
+    this->invoke_to_run(0, 0);
+    ASSERT_EQ(this->component.m_pendingTicks.load(), 0U);
+    ASSERT_EQ(this->component.m_droppedTicks.load(), 3U);
+    // The dropped tick is reported done, so a simulation barrier does not wait for it
+    ASSERT_from_tickDone_SIZE(2);
+    for (NATIVE_INT_TYPE i = 0; i < TEST_INSTANCE_QUEUE_DEPTH; i++) {
+        this->component.doDispatch();
+    }
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+    ASSERT_EQ(this->component.m_toggleCounter, 3U);
+    ASSERT_TLM_DroppedTicks_SIZE(1);
+    ASSERT_TLM_DroppedTicks(0, 3U);
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
 
+U64 LedTester ::from_cycleStart_handler(const NATIVE_INT_TYPE portNum, U32& cycle) {
+    // Not recorded in the port history: it is called on every tick
+    cycle = 0;
+    return this->m_cycleStart;
+}
+
+Svc::SendFileResponse LedTester ::from_sendFile_handler(const NATIVE_INT_TYPE portNum,
+                                                       const Fw::StringBase& sourceFileName,
+                                                       const Fw::StringBase& destFileName,
+                                                       U32 offset,
+                                                       U32 length) {
+    this->pushFromPortEntry_sendFile(sourceFileName, destFileName, offset, length);
+    return Svc::SendFileResponse(Svc::SendFileStatus::STATUS_OK, 0);
+}
+
 Drv::GpioStatus LedTester ::from_gpioSet_handler(const NATIVE_INT_TYPE portNum, const Fw::Logic& state) {
     this->pushFromPortEntry_gpioSet(state);
     return Drv::GpioStatus::OP_OK;
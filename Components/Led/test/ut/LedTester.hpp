@@ -45,6 +45,14 @@ class LedTester : public LedGTestBase {
 
     void testBlinking();
     void testBlinkInterval();
+    void testEventSummary();
+    void testParamSnapshot();
+    void testPatterns();
+    void testPatternLoad();
+    void testPwm();
+    void testEdgeLog();
+    void testTiming();
+    void testTickCoalescing();
 
   private:
     // ----------------------------------------------------------------------
@@ -56,6 +64,21 @@ class LedTester : public LedGTestBase {
     Drv::GpioStatus from_gpioSet_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                                          const Fw::Logic& state);
 
+    //! Handler for from_cycleStart
+    //!
+    U64 from_cycleStart_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                U32& cycle                      //!< Set to the index of the current cycle
+    );
+
+    //! Handler for from_sendFile
+    //!
+    Svc::SendFileResponse from_sendFile_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                                const Fw::StringBase& sourceFileName,  //!< Path of file to downlink
+                                                const Fw::StringBase& destFileName,  //!< Path to store at destination
+                                                U32 offset,  //!< Amount of data in bytes to downlink from file
+                                                U32 length   //!< Amount of data in bytes to downlink from file
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Helper functions
@@ -74,6 +97,9 @@ class LedTester : public LedGTestBase {
 
     //! The component under test
     Led component;
+
+    //! Cycle start returned on the cycleStart port, 0 for no cycle
+    U64 m_cycleStart = 0;
 };
 
 }  // namespace Components
@@ -0,0 +1,32 @@
+// ======================================================================
+// \title  PassiveLedTestMain.cpp
+// \author ortega
+// \brief  cpp file for PassiveLed component test main function
+// ======================================================================
+
+#include "PassiveLedTester.hpp"
+
+TEST(Nominal, TestSynchronousBlinking) {
+    Components::PassiveLedTester tester;
+    tester.testSynchronousBlinking();
+}
+
+TEST(Nominal, TestSynchronousParameters) {
+    Components::PassiveLedTester tester;
+    tester.testSynchronousParameters();
+}
+
+TEST(Nominal, TestPatternLoad) {
+    Components::PassiveLedTester tester;
+    tester.testPatternLoad();
+}
+
+TEST(Nominal, TestTickDone) {
+    Components::PassiveLedTester tester;
+    tester.testTickDone();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
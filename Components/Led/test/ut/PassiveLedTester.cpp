@@ -0,0 +1,168 @@
+// ======================================================================
+// \title  PassiveLedTester.cpp
+// \author ortega
+// \brief  cpp file for PassiveLed component test harness implementation class
+// ======================================================================
+
+#include "PassiveLedTester.hpp"
+
+#include <cstdio>
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+PassiveLedTester ::PassiveLedTester()
+    : PassiveLedGTestBase("PassiveLedTester", PassiveLedTester::MAX_HISTORY_SIZE), component("PassiveLed") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+PassiveLedTester ::~PassiveLedTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void PassiveLedTester ::testSynchronousBlinking() {
+    this->component.loadParameters();
+
+    // The LED stays off while not blinking
+    this->invoke_to_run(0, 0);
+    ASSERT_from_gpioSet_SIZE(0);
+
+    // The command is handled before sendCmd returns
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, PassiveLed::OPCODE_BLINKING_ON_OFF, 0, Fw::CmdResponse::OK);
+    ASSERT_EQ(this->component.m_blinking, true);
+
+    // Each tick drives the GPIO on the caller's thread
+    this->invoke_to_run(0, 0);
+    ASSERT_from_gpioSet_SIZE(1);
+    ASSERT_from_gpioSet(0, Fw::Logic::HIGH);
+    ASSERT_EVENTS_LedState_SIZE(1);
+    ASSERT_EVENTS_LedState(0, Fw::On::ON);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_gpioSet_SIZE(2);
+    ASSERT_from_gpioSet(1, Fw::Logic::LOW);
+    ASSERT_TLM_LedTransitions_SIZE(2);
+    ASSERT_TLM_LedTransitions(1, 2);
+
+    this->invoke_to_run(0, 0);
+    ASSERT_from_gpioSet_SIZE(3);
+    ASSERT_from_gpioSet(2, Fw::Logic::HIGH);
+
+    // Stopping turns the LED off at the next tick
+    this->sendCmd_BLINKING_ON_OFF(0, 1, Fw::On::OFF);
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_gpioSet_SIZE(4);
+    ASSERT_from_gpioSet(3, Fw::Logic::LOW);
+}
+
+void PassiveLedTester ::testSynchronousParameters() {
+    this->component.loadParameters();
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+
+    // A new interval is picked up by the next tick
+    this->paramSet_BLINK_INTERVAL(2, Fw::ParamValid::VALID);
+    this->paramSend_BLINK_INTERVAL(0, 0);
+    ASSERT_EVENTS_BlinkIntervalSet_SIZE(1);
+    ASSERT_EVENTS_BlinkIntervalSet(0, 2U);
+    for (U32 tick = 0; tick < 4; tick++) {
+        this->invoke_to_run(0, 0);
+    }
+    ASSERT_from_gpioSet_SIZE(2);
+    ASSERT_EQ(this->component.m_params.blinkInterval, 2U);
+}
+
+void PassiveLedTester ::testPatternLoad() {
+    this->component.loadParameters();
+
+    // Pattern file: magic, two segments, on for 2 ticks, off for 3 ticks
+    const U8 pattern[] = {0x4C, 0x45, 0x44, 0x50, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03};
+    const char* const fileName = "PassiveLedPatternTest.bin";
+    FILE* file = fopen(fileName, "wb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(pattern, 1, sizeof(pattern), file), sizeof(pattern));
+    fclose(file);
+
+    // The file is read outside the component lock, which is released once the pattern is installed
+    this->sendCmd_PATTERN_LOAD(0, 0, 0, Fw::CmdStringArg(fileName));
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, PassiveLed::OPCODE_PATTERN_LOAD, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_PatternLoaded_SIZE(1);
+    ASSERT_EVENTS_PatternLoaded(0, 0, 2);
+    (void)remove(fileName);
+
+    // A failed read keeps the installed pattern, and invalid slots are rejected
+    this->sendCmd_PATTERN_LOAD(0, 1, 0, Fw::CmdStringArg(fileName));
+    ASSERT_CMD_RESPONSE(1, PassiveLed::OPCODE_PATTERN_LOAD, 1, Fw::CmdResponse::EXECUTION_ERROR);
+    ASSERT_EVENTS_PatternLoadError_SIZE(1);
+    this->sendCmd_PATTERN_LOAD(0, 2, static_cast<U8>(LED_PATTERN_CUSTOM_SLOTS), Fw::CmdStringArg(fileName));
+    ASSERT_CMD_RESPONSE(2, PassiveLed::OPCODE_PATTERN_LOAD, 2, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_InvalidPatternSlot_SIZE(1);
+    ASSERT_EQ(this->component.m_customPatterns[0].pattern().count, 2U);
+
+    // The ticks take the lock again and play the loaded pattern
+    this->sendCmd_PATTERN_SELECT(0, 3, LedPatternId::CUSTOM_0);
+    this->sendCmd_BLINKING_ON_OFF(0, 4, Fw::On::ON);
+    this->clearHistory();
+    for (U32 i = 0; i < 10; i++) {
+        this->invoke_to_run(0, 0);
+    }
+    ASSERT_from_gpioSet_SIZE(4);
+    ASSERT_from_gpioSet(0, Fw::Logic::HIGH);
+    ASSERT_from_gpioSet(1, Fw::Logic::LOW);
+    ASSERT_from_gpioSet(2, Fw::Logic::HIGH);
+    ASSERT_from_gpioSet(3, Fw::Logic::LOW);
+}
+
+void PassiveLedTester ::testTickDone() {
+    this->component.loadParameters();
+
+    // Every run call reports its tick done before returning, whether or not the LED toggles
+    this->invoke_to_run(0, 0);
+    ASSERT_from_tickDone_SIZE(1);
+    this->sendCmd_BLINKING_ON_OFF(0, 0, Fw::On::ON);
+    ASSERT_from_tickDone_SIZE(1);
+    for (U32 i = 0; i < 3; i++) {
+        this->invoke_to_run(0, 0);
+        ASSERT_from_tickDone_SIZE(i + 2);
+    }
+    ASSERT_from_gpioSet_SIZE(3);
+
+    // The edge log and the commands are not ticks
+    this->invoke_to_edgeLogRun(0, 0);
+    this->sendCmd_BLINKING_ON_OFF(0, 1, Fw::On::OFF);
+    ASSERT_from_tickDone_SIZE(4);
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+Drv::GpioStatus PassiveLedTester ::from_gpioSet_handler(const NATIVE_INT_TYPE portNum, const Fw::Logic& state) {
+    this->pushFromPortEntry_gpioSet(state);
+    return Drv::GpioStatus::OP_OK;
+}
+
+U64 PassiveLedTester ::from_cycleStart_handler(const NATIVE_INT_TYPE portNum, U32& cycle) {
+    // Not recorded in the port history: it is called on every tick
+    cycle = 0;
+    return 0;
+}
+
+Svc::SendFileResponse PassiveLedTester ::from_sendFile_handler(const NATIVE_INT_TYPE portNum,
+                                                              const Fw::StringBase& sourceFileName,
+                                                              const Fw::StringBase& destFileName,
+                                                              U32 offset,
+                                                              U32 length) {
+    this->pushFromPortEntry_sendFile(sourceFileName, destFileName, offset, length);
+    return Svc::SendFileResponse(Svc::SendFileStatus::STATUS_OK, 0);
+}
+
+}  // namespace Components
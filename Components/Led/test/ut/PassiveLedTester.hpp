@@ -0,0 +1,98 @@
+// ======================================================================
+// \title  PassiveLedTester.hpp
+// \author ortega
+// \brief  hpp file for PassiveLed component test harness implementation class
+// ======================================================================
+
+#ifndef Components_PassiveLedTester_HPP
+#define Components_PassiveLedTester_HPP
+
+#include "Components/Led/PassiveLed.hpp"
+#include "Components/Led/PassiveLedGTestBase.hpp"
+
+namespace Components {
+
+//! The behavior shared with Led is covered by LedTester: these tests check that ticks and commands take effect
+//! without a dispatch
+class PassiveLedTester : public PassiveLedGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object PassiveLedTester
+    PassiveLedTester();
+
+    //! Destroy object PassiveLedTester
+    ~PassiveLedTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void testSynchronousBlinking();
+    void testSynchronousParameters();
+    void testPatternLoad();
+    void testTickDone();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_gpioSet
+    //!
+    Drv::GpioStatus from_gpioSet_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                         const Fw::Logic& state          //!< The GPIO state
+    );
+
+    //! Handler for from_cycleStart
+    //!
+    U64 from_cycleStart_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                U32& cycle                      //!< Set to the index of the current cycle
+    );
+
+    //! Handler for from_sendFile
+    //!
+    Svc::SendFileResponse from_sendFile_handler(const NATIVE_INT_TYPE portNum,        //!< The port number
+                                                const Fw::StringBase& sourceFileName,  //!< Path of file to downlink
+                                                const Fw::StringBase& destFileName,  //!< Path to store at destination
+                                                U32 offset,                          //!< Offset in the file
+                                                U32 length                           //!< Amount of data to downlink
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    PassiveLed component;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Decode LED edge log segment files downlinked by the Led component.
+
+Segment files are big-endian: magic "LEDE", version (U8), sequence (U32), record count (U16) and edges dropped since
+boot (U32), followed by records of seconds (U32), microseconds (U32), tick (U32) and state (U8).
+
+Usage: led_edge_decode.py [--csv] LedEdges_*.bin
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = 0x4C454445
+VERSION = 1
+HEADER = struct.Struct(">IBIHI")
+RECORD = struct.Struct(">IIIB")
+
+
+def read_segment(path):
+    """Return (sequence, dropped, records) of a segment file, records being (time, tick, state) tuples"""
+    with open(path, "rb") as segment:
+        data = segment.read()
+    if len(data) < HEADER.size:
+        raise ValueError(f"{path}: truncated header")
+    magic, version, sequence, count, dropped = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f"{path}: not a version {VERSION} LED edge log segment")
+    if len(data) != HEADER.size + count * RECORD.size:
+        raise ValueError(f"{path}: expected {count} records")
+    records = [
+        (seconds + useconds / 1e6, tick, state)
+        for seconds, useconds, tick, state in RECORD.iter_unpack(data[HEADER.size :])
+    ]
+    return sequence, dropped, records
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--csv", action="store_true", help="print every edge as time,tick,state")
+    parser.add_argument("files", nargs="+", help="segment files")
+    args = parser.parse_args()
+
+    # Segment files are reused round robin, the sequence number restores the order
+    segments = sorted(read_segment(path) for path in args.files)
+    records = [record for _, _, segment in segments for record in segment]
+    dropped = max(dropped for _, dropped, _ in segments)
+
+    if args.csv:
+        print("time,tick,state")
+        for time, tick, state in records:
+            print(f"{time:.6f},{tick},{state}")
+        return 0
+
+    # Periods between rising edges
+    rises = [time for time, _, state in records if state == 1]
+    periods = [later - earlier for earlier, later in zip(rises, rises[1:])]
+    print(f"segments: {len(segments)} edges: {len(records)} dropped: {dropped}")
+    if periods:
+        mean = sum(periods) / len(periods)
+        print(f"period (s): min {min(periods):.6f} mean {mean:.6f} max {max(periods):.6f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
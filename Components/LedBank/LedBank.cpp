@@ -0,0 +1,173 @@
+// ======================================================================
+// \title  LedBank.cpp
+// \author ortega
+// \brief  cpp file for LedBank component implementation class
+// ======================================================================
+
+#include "Components/LedBank/LedBank.hpp"
+#include "FpConfig.hpp"
+
+namespace Components {
+
+namespace {
+//! Bit selecting one LED of the bank
+inline U64 ledBit(U32 led) {
+    return static_cast<U64>(1) << led;
+}
+
+//! Mask selecting the first count LEDs of the bank
+inline U64 ledsMask(U32 count) {
+    return (count >= LED_BANK_MAX_LEDS) ? ~static_cast<U64>(0) : (ledBit(count) - 1);
+}
+
+//! Number of LEDs set in a mask
+inline U32 ledsInMask(U64 mask) {
+    return static_cast<U32>(__builtin_popcountll(mask));
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+LedBank ::LedBank(const char* const compName)
+    : LedBankComponentBase(compName),
+      m_ledMask(ledsMask(LED_BANK_MAX_LEDS)),
+      m_ledCount(LED_BANK_MAX_LEDS),
+      m_intervalsStale(true) {
+    for (U32 led = 0; led < LED_BANK_MAX_LEDS; led++) {
+        this->m_intervals[led] = 0;
+        this->m_counters[led] = 0;
+    }
+}
+
+LedBank ::~LedBank() {}
+
+void LedBank ::configure(U8 ledCount) {
+    FW_ASSERT(ledCount <= LED_BANK_MAX_LEDS, static_cast<FwAssertArgType>(ledCount));
+    this->m_ledCount = ledCount;
+    this->m_ledMask = ledsMask(ledCount);
+}
+
+void LedBank ::parameterUpdated(FwPrmIdType id) {
+    switch (id) {
+        case PARAMID_BLINK_INTERVALS: {
+            // Parameter updates arrive on the command dispatcher thread, so the tick reloads the intervals itself
+            this->m_intervalsStale = true;
+            this->log_ACTIVITY_HI_BlinkIntervalsSet();
+            break;
+        }
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(id));
+            break;
+    }
+}
+
+void LedBank ::parametersLoaded() {
+    this->m_intervalsStale = true;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void LedBank ::run_handler(FwIndexType portNum, U32 context) {
+    if (this->m_intervalsStale.exchange(false)) {
+        this->loadIntervals();
+    }
+
+    // Work out the toggles of every LED for this tick in one pass over the blinking LEDs
+    U64 toggles = 0;
+    U64 pending = this->m_blinkingMask & this->m_intervalMask & this->m_ledMask;
+    while (pending != 0) {
+        const U32 led = static_cast<U32>(__builtin_ctzll(pending));
+        pending &= pending - 1;
+
+        if (this->m_counters[led] == 0) {
+            toggles |= ledBit(led);
+        }
+        const U32 next = this->m_counters[led] + 1;
+        this->m_counters[led] = (next >= this->m_intervals[led]) ? 0 : next;
+    }
+    // LEDs that are lit but no longer blinking are turned off
+    toggles |= this->m_stateMask & ~(this->m_blinkingMask & this->m_intervalMask);
+
+    if (toggles == 0) {
+        return;
+    }
+    this->m_stateMask ^= toggles;
+    this->m_transitions += ledsInMask(toggles);
+    this->tlmWrite_BankTransitions(this->m_transitions);
+
+    // Port may not be connected, so check before sending output
+    if (this->isConnected_gpioBankSet_OutputPort(0)) {
+        const Drv::GpioStatus status = this->gpioBankSet_out(0, toggles, this->m_stateMask);
+        if (status != Drv::GpioStatus::OP_OK) {
+            this->log_WARNING_HI_BankWriteError(status);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void LedBank ::BLINKING_ON_OFF_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U8 led, Fw::On onOff) {
+    if (led >= this->m_ledCount) {
+        this->log_WARNING_LO_InvalidLed(led, this->m_ledCount);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    this->m_counters[led] = 0;  // Reset count on any successful command
+    if (Fw::On::ON == onOff) {
+        this->m_blinkingMask |= ledBit(led);
+    } else {
+        this->m_blinkingMask &= ~ledBit(led);
+    }
+
+    this->log_ACTIVITY_HI_SetBlinkingState(led, onOff);
+
+    this->tlmWrite_BlinkingMask(this->m_blinkingMask);
+
+    // Provide command response
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void LedBank ::BLINKING_ALL_ON_OFF_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::On onOff) {
+    for (U32 led = 0; led < this->m_ledCount; led++) {
+        this->m_counters[led] = 0;  // Reset count on any successful command
+    }
+    this->m_blinkingMask = (Fw::On::ON == onOff) ? this->m_ledMask : 0;
+
+    this->log_ACTIVITY_HI_SetAllBlinkingState(onOff);
+
+    this->tlmWrite_BlinkingMask(this->m_blinkingMask);
+
+    // Provide command response
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void LedBank ::loadIntervals() {
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    const LedBankIntervals intervals = this->paramGet_BLINK_INTERVALS(isValid);
+    FW_ASSERT((isValid != Fw::ParamValid::INVALID) && (isValid != Fw::ParamValid::UNINIT),
+              static_cast<FwAssertArgType>(isValid));
+
+    this->m_intervalMask = 0;
+    for (U32 led = 0; led < LED_BANK_MAX_LEDS; led++) {
+        this->m_intervals[led] = intervals[led];
+        if (intervals[led] != 0) {
+            this->m_intervalMask |= ledBit(led);
+        }
+        // Keep counters inside the new interval so each LED toggles within one period
+        if (this->m_counters[led] >= intervals[led]) {
+            this->m_counters[led] = 0;
+        }
+    }
+}
+
+}  // namespace Components
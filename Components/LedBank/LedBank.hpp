@@ -0,0 +1,108 @@
+// ======================================================================
+// \title  LedBank.hpp
+// \author ortega
+// \brief  hpp file for LedBank component implementation class
+// ======================================================================
+
+#ifndef Components_LedBank_HPP
+#define Components_LedBank_HPP
+
+#include <atomic>
+
+#include "Components/LedBank/FppConstantsAc.hpp"
+#include "Components/LedBank/LedBankComponentAc.hpp"
+
+namespace Components {
+
+class LedBank : public LedBankComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct LedBank object
+    LedBank(const char* const compName  //!< The component name
+    );
+
+    //! Destroy LedBank object
+    ~LedBank();
+
+    //! Set the number of LEDs wired to the bank
+    //!
+    //! LED N is driven by bit N of the gpioBankSet masks. Defaults to LED_BANK_MAX_LEDS.
+    void configure(U8 ledCount  //!< Number of LEDs, at most LED_BANK_MAX_LEDS
+    );
+
+    PRIVATE :
+        //! Emit parameter updated EVR
+        //!
+        void
+        parameterUpdated(FwPrmIdType id  //!< The parameter ID
+                         ) override;
+
+    //! Mark the intervals for reload once parameters are loaded
+    //!
+    void parametersLoaded() override;
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for run
+        //!
+        //! Port receiving calls from the rate group
+        void
+        run_handler(FwIndexType portNum,  //!< The port number
+                    U32 context  //!< The call order
+                    ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Handler implementations for commands
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for command BLINKING_ON_OFF
+        //!
+        //! Command to turn on or off the blinking of one LED of the bank
+        void
+        BLINKING_ON_OFF_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                   U32 cmdSeq,           //!< The command sequence number
+                                   U8 led,               //!< Index of the LED in the bank
+                                   Fw::On onOff          //!< Indicates whether the blinking should be on or off
+                                   ) override;
+
+    //! Handler implementation for command BLINKING_ALL_ON_OFF
+    //!
+    //! Command to turn on or off the blinking of every LED of the bank
+    void BLINKING_ALL_ON_OFF_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                        U32 cmdSeq,           //!< The command sequence number
+                                        Fw::On onOff  //!< Indicates whether the blinking should be on or off
+                                        ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Copy the BLINK_INTERVALS parameter into the per-LED interval array
+        void
+        loadIntervals();
+
+    // The per-LED state is kept as a structure of arrays: the masks hold one bit per LED so that whole-bank decisions
+    // are single word operations, and the arrays are only walked for the LEDs that are actually blinking.
+    U32 m_intervals[LED_BANK_MAX_LEDS];  //! Blink interval of each LED in ticks
+    U32 m_counters[LED_BANK_MAX_LEDS];   //! Ticks since the last toggle of each LED
+    U64 m_ledMask;                       //! LEDs wired to the bank
+    U64 m_intervalMask = 0;              //! LEDs with a non-zero blink interval
+    U64 m_blinkingMask = 0;              //! LEDs commanded to blink
+    U64 m_stateMask = 0;                 //! LEDs currently lit
+    U64 m_transitions = 0;               //! The number of on/off transitions across the bank since FSW boot up
+    U8 m_ledCount;                       //! Number of LEDs wired to the bank
+    std::atomic<bool> m_intervalsStale;  //! Flag: set when the interval parameter changed and must be reloaded
+};
+
+}  // namespace Components
+
+#endif
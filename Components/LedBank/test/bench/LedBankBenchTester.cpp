@@ -0,0 +1,93 @@
+// ======================================================================
+// \title  LedBankBenchTester.cpp
+// \author ortega
+// \brief  cpp file for the LedBank component benchmark harness
+// ======================================================================
+
+#include "LedBankBenchTester.hpp"
+
+#include <chrono>
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+LedBankBenchTester ::LedBankBenchTester()
+    : LedBankGTestBase("LedBankBenchTester", LedBankBenchTester::MAX_HISTORY_SIZE), component("LedBank"), m_writes(0) {
+    this->initComponents();
+    this->connectPorts();
+    this->component.loadParameters();
+}
+
+LedBankBenchTester ::~LedBankBenchTester() {}
+
+// ----------------------------------------------------------------------
+// Benchmarks
+// ----------------------------------------------------------------------
+
+LedBankBenchTester::Result LedBankBenchTester ::benchTick(U8 ledCount, U64 ticks) {
+    this->component.configure(ledCount);
+    this->sendCmd_BLINKING_ALL_ON_OFF(0, 0, Fw::On::ON);
+    this->component.doDispatch();
+    this->clearHistory();
+    this->m_writes = 0;
+
+    // With the default interval of 1 every LED toggles on every tick
+    U64 elapsed = 0;
+    for (U64 done = 0; done < ticks; done += BATCH_SIZE) {
+        const U64 batch = FW_MIN(static_cast<U64>(BATCH_SIZE), ticks - done);
+        const auto start = std::chrono::steady_clock::now();
+        for (U64 i = 0; i < batch; i++) {
+            this->invoke_to_run(0, 0);
+            this->component.doDispatch();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        elapsed += static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        this->clearHistory();
+    }
+    Result result = {ledCount, ticks, 0.0, 0.0};
+    result.nsPerTick = static_cast<F64>(elapsed) / static_cast<F64>(ticks);
+    result.writesPerTick = static_cast<F64>(this->m_writes) / static_cast<F64>(ticks);
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+Drv::GpioStatus LedBankBenchTester ::from_gpioBankSet_handler(const NATIVE_INT_TYPE portNum, U64 mask, U64 values) {
+    this->m_writes++;
+    return Drv::GpioStatus::OP_OK;
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void LedBankBenchTester ::connectPorts() {
+    // Input ports of the component
+    this->connect_to_cmdIn(0, this->component.get_cmdIn_InputPort(0));
+    this->connect_to_run(0, this->component.get_run_InputPort(0));
+
+    // Output ports of the component
+    this->component.set_cmdRegOut_OutputPort(0, this->get_from_cmdRegOut(0));
+    this->component.set_cmdResponseOut_OutputPort(0, this->get_from_cmdResponseOut(0));
+    this->component.set_prmGetOut_OutputPort(0, this->get_from_prmGetOut(0));
+    this->component.set_prmSetOut_OutputPort(0, this->get_from_prmSetOut(0));
+    this->component.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
+    this->component.set_gpioBankSet_OutputPort(0, this->get_from_gpioBankSet(0));
+    this->component.set_logOut_OutputPort(0, this->get_from_logOut(0));
+#if FW_ENABLE_TEXT_LOGGING == 1
+    this->component.set_logTextOut_OutputPort(0, this->get_from_logTextOut(0));
+#endif
+    this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+}
+
+void LedBankBenchTester ::initComponents() {
+    this->init();
+    this->component.init(LedBankBenchTester::TEST_INSTANCE_QUEUE_DEPTH, LedBankBenchTester::TEST_INSTANCE_ID);
+}
+
+}  // namespace Components
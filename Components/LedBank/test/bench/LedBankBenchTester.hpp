@@ -0,0 +1,102 @@
+// ======================================================================
+// \title  LedBankBenchTester.hpp
+// \author ortega
+// \brief  hpp file for the LedBank component benchmark harness
+// ======================================================================
+
+#ifndef Components_LedBankBenchTester_HPP
+#define Components_LedBankBenchTester_HPP
+
+#include "Components/LedBank/LedBank.hpp"
+#include "Components/LedBank/LedBankGTestBase.hpp"
+
+namespace Components {
+
+//! Harness ticking a LedBank of a given size many times, to check that the tick cost stays flat with the bank size
+//!
+//! Histories are cleared between batches of ticks, outside of the timed regions, so they never fill up.
+class LedBankBenchTester : public LedBankGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Number of ticks timed between two history clears
+    static const U32 BATCH_SIZE = 100;
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 4 * BATCH_SIZE;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+    //! Result of the benchmark of one bank size
+    struct Result {
+        U8 ledCount;        //!< Number of LEDs of the bank
+        U64 ticks;          //!< Number of ticks timed
+        F64 nsPerTick;      //!< Mean time of a tick in nanoseconds, dispatch included
+        F64 writesPerTick;  //!< Mean number of GPIO bank writes per tick
+    };
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object LedBankBenchTester
+    LedBankBenchTester();
+
+    //! Destroy object LedBankBenchTester
+    ~LedBankBenchTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Benchmarks
+    // ----------------------------------------------------------------------
+
+    //! Tick a bank of the given size with every LED blinking on every tick, the worst case for the bank
+    Result benchTick(U8 ledCount,  //!< Number of LEDs, at most LED_BANK_MAX_LEDS
+                     U64 ticks     //!< Number of ticks to time
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_gpioBankSet
+    //!
+    Drv::GpioStatus from_gpioBankSet_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                             U64 mask,                        //!< The lines to write
+                                             U64 values                       //!< The values of the lines
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    LedBank component;
+
+    //! Number of GPIO bank writes since the start of the benchmark
+    U64 m_writes;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,59 @@
+// ======================================================================
+// \title  LedBankBenchmark.cpp
+// \author ortega
+// \brief  cpp file for the LedBank component benchmark main function
+//
+// Usage: Components_LedBank_bench <results.json> [ticks]
+//
+// Ticks banks of 1, 8, 32 and LED_BANK_MAX_LEDS LEDs with every LED blinking the given number of times (default
+// 100000), prints the time and GPIO writes per tick of each size and writes them as JSON to the given path. The time
+// per tick should stay flat with the bank size. It is a standalone executable: ctest does not run it.
+// ======================================================================
+
+#include "LedBankBenchTester.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if ((argc < 2) || (argc > 3)) {
+        (void)std::fprintf(stderr, "Usage: %s <results.json> [ticks]\n", argv[0]);
+        return 1;
+    }
+    const char* const jsonPath = argv[1];
+    const U64 ticks = (argc == 3) ? std::strtoull(argv[2], nullptr, 10) : 100000;
+    if (ticks == 0) {
+        (void)std::fprintf(stderr, "The tick count must be a positive integer\n");
+        return 1;
+    }
+
+    // A fresh component per bank size keeps their state independent
+    const U8 bankSizes[] = {1, 8, 32, Components::LED_BANK_MAX_LEDS};
+    std::vector<Components::LedBankBenchTester::Result> results;
+    for (const U8 ledCount : bankSizes) {
+        Components::LedBankBenchTester tester;
+        results.push_back(tester.benchTick(ledCount, ticks));
+    }
+
+    FILE* json = std::fopen(jsonPath, "w");
+    if (json == nullptr) {
+        (void)std::fprintf(stderr, "Cannot open %s\n", jsonPath);
+        return 1;
+    }
+    (void)std::fprintf(json, "{\n  \"component\": \"LedBank\",\n  \"ticks\": %llu,\n  \"results\": [\n",
+                       static_cast<unsigned long long>(ticks));
+    (void)std::printf("LEDs  writes/tick  ns/tick\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Components::LedBankBenchTester::Result& result = results[i];
+        (void)std::printf("%4u  %11.2f  %7.1f\n", static_cast<unsigned int>(result.ledCount), result.writesPerTick,
+                          result.nsPerTick);
+        (void)std::fprintf(json, "    {\"leds\": %u, \"ns_per_tick\": %.1f, \"writes_per_tick\": %.2f}%s\n",
+                           static_cast<unsigned int>(result.ledCount), result.nsPerTick, result.writesPerTick,
+                           (i + 1 < results.size()) ? "," : "");
+    }
+    (void)std::fprintf(json, "  ]\n}\n");
+    (void)std::fclose(json);
+    (void)std::printf("results written to %s\n", jsonPath);
+    return 0;
+}
@@ -0,0 +1,32 @@
+// ======================================================================
+// \title  LedBankTestMain.cpp
+// \author ortega
+// \brief  cpp file for LedBank component test main function
+// ======================================================================
+
+#include "LedBankTester.hpp"
+
+TEST(Nominal, TestBlinking) {
+    Components::LedBankTester tester;
+    tester.testBlinking();
+}
+
+TEST(Nominal, TestBlinkIntervals) {
+    Components::LedBankTester tester;
+    tester.testBlinkIntervals();
+}
+
+TEST(OffNominal, TestInvalidLed) {
+    Components::LedBankTester tester;
+    tester.testInvalidLed();
+}
+
+TEST(Scaling, TestOneWritePerTick) {
+    Components::LedBankTester tester;
+    tester.testOneWritePerTick();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+// ======================================================================
+// \title  LedBankTester.hpp
+// \author ortega
+// \brief  hpp file for LedBank component test harness implementation class
+// ======================================================================
+
+#ifndef Components_LedBankTester_HPP
+#define Components_LedBankTester_HPP
+
+#include "Components/LedBank/LedBank.hpp"
+#include "Components/LedBank/LedBankGTestBase.hpp"
+
+namespace Components {
+
+class LedBankTester : public LedBankGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 100;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object LedBankTester
+    LedBankTester();
+
+    //! Destroy object LedBankTester
+    ~LedBankTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void testBlinking();
+    void testBlinkIntervals();
+    void testInvalidLed();
+    void testOneWritePerTick();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_gpioBankSet
+    //!
+    Drv::GpioStatus from_gpioBankSet_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                             U64 mask,
+                                             U64 values);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! Invoke the run port and dispatch the resulting message
+    void tick();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    LedBank component;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,97 @@
+// ======================================================================
+// \title  LinuxGpioBankDriver.cpp
+// \author ortega
+// \brief  cpp file for LinuxGpioBankDriver component implementation class
+// ======================================================================
+
+#include "Components/LinuxGpioBankDriver/LinuxGpioBankDriver.hpp"
+#include "FpConfig.hpp"
+
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace Components {
+
+static_assert(LinuxGpioBankDriver::MAX_LINES == GPIO_V2_LINES_MAX, "Bank width must match the kernel line limit");
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+LinuxGpioBankDriver ::LinuxGpioBankDriver(const char* const compName) : LinuxGpioBankDriverComponentBase(compName) {}
+
+LinuxGpioBankDriver ::~LinuxGpioBankDriver() {
+    if (this->m_fd >= 0) {
+        (void)::close(this->m_fd);
+    }
+}
+
+Os::File::Status LinuxGpioBankDriver ::open(const char* device, const U32* lines, U32 lineCount) {
+    FW_ASSERT(device != nullptr);
+    FW_ASSERT(lines != nullptr);
+    FW_ASSERT((lineCount > 0) && (lineCount <= MAX_LINES), static_cast<FwAssertArgType>(lineCount));
+    Fw::LogStringArg chip(device);
+
+    const int chipFd = ::open(device, O_RDWR | O_CLOEXEC);
+    if (chipFd < 0) {
+        this->log_WARNING_HI_OpenChipError(chip, errno);
+        return Os::File::Status::DOESNT_EXIST;
+    }
+
+    // One v2 line request covers every line of the bank, so a single SET_VALUES ioctl updates all of them
+    struct gpio_v2_line_request request;
+    ::memset(&request, 0, sizeof(request));
+    for (U32 i = 0; i < lineCount; i++) {
+        request.offsets[i] = lines[i];
+    }
+    request.num_lines = lineCount;
+    request.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    (void)::strncpy(request.consumer, "LedBlinker", sizeof(request.consumer) - 1);
+
+    const int status = ::ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request);
+    const int requestErrno = errno;
+    // The line request holds its own reference to the chip
+    (void)::close(chipFd);
+    if (status < 0) {
+        this->log_WARNING_HI_LineRequestError(chip, lineCount, requestErrno);
+        return Os::File::Status::NO_PERMISSION;
+    }
+
+    if (this->m_fd >= 0) {
+        (void)::close(this->m_fd);
+    }
+    this->m_fd = request.fd;
+    this->m_lineCount = lineCount;
+    this->log_ACTIVITY_HI_OpenBank(chip, lineCount);
+    return Os::File::Status::OP_OK;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+Drv::GpioStatus LinuxGpioBankDriver ::gpioBankWrite_handler(FwIndexType portNum, U64 mask, U64 values) {
+    if (this->m_fd < 0) {
+        return Drv::GpioStatus::NOT_OPENED;
+    }
+    // Bits beyond the requested lines would be rejected by the kernel
+    const U64 lineMask = (this->m_lineCount == MAX_LINES) ? ~static_cast<U64>(0)
+                                                          : ((static_cast<U64>(1) << this->m_lineCount) - 1);
+    struct gpio_v2_line_values lineValues;
+    lineValues.bits = values & lineMask;
+    lineValues.mask = mask & lineMask;
+    if (lineValues.mask == 0) {
+        return Drv::GpioStatus::OP_OK;
+    }
+    if (::ioctl(this->m_fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &lineValues) < 0) {
+        this->log_WARNING_HI_WriteError(errno);
+        return Drv::GpioStatus::UNKNOWN_ERROR;
+    }
+    return Drv::GpioStatus::OP_OK;
+}
+
+}  // namespace Components
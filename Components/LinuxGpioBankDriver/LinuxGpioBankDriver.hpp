@@ -0,0 +1,60 @@
+// ======================================================================
+// \title  LinuxGpioBankDriver.hpp
+// \author ortega
+// \brief  hpp file for LinuxGpioBankDriver component implementation class
+// ======================================================================
+
+#ifndef Components_LinuxGpioBankDriver_HPP
+#define Components_LinuxGpioBankDriver_HPP
+
+#include "Components/LinuxGpioBankDriver/LinuxGpioBankDriverComponentAc.hpp"
+#include "Os/File.hpp"
+
+namespace Components {
+
+class LinuxGpioBankDriver : public LinuxGpioBankDriverComponentBase {
+  public:
+    //! Maximum number of lines in one bank, matching GPIO_V2_LINES_MAX and the width of the port masks
+    static const U32 MAX_LINES = 64;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct LinuxGpioBankDriver object
+    LinuxGpioBankDriver(const char* const compName  //!< The component name
+    );
+
+    //! Destroy LinuxGpioBankDriver object
+    ~LinuxGpioBankDriver();
+
+    //! Open a chip and request a set of its lines as outputs
+    //!
+    //! All lines are placed in a single line request. Bit N of the gpioBankWrite masks refers to lines[N].
+    //!
+    //! \return OP_OK on success, an error status otherwise
+    Os::File::Status open(const char* device,  //!< GPIO chip device, e.g. /dev/gpiochip0
+                          const U32* lines,    //!< Chip line offsets making up the bank
+                          U32 lineCount        //!< Number of entries in lines, at most MAX_LINES
+    );
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for gpioBankWrite
+    //!
+    //! Port setting the lines of the bank selected by a mask
+    Drv::GpioStatus gpioBankWrite_handler(FwIndexType portNum,  //!< The port number
+                                          U64 mask,             //!< Lines to update
+                                          U64 values            //!< Line levels
+                                          ) override;
+
+    int m_fd = -1;        //! File descriptor of the line request, -1 when not opened
+    U32 m_lineCount = 0;  //! Number of lines held by the line request
+};
+
+}  // namespace Components
+
+#endif
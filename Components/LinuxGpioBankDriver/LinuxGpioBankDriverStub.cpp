@@ -0,0 +1,35 @@
+// ======================================================================
+// \title  LinuxGpioBankDriverStub.cpp
+// \author ortega
+// \brief  cpp file for LinuxGpioBankDriver on platforms without the Linux GPIO character device
+// ======================================================================
+
+#include "Components/LinuxGpioBankDriver/LinuxGpioBankDriver.hpp"
+#include "FpConfig.hpp"
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+LinuxGpioBankDriver ::LinuxGpioBankDriver(const char* const compName) : LinuxGpioBankDriverComponentBase(compName) {}
+
+LinuxGpioBankDriver ::~LinuxGpioBankDriver() {}
+
+Os::File::Status LinuxGpioBankDriver ::open(const char* device, const U32* lines, U32 lineCount) {
+    FW_ASSERT(device != nullptr);
+    Fw::LogStringArg chip(device);
+    this->log_WARNING_HI_OpenChipError(chip, 0);
+    return Os::File::Status::NOT_SUPPORTED;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+Drv::GpioStatus LinuxGpioBankDriver ::gpioBankWrite_handler(FwIndexType portNum, U64 mask, U64 values) {
+    return Drv::GpioStatus::NOT_OPENED;
+}
+
+}  // namespace Components
@@ -0,0 +1,528 @@
+// ======================================================================
+// \title  LogPrmDb.cpp
+// \author ortega
+// \brief  cpp file for LogPrmDb component implementation class
+// ======================================================================
+
+#include "Components/LogPrmDb/LogPrmDb.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Fw/Types/StringUtils.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+namespace Components {
+
+const U32 LogPrmDb::LOG_MAGIC;
+const U8 LogPrmDb::LOG_VERSION;
+const U32 LogPrmDb::LOG_HEADER_SIZE;
+const U8 LogPrmDb::RECORD_DELIMITER;
+const U32 LogPrmDb::RECORD_HEADER_SIZE;
+const U32 LogPrmDb::RECORD_MAX_SIZE;
+const U32 LogPrmDb::COMPACT_MIN_SIZE;
+const U32 LogPrmDb::COMPACT_RATIO;
+
+namespace {
+
+//! A file mapped read-only for the duration of a load
+class MappedFile {
+  public:
+    MappedFile() {}
+    ~MappedFile() {
+        if (this->m_data != nullptr) {
+            (void)munmap(this->m_data, this->m_size);
+        }
+        if (this->m_fd >= 0) {
+            (void)close(this->m_fd);
+        }
+    }
+
+    //! Map a whole file. An empty file maps to no data.
+    //!
+    //! \return 0 when mapped, the error number otherwise
+    int map(const char* fileName) {
+        this->m_fd = ::open(fileName, O_RDONLY);
+        if (this->m_fd < 0) {
+            return errno;
+        }
+        struct stat status;
+        if (fstat(this->m_fd, &status) != 0) {
+            return errno;
+        }
+        if (static_cast<U64>(status.st_size) > 0xFFFFFFFFULL) {
+            return EFBIG;
+        }
+        this->m_size = static_cast<U32>(status.st_size);
+        if (this->m_size > 0) {
+            void* const address = mmap(nullptr, this->m_size, PROT_READ, MAP_PRIVATE, this->m_fd, 0);
+            if (address == MAP_FAILED) {
+                return errno;
+            }
+            this->m_data = address;
+        }
+        return 0;
+    }
+
+    //! \return the mapped bytes, nullptr for an empty file
+    const U8* data() const { return static_cast<const U8*>(this->m_data); }
+
+    //! \return the size of the file
+    U32 size() const { return this->m_size; }
+
+  private:
+    int m_fd = -1;
+    void* m_data = nullptr;
+    U32 m_size = 0;
+};
+
+//! Point a serialize buffer at size bytes of a mapped file for reading. They are never written through it.
+void setReader(Fw::ExternalSerializeBuffer& buffer, const U8* data, U32 size) {
+    buffer.setExtBuffer(const_cast<U8*>(data), size);
+    (void)buffer.setBuffLen(size);
+}
+
+//! Write a whole buffer, resuming after partial writes
+//!
+//! \return 0 when written, the error number otherwise
+int writeAll(int fd, const U8* data, U32 size) {
+    while (size > 0) {
+        const ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        data += written;
+        size -= static_cast<U32>(written);
+    }
+    return 0;
+}
+
+//! Make a rename in the directory of a file durable
+void syncDirectory(const char* fileName) {
+    char directory[100];
+    (void)Fw::StringUtils::string_copy(directory, fileName, sizeof(directory));
+    char* const slash = strrchr(directory, '/');
+    if (slash == nullptr) {
+        (void)Fw::StringUtils::string_copy(directory, ".", sizeof(directory));
+    } else if (slash == directory) {
+        slash[1] = '\0';
+    } else {
+        slash[0] = '\0';
+    }
+    const int fd = ::open(directory, O_RDONLY);
+    if (fd >= 0) {
+        (void)fsync(fd);
+        (void)close(fd);
+    }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+LogPrmDb ::LogPrmDb(const char* const compName) : LogPrmDbComponentBase(compName) {
+    this->m_logFile[0] = '\0';
+    this->m_tempFile[0] = '\0';
+    this->m_legacyFile[0] = '\0';
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        this->m_entries[index].used = false;
+        this->m_entries[index].dirty = false;
+        this->m_entries[index].id = 0;
+    }
+}
+
+LogPrmDb ::~LogPrmDb() {}
+
+void LogPrmDb ::configure(const char* logFile, const char* legacyFile) {
+    FW_ASSERT(logFile != nullptr);
+    (void)Fw::StringUtils::string_copy(this->m_logFile, logFile, sizeof(this->m_logFile));
+    (void)snprintf(this->m_tempFile, sizeof(this->m_tempFile), "%s.tmp", this->m_logFile);
+    if (legacyFile != nullptr) {
+        (void)Fw::StringUtils::string_copy(this->m_legacyFile, legacyFile, sizeof(this->m_legacyFile));
+    } else {
+        this->m_legacyFile[0] = '\0';
+    }
+}
+
+void LogPrmDb ::readParamFile() {
+    FW_ASSERT(this->m_logFile[0] != '\0');
+    this->lock();
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        this->m_entries[index].used = false;
+        this->m_entries[index].dirty = false;
+    }
+    this->m_logSize = 0;
+    this->m_rewrite = false;
+
+    MappedFile log;
+    const int error = log.map(this->m_logFile);
+    if ((error == ENOENT) || ((error == 0) && (log.size() == 0))) {
+        this->unLock();
+        // No log yet: start from the Svc.PrmDb file, written to the log right away so it is only imported once
+        if ((this->m_legacyFile[0] != '\0') && this->importLegacy()) {
+            (void)this->compact();
+        }
+        this->reportTelemetry();
+        return;
+    }
+    if (error != 0) {
+        // The unreadable log is replaced by the next save
+        this->m_rewrite = true;
+        this->unLock();
+        this->log_WARNING_HI_PrmFileReadError(Fw::String(this->m_logFile), static_cast<I32>(error));
+        this->reportTelemetry();
+        return;
+    }
+
+    U32 magic = 0;
+    U8 version = 0;
+    Fw::ExternalSerializeBuffer header;
+    setReader(header, log.data(), FW_MIN(log.size(), LOG_HEADER_SIZE));
+    Fw::SerializeStatus status = header.deserialize(magic);
+    status = (status == Fw::FW_SERIALIZE_OK) ? header.deserialize(version) : status;
+    if ((status != Fw::FW_SERIALIZE_OK) || (magic != LOG_MAGIC) || (version != LOG_VERSION)) {
+        // Not a log this component can append to: it is replaced by the next save
+        this->m_rewrite = true;
+        this->unLock();
+        this->log_WARNING_HI_PrmFileReadError(Fw::String(this->m_logFile), -1);
+        this->reportTelemetry();
+        return;
+    }
+
+    U32 records = 0;
+    const U32 valid = this->replay(log.data(), log.size(), records);
+    this->m_logSize = valid;
+    U32 parameters = 0;
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        parameters += this->m_entries[index].used ? 1 : 0;
+    }
+    this->unLock();
+
+    if (valid < log.size()) {
+        // A save cut short leaves a partial record at the end; appending after it would hide the records that follow
+        if (truncate(this->m_logFile, static_cast<off_t>(valid)) == 0) {
+            this->log_WARNING_HI_PrmFileTruncated(Fw::String(this->m_logFile), valid, log.size() - valid);
+        } else {
+            this->m_rewrite = true;
+            this->log_WARNING_HI_PrmFileWriteError(Fw::String(this->m_logFile), static_cast<I32>(errno));
+        }
+    }
+    this->log_ACTIVITY_HI_PrmFileLoaded(Fw::String(this->m_logFile), records, parameters);
+    this->reportTelemetry();
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+Fw::ParamValid LogPrmDb ::getPrm_handler(FwIndexType portNum, FwPrmIdType id, Fw::ParamBuffer& val) {
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        const Entry& entry = this->m_entries[index];
+        if (entry.used && (entry.id == id)) {
+            val = entry.value;
+            return Fw::ParamValid::VALID;
+        }
+    }
+    this->log_WARNING_LO_PrmIdNotFound(id);
+    return Fw::ParamValid::INVALID;
+}
+
+void LogPrmDb ::setPrm_handler(FwIndexType portNum, FwPrmIdType id, Fw::ParamBuffer& val) {
+    this->lock();
+    const StoreStatus status = this->store(id, val.getBuffAddr(), static_cast<U32>(val.getBuffLength()), true);
+    this->unLock();
+    switch (status) {
+        case STORE_UPDATED:
+            this->log_ACTIVITY_HI_PrmIdUpdated(id);
+            break;
+        case STORE_ADDED:
+            this->log_ACTIVITY_HI_PrmIdAdded(id);
+            break;
+        default:
+            this->log_FATAL_PrmDbFull(id);
+            break;
+    }
+    this->reportTelemetry();
+}
+
+void LogPrmDb ::pingIn_handler(FwIndexType portNum, U32 key) {
+    this->pingOut_out(0, key);
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void LogPrmDb ::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    // Values only change on this thread, so the entries are read without the lock taken by getPrm callers
+    bool saved = false;
+    if (this->m_rewrite) {
+        saved = this->compact();
+    } else {
+        U32 records = 0;
+        saved = this->appendChanged(records);
+        if (saved) {
+            this->log_ACTIVITY_HI_PrmFileSaveComplete(records, this->m_logSize);
+            const U32 compacted = this->compactedSize();
+            if ((this->m_logSize > COMPACT_MIN_SIZE) && (this->m_logSize > (COMPACT_RATIO * compacted))) {
+                // Already saved: a failed compaction leaves the appended log in place
+                (void)this->compact();
+            }
+        }
+    }
+    this->reportTelemetry();
+    this->cmdResponse_out(opCode, cmdSeq, saved ? Fw::CmdResponse::OK : Fw::CmdResponse::EXECUTION_ERROR);
+}
+
+void LogPrmDb ::PRM_COMPACT_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    const bool compacted = this->compact();
+    this->reportTelemetry();
+    this->cmdResponse_out(opCode, cmdSeq, compacted ? Fw::CmdResponse::OK : Fw::CmdResponse::EXECUTION_ERROR);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+LogPrmDb::StoreStatus LogPrmDb ::store(FwPrmIdType id, const U8* value, U32 size, bool dirty) {
+    FW_ASSERT(size <= FW_PARAM_BUFFER_MAX_SIZE, static_cast<FwAssertArgType>(size));
+    Entry* empty = nullptr;
+    Entry* target = nullptr;
+    for (U32 index = 0; (index < LOG_PRM_DB_MAX_ENTRIES) && (target == nullptr); index++) {
+        Entry& entry = this->m_entries[index];
+        if (entry.used && (entry.id == id)) {
+            target = &entry;
+        } else if (!entry.used && (empty == nullptr)) {
+            empty = &entry;
+        }
+    }
+    StoreStatus status = STORE_UPDATED;
+    if (target == nullptr) {
+        if (empty == nullptr) {
+            return STORE_FULL;
+        }
+        target = empty;
+        target->used = true;
+        target->id = id;
+        status = STORE_ADDED;
+    }
+    (void)memcpy(target->value.getBuffAddr(), value, size);
+    const Fw::SerializeStatus lengthStatus = target->value.setBuffLen(size);
+    FW_ASSERT(lengthStatus == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(lengthStatus));
+    target->dirty = dirty;
+    return status;
+}
+
+U32 LogPrmDb ::replay(const U8* data, U32 size, U32& records) {
+    records = 0;
+    U32 offset = LOG_HEADER_SIZE;
+    while ((size - offset) >= RECORD_HEADER_SIZE) {
+        const U8* const record = &data[offset];
+        U8 delimiter = 0;
+        FwPrmIdType id = 0;
+        U16 valueSize = 0;
+        Fw::ExternalSerializeBuffer header;
+        setReader(header, record, RECORD_HEADER_SIZE);
+        Fw::SerializeStatus status = header.deserialize(delimiter);
+        status = (status == Fw::FW_SERIALIZE_OK) ? header.deserialize(id) : status;
+        status = (status == Fw::FW_SERIALIZE_OK) ? header.deserialize(valueSize) : status;
+        if ((status != Fw::FW_SERIALIZE_OK) || (delimiter != RECORD_DELIMITER) ||
+            (valueSize > FW_PARAM_BUFFER_MAX_SIZE) ||
+            ((size - offset) < (RECORD_HEADER_SIZE + valueSize + HASH_DIGEST_LENGTH))) {
+            break;
+        }
+        Utils::HashBuffer digest;
+        Utils::Hash::hash(record, static_cast<NATIVE_INT_TYPE>(RECORD_HEADER_SIZE + valueSize), digest);
+        if (memcmp(digest.getBuffAddr(), &record[RECORD_HEADER_SIZE + valueSize], HASH_DIGEST_LENGTH) != 0) {
+            break;
+        }
+        // A parameter the database has no room for is reported when set, so replay just skips it
+        (void)this->store(id, &record[RECORD_HEADER_SIZE], valueSize, false);
+        records++;
+        offset += RECORD_HEADER_SIZE + valueSize + HASH_DIGEST_LENGTH;
+    }
+    return offset;
+}
+
+bool LogPrmDb ::importLegacy() {
+    MappedFile legacy;
+    const int error = legacy.map(this->m_legacyFile);
+    if (error != 0) {
+        // Nothing to import on a first boot
+        if (error != ENOENT) {
+            this->log_WARNING_HI_PrmFileReadError(Fw::String(this->m_legacyFile), static_cast<I32>(error));
+        }
+        return false;
+    }
+
+    // Svc.PrmDb records: delimiter, U32 size of the ID and value, ID, value
+    const U32 legacyHeaderSize = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType);
+    U32 parameters = 0;
+    U32 offset = 0;
+    bool malformed = false;
+    this->lock();
+    while ((offset < legacy.size()) && !malformed) {
+        const U8* const record = &legacy.data()[offset];
+        U8 delimiter = 0;
+        U32 recordSize = 0;
+        FwPrmIdType id = 0;
+        Fw::ExternalSerializeBuffer header;
+        setReader(header, record, FW_MIN(legacy.size() - offset, legacyHeaderSize));
+        Fw::SerializeStatus status = header.deserialize(delimiter);
+        status = (status == Fw::FW_SERIALIZE_OK) ? header.deserialize(recordSize) : status;
+        status = (status == Fw::FW_SERIALIZE_OK) ? header.deserialize(id) : status;
+        malformed = (status != Fw::FW_SERIALIZE_OK) || (delimiter != RECORD_DELIMITER) ||
+                    (recordSize < sizeof(FwPrmIdType)) ||
+                    ((recordSize - sizeof(FwPrmIdType)) > FW_PARAM_BUFFER_MAX_SIZE) ||
+                    ((legacy.size() - offset - sizeof(U8) - sizeof(U32)) < recordSize);
+        if (!malformed) {
+            const U32 valueSize = recordSize - static_cast<U32>(sizeof(FwPrmIdType));
+            // Saved to the log by the compaction following the import
+            if (this->store(id, &record[legacyHeaderSize], valueSize, true) != STORE_FULL) {
+                parameters++;
+            }
+            offset += legacyHeaderSize + valueSize;
+        }
+    }
+    this->unLock();
+    if (malformed) {
+        this->log_WARNING_HI_PrmFileReadError(Fw::String(this->m_legacyFile), -1);
+    }
+    this->log_ACTIVITY_HI_PrmFileImported(Fw::String(this->m_legacyFile), parameters);
+    return true;
+}
+
+U32 LogPrmDb ::serializeRecord(const Entry& entry, U8* record) {
+    const U32 valueSize = static_cast<U32>(entry.value.getBuffLength());
+    Fw::ExternalSerializeBuffer header(record, RECORD_HEADER_SIZE);
+    Fw::SerializeStatus status = header.serialize(RECORD_DELIMITER);
+    status = (status == Fw::FW_SERIALIZE_OK) ? header.serialize(entry.id) : status;
+    status = (status == Fw::FW_SERIALIZE_OK) ? header.serialize(static_cast<U16>(valueSize)) : status;
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    (void)memcpy(&record[RECORD_HEADER_SIZE], entry.value.getBuffAddr(), valueSize);
+
+    // The hash lets a load tell a complete record from one cut short by a power loss
+    Utils::HashBuffer digest;
+    Utils::Hash::hash(record, static_cast<NATIVE_INT_TYPE>(RECORD_HEADER_SIZE + valueSize), digest);
+    (void)memcpy(&record[RECORD_HEADER_SIZE + valueSize], digest.getBuffAddr(), HASH_DIGEST_LENGTH);
+    return RECORD_HEADER_SIZE + valueSize + HASH_DIGEST_LENGTH;
+}
+
+bool LogPrmDb ::appendChanged(U32& records) {
+    records = 0;
+    U32 size = 0;
+    if (this->m_logSize == 0) {
+        Fw::ExternalSerializeBuffer header(this->m_records, LOG_HEADER_SIZE);
+        Fw::SerializeStatus status = header.serialize(LOG_MAGIC);
+        status = (status == Fw::FW_SERIALIZE_OK) ? header.serialize(LOG_VERSION) : status;
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        size = LOG_HEADER_SIZE;
+    }
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        const Entry& entry = this->m_entries[index];
+        if (entry.used && entry.dirty) {
+            size += serializeRecord(entry, &this->m_records[size]);
+            records++;
+        }
+    }
+    if (size == 0) {
+        return true;
+    }
+
+    const int fd = ::open(this->m_logFile, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    int error = (fd < 0) ? errno : 0;
+    if (error == 0) {
+        error = writeAll(fd, this->m_records, size);
+        // The records are only counted as saved once they are on the storage
+        if ((error == 0) && (fsync(fd) != 0)) {
+            error = errno;
+        }
+        // A failed write may leave a partial record, truncated away by the next load
+        const off_t end = lseek(fd, 0, SEEK_END);
+        this->m_logSize = (end > 0) ? static_cast<U32>(end) : this->m_logSize;
+        (void)close(fd);
+    }
+    if (error != 0) {
+        this->m_rewrite = true;
+        this->log_WARNING_HI_PrmFileWriteError(Fw::String(this->m_logFile), static_cast<I32>(error));
+        return false;
+    }
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        this->m_entries[index].dirty = false;
+    }
+    return true;
+}
+
+bool LogPrmDb ::compact() {
+    Fw::ExternalSerializeBuffer header(this->m_records, LOG_HEADER_SIZE);
+    Fw::SerializeStatus status = header.serialize(LOG_MAGIC);
+    status = (status == Fw::FW_SERIALIZE_OK) ? header.serialize(LOG_VERSION) : status;
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    U32 size = LOG_HEADER_SIZE;
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        if (this->m_entries[index].used) {
+            size += serializeRecord(this->m_entries[index], &this->m_records[size]);
+        }
+    }
+
+    // The log is replaced in one rename, so a power loss leaves either the old log or the new one
+    const int fd = ::open(this->m_tempFile, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    int error = (fd < 0) ? errno : 0;
+    if (error == 0) {
+        error = writeAll(fd, this->m_records, size);
+        if ((error == 0) && (fsync(fd) != 0)) {
+            error = errno;
+        }
+        (void)close(fd);
+    }
+    if ((error == 0) && (rename(this->m_tempFile, this->m_logFile) != 0)) {
+        error = errno;
+    }
+    if (error != 0) {
+        (void)unlink(this->m_tempFile);
+        this->log_WARNING_HI_PrmFileWriteError(Fw::String(this->m_logFile), static_cast<I32>(error));
+        return false;
+    }
+    syncDirectory(this->m_logFile);
+
+    const U32 before = this->m_logSize;
+    this->m_logSize = size;
+    this->m_rewrite = false;
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        this->m_entries[index].dirty = false;
+    }
+    this->log_ACTIVITY_HI_PrmFileCompacted(before, size);
+    return true;
+}
+
+U32 LogPrmDb ::compactedSize() const {
+    U32 size = LOG_HEADER_SIZE;
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        const Entry& entry = this->m_entries[index];
+        if (entry.used) {
+            size += RECORD_HEADER_SIZE + static_cast<U32>(entry.value.getBuffLength()) + HASH_DIGEST_LENGTH;
+        }
+    }
+    return size;
+}
+
+void LogPrmDb ::reportTelemetry() {
+    U32 parameters = 0;
+    for (U32 index = 0; index < LOG_PRM_DB_MAX_ENTRIES; index++) {
+        parameters += this->m_entries[index].used ? 1 : 0;
+    }
+    this->tlmWrite_PrmLogSize(this->m_logSize);
+    this->tlmWrite_PrmCount(parameters);
+}
+
+}  // namespace Components
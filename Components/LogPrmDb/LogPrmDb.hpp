@@ -0,0 +1,180 @@
+// ======================================================================
+// \title  LogPrmDb.hpp
+// \author ortega
+// \brief  hpp file for LogPrmDb component implementation class
+// ======================================================================
+
+#ifndef Components_LogPrmDb_HPP
+#define Components_LogPrmDb_HPP
+
+#include "Components/LogPrmDb/FppConstantsAc.hpp"
+#include "Components/LogPrmDb/LogPrmDbComponentAc.hpp"
+#include "Fw/Prm/PrmBuffer.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+namespace Components {
+
+class LogPrmDb : public LogPrmDbComponentBase {
+  public:
+    //! Magic number opening the log file, "LPRM"
+    static const U32 LOG_MAGIC = 0x4C50524D;
+
+    //! Version of the log file layout
+    static const U8 LOG_VERSION = 1;
+
+    //! Size of the log file header: magic and version
+    static const U32 LOG_HEADER_SIZE = sizeof(U32) + sizeof(U8);
+
+    //! Byte opening every record, as in Svc.PrmDb files
+    static const U8 RECORD_DELIMITER = 0xA5;
+
+    //! Size of the record fields before the value: delimiter, parameter ID and value size
+    static const U32 RECORD_HEADER_SIZE = sizeof(U8) + sizeof(FwPrmIdType) + sizeof(U16);
+
+    //! Size of the largest record: header, value and hash of both
+    static const U32 RECORD_MAX_SIZE = RECORD_HEADER_SIZE + FW_PARAM_BUFFER_MAX_SIZE + HASH_DIGEST_LENGTH;
+
+    //! Log size below which the log is never compacted, in bytes
+    static const U32 COMPACT_MIN_SIZE = 4096;
+
+    //! The log is compacted once it is this many times the size of a compacted log
+    static const U32 COMPACT_RATIO = 4;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct LogPrmDb object
+    LogPrmDb(const char* const compName  //!< The component name
+    );
+
+    //! Destroy LogPrmDb object
+    ~LogPrmDb();
+
+    //! Set the files of the database
+    void configure(const char* logFile,              //!< The log file holding the parameters
+                   const char* legacyFile = nullptr  //!< Svc.PrmDb file imported when there is no log file yet
+    );
+
+    //! Load the parameters: map the log file and replay it, or import the Svc.PrmDb file when there is no log file.
+    //! Partial records at the end of the log are dropped and truncated away. Call before the parameters are loaded.
+    void readParamFile();
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for getPrm
+        Fw::ParamValid
+        getPrm_handler(FwIndexType portNum,  //!< The port number
+                       FwPrmIdType id,       //!< The parameter ID
+                       Fw::ParamBuffer& val  //!< Receives the serialized value
+                       ) override;
+
+    //! Handler implementation for setPrm
+    void setPrm_handler(FwIndexType portNum,  //!< The port number
+                        FwPrmIdType id,       //!< The parameter ID
+                        Fw::ParamBuffer& val  //!< The serialized value
+                        ) override;
+
+    //! Handler implementation for pingIn
+    void pingIn_handler(FwIndexType portNum,  //!< The port number
+                        U32 key               //!< Value to return to pinger
+                        ) override;
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for commands
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for command PRM_SAVE_FILE
+        //!
+        //! Appends a record for each parameter changed since the last save, then compacts the log when it grew past
+        //! COMPACT_RATIO times its compacted size
+        void
+        PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                 U32 cmdSeq            //!< The command sequence number
+                                 ) override;
+
+    //! Handler implementation for command PRM_COMPACT_FILE
+    //!
+    //! Rewrites the log with one record per parameter
+    void PRM_COMPACT_FILE_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                     U32 cmdSeq            //!< The command sequence number
+                                     ) override;
+
+    PRIVATE :
+        //! One parameter of the database
+        struct Entry {
+            bool used;              //!< The entry holds a parameter
+            bool dirty;             //!< Changed since the last save
+            FwPrmIdType id;         //!< The parameter ID
+            Fw::ParamBuffer value;  //!< The serialized value
+        };
+
+    //! Outcome of storing a parameter value
+    enum StoreStatus { STORE_UPDATED, STORE_ADDED, STORE_FULL };
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Store a parameter value, adding the parameter when new. Call with the lock held.
+    StoreStatus store(FwPrmIdType id,   //!< The parameter ID
+                      const U8* value,  //!< The serialized value
+                      U32 size,         //!< Size of the value, at most FW_PARAM_BUFFER_MAX_SIZE
+                      bool dirty        //!< Whether the value still has to be saved
+    );
+
+    //! Replay the records of a mapped log file, after its header
+    //!
+    //! \return the size of the valid part of the file; records past it are partial or corrupt
+    U32 replay(const U8* data,  //!< The mapped file
+               U32 size,        //!< Size of the file
+               U32& records     //!< Receives the number of records replayed
+    );
+
+    //! Import the parameters of the Svc.PrmDb file
+    //!
+    //! \return true when the file was read
+    bool importLegacy();
+
+    //! Serialize the record of an entry
+    //!
+    //! \return the size of the record
+    static U32 serializeRecord(const Entry& entry,  //!< The entry
+                               U8* record           //!< Receives the record, at least RECORD_MAX_SIZE bytes
+    );
+
+    //! Append the records of the changed parameters to the log file
+    //!
+    //! \return true when appended, false after a write error event
+    bool appendChanged(U32& records  //!< Receives the number of records appended
+    );
+
+    //! Rewrite the log file with one record per parameter, through a temporary file renamed over it
+    //!
+    //! \return true when rewritten, false after a write error event
+    bool compact();
+
+    //! \return the size of the log file once compacted
+    U32 compactedSize() const;
+
+    //! Report the log size and the parameter count
+    void reportTelemetry();
+
+    char m_logFile[100];                          //! The log file
+    char m_tempFile[104];                         //! Temporary file written by compaction
+    char m_legacyFile[100];                       //! Svc.PrmDb file to import, empty for none
+    Entry m_entries[LOG_PRM_DB_MAX_ENTRIES];      //! The parameters
+    U32 m_logSize = 0;                            //! Size of the log file, 0 when there is none
+    bool m_rewrite = false;                       //! The log must be rewritten before anything is appended to it
+    U8 m_records[LOG_HEADER_SIZE + LOG_PRM_DB_MAX_ENTRIES * RECORD_MAX_SIZE];  //! Records being written
+};
+
+}  // namespace Components
+
+#endif
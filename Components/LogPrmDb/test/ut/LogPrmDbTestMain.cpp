@@ -0,0 +1,37 @@
+// ======================================================================
+// \title  LogPrmDbTestMain.cpp
+// \author ortega
+// \brief  cpp file for LogPrmDb component test main function
+// ======================================================================
+
+#include "LogPrmDbTester.hpp"
+
+TEST(Nominal, TestSaveAndReplay) {
+    Components::LogPrmDbTester tester;
+    tester.testSaveAndReplay();
+}
+
+TEST(Nominal, TestAppendChanged) {
+    Components::LogPrmDbTester tester;
+    tester.testAppendChanged();
+}
+
+TEST(OffNominal, TestTornRecord) {
+    Components::LogPrmDbTester tester;
+    tester.testTornRecord();
+}
+
+TEST(Nominal, TestImportLegacy) {
+    Components::LogPrmDbTester tester;
+    tester.testImportLegacy();
+}
+
+TEST(Nominal, TestCompaction) {
+    Components::LogPrmDbTester tester;
+    tester.testCompaction();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
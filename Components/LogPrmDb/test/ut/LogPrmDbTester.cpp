@@ -0,0 +1,251 @@
+// ======================================================================
+// \title  LogPrmDbTester.cpp
+// \author ortega
+// \brief  cpp file for LogPrmDb component test harness implementation class
+// ======================================================================
+
+#include "LogPrmDbTester.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 LogPrmDbTester::U32_RECORD_SIZE;
+
+namespace {
+const char LOG_FILE[] = "LogPrmDbTest.log";
+const char LEGACY_FILE[] = "LogPrmDbTest.dat";
+
+//! Write bytes to the end of a file, creating it
+void appendBytes(const char* fileName, const U8* data, U32 size) {
+    const int fd = open(fileName, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(write(fd, data, size), static_cast<ssize_t>(size));
+    (void)close(fd);
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+LogPrmDbTester ::LogPrmDbTester()
+    : LogPrmDbGTestBase("LogPrmDbTester", LogPrmDbTester::MAX_HISTORY_SIZE), component("LogPrmDb") {
+    this->initComponents();
+    this->connectPorts();
+    (void)unlink(LOG_FILE);
+    (void)unlink(LEGACY_FILE);
+    this->component.configure(LOG_FILE, LEGACY_FILE);
+}
+
+LogPrmDbTester ::~LogPrmDbTester() {
+    (void)unlink(LOG_FILE);
+    (void)unlink(LEGACY_FILE);
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void LogPrmDbTester ::testSaveAndReplay() {
+    // Nothing to load on a first boot
+    this->component.readParamFile();
+    ASSERT_EVENTS_SIZE(0);
+    U32 value = 0;
+    ASSERT_FALSE(this->getParam(0x100, value));
+
+    this->setParam(0x100, 11);
+    this->setParam(0x101, 22);
+    ASSERT_EVENTS_PrmIdAdded_SIZE(2);
+    this->save();
+    ASSERT_EVENTS_PrmFileSaveComplete(0, 2, LogPrmDb::LOG_HEADER_SIZE + 2 * U32_RECORD_SIZE);
+    ASSERT_EQ(fileSize(LOG_FILE), LogPrmDb::LOG_HEADER_SIZE + 2 * U32_RECORD_SIZE);
+
+    // A change not saved is lost on reload
+    this->setParam(0x100, 33);
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileLoaded_SIZE(1);
+    ASSERT_EVENTS_PrmFileLoaded(0, LOG_FILE, 2, 2);
+    ASSERT_TRUE(this->getParam(0x100, value));
+    ASSERT_EQ(value, 11U);
+    ASSERT_TRUE(this->getParam(0x101, value));
+    ASSERT_EQ(value, 22U);
+}
+
+void LogPrmDbTester ::testAppendChanged() {
+    this->component.readParamFile();
+    this->setParam(0x200, 1);
+    this->setParam(0x201, 2);
+    this->save();
+    const U32 before = fileSize(LOG_FILE);
+
+    this->setParam(0x201, 3);
+    this->clearHistory();
+    this->save();
+    ASSERT_EVENTS_PrmFileSaveComplete(0, 1, before + U32_RECORD_SIZE);
+    ASSERT_EQ(fileSize(LOG_FILE), before + U32_RECORD_SIZE);
+
+    // Nothing changed: nothing appended
+    this->clearHistory();
+    this->save();
+    ASSERT_EVENTS_PrmFileSaveComplete(0, 0, before + U32_RECORD_SIZE);
+
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileLoaded(0, LOG_FILE, 3, 2);
+    U32 value = 0;
+    ASSERT_TRUE(this->getParam(0x201, value));
+    ASSERT_EQ(value, 3U);
+}
+
+void LogPrmDbTester ::testTornRecord() {
+    this->component.readParamFile();
+    this->setParam(0x300, 7);
+    this->save();
+    const U32 valid = fileSize(LOG_FILE);
+
+    // A save cut short: the start of a record without its value and hash
+    const U8 partial[] = {LogPrmDb::RECORD_DELIMITER, 0, 0, 3, 1, 0};
+    appendBytes(LOG_FILE, partial, sizeof(partial));
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileTruncated_SIZE(1);
+    ASSERT_EVENTS_PrmFileTruncated(0, LOG_FILE, valid, sizeof(partial));
+    ASSERT_EQ(fileSize(LOG_FILE), valid);
+    U32 value = 0;
+    ASSERT_TRUE(this->getParam(0x300, value));
+    ASSERT_EQ(value, 7U);
+
+    // A record with a bad hash is dropped the same way
+    U8 corrupt[U32_RECORD_SIZE];
+    const int fd = open(LOG_FILE, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(pread(fd, corrupt, sizeof(corrupt), LogPrmDb::LOG_HEADER_SIZE), static_cast<ssize_t>(sizeof(corrupt)));
+    (void)close(fd);
+    corrupt[LogPrmDb::RECORD_HEADER_SIZE] ^= 0xFF;
+    appendBytes(LOG_FILE, corrupt, sizeof(corrupt));
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileTruncated(0, LOG_FILE, valid, U32_RECORD_SIZE);
+
+    // Saving appends after the valid records
+    this->setParam(0x300, 8);
+    this->save();
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileTruncated_SIZE(0);
+    ASSERT_EVENTS_PrmFileLoaded(0, LOG_FILE, 2, 1);
+    ASSERT_TRUE(this->getParam(0x300, value));
+    ASSERT_EQ(value, 8U);
+}
+
+void LogPrmDbTester ::testImportLegacy() {
+    // Svc.PrmDb records: delimiter, size of the ID and value, ID, value
+    U8 legacy[2 * (sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + sizeof(U32))];
+    Fw::ExternalSerializeBuffer buffer(legacy, sizeof(legacy));
+    const FwPrmIdType ids[] = {0x400, 0x401};
+    const U32 values[] = {0xCAFE, 0xBEEF};
+    for (U32 index = 0; index < 2; index++) {
+        ASSERT_EQ(buffer.serialize(LogPrmDb::RECORD_DELIMITER), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(buffer.serialize(static_cast<U32>(sizeof(FwPrmIdType) + sizeof(U32))), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(buffer.serialize(ids[index]), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(buffer.serialize(values[index]), Fw::FW_SERIALIZE_OK);
+    }
+    appendBytes(LEGACY_FILE, legacy, static_cast<U32>(buffer.getBuffLength()));
+
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileImported_SIZE(1);
+    ASSERT_EVENTS_PrmFileImported(0, LEGACY_FILE, 2);
+    ASSERT_EVENTS_PrmFileCompacted(0, 0, LogPrmDb::LOG_HEADER_SIZE + 2 * U32_RECORD_SIZE);
+    U32 value = 0;
+    ASSERT_TRUE(this->getParam(0x401, value));
+    ASSERT_EQ(value, 0xBEEFU);
+
+    // The log now exists, so the legacy file is not imported again
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileImported_SIZE(0);
+    ASSERT_EVENTS_PrmFileLoaded(0, LOG_FILE, 2, 2);
+    ASSERT_TRUE(this->getParam(0x400, value));
+    ASSERT_EQ(value, 0xCAFEU);
+}
+
+void LogPrmDbTester ::testCompaction() {
+    this->component.readParamFile();
+    this->setParam(0x500, 0);
+    this->setParam(0x501, 0);
+    this->save();
+    const U32 compacted = LogPrmDb::LOG_HEADER_SIZE + 2 * U32_RECORD_SIZE;
+
+    // Saving one parameter over and over grows the log until it is compacted
+    U32 saves = 0;
+    bool wasCompacted = false;
+    while (!wasCompacted) {
+        saves++;
+        ASSERT_LT(saves, 1000U);
+        this->setParam(0x500, saves);
+        this->clearHistory();
+        this->save();
+        wasCompacted = (this->eventHistory_PrmFileCompacted->size() > 0);
+    }
+    ASSERT_GT(this->eventHistory_PrmFileCompacted->at(0).before, LogPrmDb::COMPACT_MIN_SIZE);
+    ASSERT_EQ(this->eventHistory_PrmFileCompacted->at(0).after, compacted);
+    ASSERT_EQ(fileSize(LOG_FILE), compacted);
+
+    this->clearHistory();
+    this->component.readParamFile();
+    ASSERT_EVENTS_PrmFileLoaded(0, LOG_FILE, 2, 2);
+    U32 value = 0;
+    ASSERT_TRUE(this->getParam(0x500, value));
+    ASSERT_EQ(value, saves);
+
+    // Also on command
+    this->setParam(0x501, 5);
+    this->save();
+    this->clearHistory();
+    this->sendCmd_PRM_COMPACT_FILE(0, 0);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, LogPrmDb::OPCODE_PRM_COMPACT_FILE, 0, Fw::CmdResponse::OK);
+    ASSERT_EQ(fileSize(LOG_FILE), compacted);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void LogPrmDbTester ::setParam(FwPrmIdType id, U32 value) {
+    Fw::ParamBuffer buffer;
+    ASSERT_EQ(buffer.serialize(value), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_setPrm(0, id, buffer);
+    this->component.doDispatch();
+}
+
+bool LogPrmDbTester ::getParam(FwPrmIdType id, U32& value) {
+    Fw::ParamBuffer buffer;
+    if (this->invoke_to_getPrm(0, id, buffer) != Fw::ParamValid::VALID) {
+        return false;
+    }
+    return buffer.deserialize(value) == Fw::FW_SERIALIZE_OK;
+}
+
+void LogPrmDbTester ::save() {
+    this->sendCmd_PRM_SAVE_FILE(0, 0);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, LogPrmDb::OPCODE_PRM_SAVE_FILE, 0, Fw::CmdResponse::OK);
+    this->cmdResponseHistory->clear();
+}
+
+U32 LogPrmDbTester ::fileSize(const char* fileName) {
+    struct stat status;
+    if (stat(fileName, &status) != 0) {
+        return 0;
+    }
+    return static_cast<U32>(status.st_size);
+}
+
+}  // namespace Components
@@ -0,0 +1,105 @@
+// ======================================================================
+// \title  LogPrmDbTester.hpp
+// \author ortega
+// \brief  hpp file for LogPrmDb component test harness implementation class
+// ======================================================================
+
+#ifndef Components_LogPrmDbTester_HPP
+#define Components_LogPrmDbTester_HPP
+
+#include "Components/LogPrmDb/LogPrmDb.hpp"
+#include "Components/LogPrmDb/LogPrmDbGTestBase.hpp"
+
+namespace Components {
+
+class LogPrmDbTester : public LogPrmDbGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 40;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+    //! Size of the record of a U32 parameter
+    static const U32 U32_RECORD_SIZE = LogPrmDb::RECORD_HEADER_SIZE + sizeof(U32) + HASH_DIGEST_LENGTH;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object LogPrmDbTester
+    LogPrmDbTester();
+
+    //! Destroy object LogPrmDbTester
+    ~LogPrmDbTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Saved parameters are replayed from the log, replacing values not saved
+    void testSaveAndReplay();
+
+    //! A save appends only the parameters changed since the previous one, and the last record of a parameter wins
+    void testAppendChanged();
+
+    //! A partial record at the end of the log is dropped and truncated away, and saving resumes after it
+    void testTornRecord();
+
+    //! Without a log, the Svc.PrmDb file is imported and written to a new log
+    void testImportLegacy();
+
+    //! The log is compacted to one record per parameter once it grew past the compaction ratio
+    void testCompaction();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Set a U32 parameter through setPrm
+    void setParam(FwPrmIdType id,  //!< The parameter ID
+                  U32 value        //!< The value
+    );
+
+    //! Get a U32 parameter through getPrm
+    //!
+    //! \return true when the parameter is in the database
+    bool getParam(FwPrmIdType id,  //!< The parameter ID
+                  U32& value       //!< Receives the value
+    );
+
+    //! Send PRM_SAVE_FILE and expect it to succeed
+    void save();
+
+    //! \return the size of a file, 0 when it does not exist
+    static U32 fileSize(const char* fileName  //!< The file
+    );
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    LogPrmDb component;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,327 @@
+// ======================================================================
+// \title  MmapSequence.cpp
+// \author ortega
+// \brief  cpp file for the command sequence format streaming records from a memory-mapped file
+// ======================================================================
+
+#include "Components/MmapSequence/MmapSequence.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace Components {
+
+const U32 MmapSequence::CRC_SIZE;
+
+namespace {
+//! Size of the descriptor, time tag and command size preceding the command of a record
+const U32 RECORD_HEADER_SIZE = sizeof(U8) + sizeof(U32) + sizeof(U32) + sizeof(U32);
+
+//! Point a serialize buffer at mapped bytes for reading. They are never written through it.
+void setReader(Fw::ExternalSerializeBuffer& buffer, const U8* data, U32 size) {
+    buffer.setExtBuffer(const_cast<U8*>(data), size);
+    (void)buffer.setBuffLen(size);
+}
+
+//! Modification time of a file in nanoseconds
+U64 modificationTime(const struct stat& status) {
+    return static_cast<U64>(status.st_mtim.tv_sec) * 1000000000ULL + static_cast<U64>(status.st_mtim.tv_nsec);
+}
+}  // namespace
+
+MmapSequence ::MmapSequence(Svc::CmdSequencerComponentImpl& component, CrcCheck crcCheck)
+    : Sequence(component), m_crcCheck(crcCheck) {}
+
+MmapSequence ::~MmapSequence() {
+    this->unmap();
+}
+
+bool MmapSequence ::loadFile(const Fw::StringBase& fileName) {
+    this->unmap();
+    this->setFileName(fileName);
+
+    this->m_fd = ::open(fileName.toChar(), O_RDONLY);
+    if (this->m_fd < 0) {
+        this->m_events.fileNotFound();
+        return false;
+    }
+    struct stat status;
+    if ((fstat(this->m_fd, &status) != 0) || (static_cast<U64>(status.st_size) > 0xFFFFFFFFULL)) {
+        this->m_events.fileReadError();
+        this->unmap();
+        return false;
+    }
+    const U32 size = static_cast<U32>(status.st_size);
+    if (size < Header::SERIALIZED_SIZE) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::READ_HEADER_SIZE, static_cast<I32>(size));
+        this->unmap();
+        return false;
+    }
+    void* const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, this->m_fd, 0);
+    if (address == MAP_FAILED) {
+        this->m_events.fileReadError();
+        this->unmap();
+        return false;
+    }
+    // The records are read once, front to back
+    (void)madvise(address, size, MADV_SEQUENTIAL);
+    this->m_data = static_cast<const U8*>(address);
+    this->m_size = size;
+    this->m_modified = modificationTime(status);
+
+    // Header: size of the records and CRC, record count, time base and context
+    Fw::ExternalSerializeBuffer buffer;
+    setReader(buffer, this->m_data, Header::SERIALIZED_SIZE);
+    Fw::SerializeStatus serializeStatus = buffer.deserialize(this->m_header.m_fileSize);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::DESER_SIZE, serializeStatus);
+        this->unmap();
+        return false;
+    }
+    serializeStatus = buffer.deserialize(this->m_header.m_numRecords);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::DESER_NUM_RECORDS, serializeStatus);
+        this->unmap();
+        return false;
+    }
+    FwTimeBaseStoreType timeBase = 0;
+    serializeStatus = buffer.deserialize(timeBase);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::DESER_TIME_BASE, serializeStatus);
+        this->unmap();
+        return false;
+    }
+    this->m_header.m_timeBase = static_cast<TimeBase>(timeBase);
+    serializeStatus = buffer.deserialize(this->m_header.m_timeContext);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::DESER_TIME_CONTEXT, serializeStatus);
+        this->unmap();
+        return false;
+    }
+
+    const U32 available = size - Header::SERIALIZED_SIZE;
+    if (this->m_header.m_fileSize > available) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::READ_SEQ_DATA_SIZE, static_cast<I32>(available));
+        this->unmap();
+        return false;
+    }
+    if (this->m_header.m_fileSize < CRC_SIZE) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::READ_SEQ_CRC,
+                                   static_cast<I32>(this->m_header.m_fileSize));
+        this->unmap();
+        return false;
+    }
+    this->m_recordsEnd = Header::SERIALIZED_SIZE + this->m_header.m_fileSize - CRC_SIZE;
+    if (!this->m_header.validateTime(this->m_component)) {
+        this->unmap();
+        return false;
+    }
+
+    // Without records the CRC costs nothing, so it is checked right away in either mode
+    if ((this->m_crcCheck == CRC_AT_LOAD) || (this->m_recordsEnd == Header::SERIALIZED_SIZE)) {
+        if (!this->validateFile()) {
+            this->unmap();
+            return false;
+        }
+    }
+    this->reset();
+    return true;
+}
+
+bool MmapSequence ::hasMoreRecords() const {
+    return (this->m_data != nullptr) && (this->m_offset < this->m_recordsEnd) &&
+           (this->m_recordNumber < this->m_header.m_numRecords);
+}
+
+void MmapSequence ::nextRecord(Record& record) {
+    // A step already queued ahead of the cancel only gets the abort record again
+    if (this->m_aborted) {
+        this->abort(record);
+        return;
+    }
+    FW_ASSERT(this->hasMoreRecords());
+    // Nothing is read from a changed file: reading the pages a truncation cut off would fault
+    if (!this->checkFile()) {
+        this->abort(record);
+        return;
+    }
+    if ((this->m_crcCheck == CRC_STREAMING) && (this->m_recordNumber == 0)) {
+        this->m_hash.update(this->m_data, static_cast<NATIVE_INT_TYPE>(Header::SERIALIZED_SIZE));
+    }
+    U32 size = 0;
+    const Fw::SerializeStatus status = this->parseRecord(this->m_offset, record, size);
+    bool valid = (status == Fw::FW_SERIALIZE_OK);
+    if (!valid) {
+        this->m_events.recordInvalid(this->m_recordNumber, status);
+    } else if (this->m_crcCheck == CRC_AT_LOAD) {
+        // The records and the CRC were validated on load
+        this->m_offset += size;
+        this->m_recordNumber++;
+    } else {
+        this->m_hash.update(&this->m_data[this->m_offset], static_cast<NATIVE_INT_TYPE>(size));
+        this->m_offset += size;
+        this->m_recordNumber++;
+        // The last record runs only once the whole file is known to be intact
+        if ((this->m_recordNumber == this->m_header.m_numRecords) || (this->m_offset == this->m_recordsEnd)) {
+            if (this->m_offset != this->m_recordsEnd) {
+                this->m_events.recordMismatch(this->m_header.m_numRecords, this->m_recordsEnd - this->m_offset);
+                valid = false;
+            } else if (this->m_recordNumber != this->m_header.m_numRecords) {
+                this->m_events.recordInvalid(this->m_recordNumber, Fw::FW_DESERIALIZE_BUFFER_EMPTY);
+                valid = false;
+            } else {
+                valid = this->checkCrc(this->m_hash);
+            }
+        }
+    }
+    if (!valid) {
+        this->abort(record);
+    }
+}
+
+void MmapSequence ::reset() {
+    // The header is hashed with the first record, once the file is known to be unchanged: the sequencer resets a
+    // cancelled sequence, possibly after the file was truncated
+    this->m_offset = Header::SERIALIZED_SIZE;
+    this->m_recordNumber = 0;
+    this->m_aborted = false;
+    this->m_hash.init();
+}
+
+void MmapSequence ::clear() {
+    this->m_offset = this->m_recordsEnd;
+}
+
+void MmapSequence ::unmap() {
+    if (this->m_data != nullptr) {
+        (void)munmap(const_cast<U8*>(this->m_data), this->m_size);
+        this->m_data = nullptr;
+    }
+    if (this->m_fd >= 0) {
+        (void)::close(this->m_fd);
+        this->m_fd = -1;
+    }
+    this->m_size = 0;
+    this->m_modified = 0;
+    this->m_offset = 0;
+    this->m_recordsEnd = 0;
+    this->m_recordNumber = 0;
+    this->m_aborted = false;
+}
+
+Fw::SerializeStatus MmapSequence ::parseRecord(U32 offset, Record& record, U32& size) const {
+    FW_ASSERT(offset <= this->m_recordsEnd, static_cast<FwAssertArgType>(offset));
+    const U32 left = this->m_recordsEnd - offset;
+    Fw::ExternalSerializeBuffer buffer;
+    setReader(buffer, &this->m_data[offset], FW_MIN(left, RECORD_HEADER_SIZE));
+
+    U8 descriptor = 0;
+    Fw::SerializeStatus status = buffer.deserialize(descriptor);
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return status;
+    }
+    if (descriptor > Record::END_OF_SEQUENCE) {
+        return Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    record.m_descriptor = static_cast<Record::Descriptor>(descriptor);
+    if (record.m_descriptor == Record::END_OF_SEQUENCE) {
+        size = sizeof(U8);
+        return Fw::FW_SERIALIZE_OK;
+    }
+
+    U32 seconds = 0;
+    U32 useconds = 0;
+    U32 commandSize = 0;
+    status = buffer.deserialize(seconds);
+    status = (status == Fw::FW_SERIALIZE_OK) ? buffer.deserialize(useconds) : status;
+    status = (status == Fw::FW_SERIALIZE_OK) ? buffer.deserialize(commandSize) : status;
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return status;
+    }
+    if (commandSize > record.m_command.getBuffCapacity()) {
+        return Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    if (commandSize > (left - RECORD_HEADER_SIZE)) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    record.m_timeTag.set(seconds, useconds);
+    // The command is the only copy, out of the mapping into the buffer the sequencer sends
+    record.m_command.resetSer();
+    (void)memcpy(record.m_command.getBuffAddr(), &this->m_data[offset + RECORD_HEADER_SIZE], commandSize);
+    status = record.m_command.setBuffLen(commandSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    size = RECORD_HEADER_SIZE + commandSize;
+    return Fw::FW_SERIALIZE_OK;
+}
+
+bool MmapSequence ::checkFile() {
+    struct stat status;
+    if (fstat(this->m_fd, &status) != 0) {
+        this->m_events.fileReadError();
+        return false;
+    }
+    if ((static_cast<U64>(status.st_size) != this->m_size) || (modificationTime(status) != this->m_modified)) {
+        this->m_events.fileInvalid(Svc::CmdSequencer_FileReadStage::READ_SEQ_DATA, static_cast<I32>(status.st_size));
+        return false;
+    }
+    return true;
+}
+
+void MmapSequence ::abort(Record& record) {
+    // An end of sequence record would complete the sequence successfully. An absolute record at the last time there is
+    // only sets the command timer, and the cancel queued behind this step clears it before it can expire.
+    record.m_descriptor = Record::ABSOLUTE;
+    record.m_timeTag.set(0xFFFFFFFF, 999999);
+    record.m_command.resetSer();
+    if (!this->m_aborted) {
+        this->m_aborted = true;
+        this->m_component.get_seqCancelIn_InputPort(0)->invoke();
+    }
+    this->clear();
+}
+
+bool MmapSequence ::validateFile() {
+    Record record;
+    U32 offset = Header::SERIALIZED_SIZE;
+    for (U32 number = 0; number < this->m_header.m_numRecords; number++) {
+        U32 size = 0;
+        const Fw::SerializeStatus status = this->parseRecord(offset, record, size);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            this->m_events.recordInvalid(number, status);
+            return false;
+        }
+        offset += size;
+    }
+    if (offset != this->m_recordsEnd) {
+        this->m_events.recordMismatch(this->m_header.m_numRecords, this->m_recordsEnd - offset);
+        return false;
+    }
+    Utils::Hash hash;
+    hash.init();
+    hash.update(this->m_data, static_cast<NATIVE_INT_TYPE>(this->m_recordsEnd));
+    return this->checkCrc(hash);
+}
+
+bool MmapSequence ::checkCrc(Utils::Hash& hash) {
+    Utils::HashBuffer digest;
+    hash.final(digest);
+    U32 computed = 0;
+    Fw::SerializeStatus status = digest.deserialize(computed);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    U32 stored = 0;
+    Fw::ExternalSerializeBuffer buffer;
+    setReader(buffer, &this->m_data[this->m_recordsEnd], CRC_SIZE);
+    status = buffer.deserialize(stored);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    if (computed != stored) {
+        this->m_events.fileCRCFailure(stored, computed);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace Components
@@ -0,0 +1,117 @@
+// ======================================================================
+// \title  MmapSequence.hpp
+// \author ortega
+// \brief  hpp file for the command sequence format streaming records from a memory-mapped file
+// ======================================================================
+
+#ifndef Components_MmapSequence_HPP
+#define Components_MmapSequence_HPP
+
+#include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+namespace Components {
+
+//! Command sequence in the F´ binary format, read in place from a memory-mapped file
+//!
+//! Svc::CmdSequencer's own format copies the whole file into a buffer allocated up front, which caps the sequence
+//! length and makes loading a long sequence slow. This format maps the file instead and deserializes each record when
+//! the sequencer asks for it, so a sequence is only limited by the file system and no sequence buffer is allocated.
+//! Install it with Svc::CmdSequencerComponentImpl::setSequenceFormat instead of calling allocateBuffer.
+//!
+//! The file CRC is checked either while the records are streamed, the default, so loading takes the same time whatever
+//! the sequence length, or when the file is loaded, reading the mapped file once. When streamed, the records are
+//! validated one by one as they are reached and the CRC as the last one is, after the records preceding it ran.
+//!
+//! The file stays mapped while the sequence runs, so its size and modification time are checked before each record is
+//! read: a file rewritten or truncated since the load would otherwise run other commands or fault on the missing pages.
+//! A changed file, a bad record or a CRC mismatch is reported with a warning event and fails the sequence. The
+//! sequencer has no way for a format to fail a running sequence, so the record is replaced by one that is never due and
+//! the sequence is cancelled through the sequencer's seqCancelIn port. The cancel is queued behind the message being
+//! handled and stops the sequence before any other record runs, with CS_SequenceCanceled and an execution error on
+//! seqDone.
+class MmapSequence : public Svc::CmdSequencerComponentImpl::Sequence {
+  public:
+    //! When the file CRC is checked
+    enum CrcCheck {
+        CRC_STREAMING,  //!< As the records are streamed, before the last record runs
+        CRC_AT_LOAD     //!< Before the first record runs, reading the whole file on load
+    };
+
+    //! Size of the CRC at the end of the file
+    static const U32 CRC_SIZE = sizeof(U32);
+
+    //! Construct a sequence for a sequencer
+    MmapSequence(Svc::CmdSequencerComponentImpl& component,  //!< The sequencer
+                 CrcCheck crcCheck = CRC_STREAMING            //!< When the file CRC is checked
+    );
+
+    //! Unmap the file
+    ~MmapSequence();
+
+    //! Map a sequence file and validate its header, and its records and CRC when checked at load
+    //!
+    //! \return true when the sequence can run
+    bool loadFile(const Fw::StringBase& fileName  //!< The sequence file
+                  ) override;
+
+    //! \return true while records are left
+    bool hasMoreRecords() const override;
+
+    //! Deserialize the next record. A record that cannot run is replaced by the abort record, failing the sequence.
+    void nextRecord(Record& record  //!< Receives the record
+                    ) override;
+
+    //! Rewind to the first record
+    void reset() override;
+
+    //! Drop the remaining records
+    void clear() override;
+
+  private:
+    //! Unmap the current file
+    void unmap();
+
+    //! Deserialize the record at an offset of the mapped file
+    //!
+    //! \return the status of the deserialization, with the size of the record in size when successful
+    Fw::SerializeStatus parseRecord(U32 offset,     //!< Offset of the record in the file
+                                    Record& record,  //!< Receives the record
+                                    U32& size        //!< Receives the size of the record
+    ) const;
+
+    //! Check that the file was not changed since it was loaded
+    //!
+    //! \return true when unchanged, false after an error event
+    bool checkFile();
+
+    //! Replace a record by one that is never due, cancel the sequence and drop the remaining records
+    void abort(Record& record  //!< Receives the abort record
+    );
+
+    //! Check every record and the CRC of the mapped file
+    //!
+    //! \return true when valid, false after an error event
+    bool validateFile();
+
+    //! Check the CRC against the one computed over the whole file
+    //!
+    //! \return true when they match, false after an error event
+    bool checkCrc(Utils::Hash& hash  //!< Hash fed with every byte before the CRC
+    );
+
+    CrcCheck m_crcCheck;          //! When the file CRC is checked
+    int m_fd = -1;                //! The mapped file, -1 when none
+    const U8* m_data = nullptr;   //! The mapped file
+    U32 m_size = 0;               //! Size of the mapped file
+    U64 m_modified = 0;           //! Modification time of the mapped file, in nanoseconds
+    U32 m_offset = 0;             //! Offset of the next record
+    U32 m_recordsEnd = 0;         //! End of the records, where the CRC starts
+    U32 m_recordNumber = 0;       //! Number of the next record
+    bool m_aborted = false;       //! The sequence was cancelled and only the abort record is left
+    Utils::Hash m_hash;           //! CRC of the bytes streamed so far, when checked while streaming
+};
+
+}  // namespace Components
+
+#endif
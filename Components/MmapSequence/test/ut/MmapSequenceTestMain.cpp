@@ -0,0 +1,47 @@
+// ======================================================================
+// \title  MmapSequenceTestMain.cpp
+// \author ortega
+// \brief  cpp file for MmapSequence test main function
+// ======================================================================
+
+#include "MmapSequenceTester.hpp"
+
+TEST(Nominal, TestStream) {
+    Components::MmapSequenceTester tester;
+    tester.testStream();
+}
+
+TEST(Nominal, TestLongSequence) {
+    Components::MmapSequenceTester tester;
+    tester.testLongSequence();
+}
+
+TEST(OffNominal, TestCrcAtLoad) {
+    Components::MmapSequenceTester tester;
+    tester.testCrcAtLoad();
+}
+
+TEST(OffNominal, TestCrcStreaming) {
+    Components::MmapSequenceTester tester;
+    tester.testCrcStreaming();
+}
+
+TEST(OffNominal, TestBadRecord) {
+    Components::MmapSequenceTester tester;
+    tester.testBadRecord();
+}
+
+TEST(OffNominal, TestBadHeader) {
+    Components::MmapSequenceTester tester;
+    tester.testBadHeader();
+}
+
+TEST(OffNominal, TestChangedFile) {
+    Components::MmapSequenceTester tester;
+    tester.testChangedFile();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,240 @@
+// ======================================================================
+// \title  MmapSequenceTester.cpp
+// \author ortega
+// \brief  cpp file for MmapSequence test harness implementation class
+// ======================================================================
+
+#include "MmapSequenceTester.hpp"
+
+#include <cstdio>
+
+namespace Components {
+
+const char* const MmapSequenceTester::SEQUENCE_FILE = "MmapSequenceTest.bin";
+// The assertions take their operands by reference
+const U32 MmapSequenceTester::LONG_RECORDS;
+
+namespace {
+//! Size of a test command: an opcode and the record number
+const U32 COMMAND_SIZE = sizeof(FwOpcodeType) + sizeof(U32);
+
+void putU32(std::vector<U8>& bytes, U32 value) {
+    for (U32 shift = 32; shift > 0; shift -= 8) {
+        bytes.push_back(static_cast<U8>(value >> (shift - 8)));
+    }
+}
+
+void putU16(std::vector<U8>& bytes, U16 value) {
+    bytes.push_back(static_cast<U8>(value >> 8));
+    bytes.push_back(static_cast<U8>(value));
+}
+
+//! Replace the CRC after the contents of a sequence changed
+void updateCrc(std::vector<U8>& bytes) {
+    bytes.resize(bytes.size() - MmapSequence::CRC_SIZE);
+    Utils::Hash hash;
+    hash.init();
+    hash.update(bytes.data(), static_cast<NATIVE_INT_TYPE>(bytes.size()));
+    Utils::HashBuffer digest;
+    hash.final(digest);
+    U32 crc = 0;
+    ASSERT_EQ(digest.deserialize(crc), Fw::FW_SERIALIZE_OK);
+    putU32(bytes, crc);
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+MmapSequenceTester ::MmapSequenceTester() : sequencer("sequencer") {
+    this->sequencer.init(10, 0);
+}
+
+MmapSequenceTester ::~MmapSequenceTester() {
+    (void)remove(SEQUENCE_FILE);
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void MmapSequenceTester ::testStream() {
+    writeFile(buildSequence(5));
+    bool aborted = true;
+    MmapSequence streaming(this->sequencer, MmapSequence::CRC_STREAMING);
+    ASSERT_TRUE(streaming.loadFile(Fw::String(SEQUENCE_FILE)));
+    ASSERT_EQ(stream(streaming, aborted), 5U);
+    ASSERT_FALSE(aborted);
+    streaming.reset();
+    ASSERT_EQ(stream(streaming, aborted), 5U);
+    ASSERT_FALSE(aborted);
+
+    MmapSequence atLoad(this->sequencer, MmapSequence::CRC_AT_LOAD);
+    ASSERT_TRUE(atLoad.loadFile(Fw::String(SEQUENCE_FILE)));
+    ASSERT_EQ(stream(atLoad, aborted), 5U);
+    ASSERT_FALSE(aborted);
+
+    // Clearing drops the remaining records
+    atLoad.reset();
+    ASSERT_TRUE(atLoad.hasMoreRecords());
+    atLoad.clear();
+    ASSERT_FALSE(atLoad.hasMoreRecords());
+}
+
+void MmapSequenceTester ::testLongSequence() {
+    const std::vector<U8> bytes = buildSequence(LONG_RECORDS);
+    ASSERT_GT(bytes.size(), 4096U);
+    writeFile(bytes);
+    bool aborted = true;
+    MmapSequence sequence(this->sequencer, MmapSequence::CRC_STREAMING);
+    ASSERT_TRUE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+    ASSERT_EQ(stream(sequence, aborted), LONG_RECORDS);
+    ASSERT_FALSE(aborted);
+}
+
+void MmapSequenceTester ::testCrcAtLoad() {
+    std::vector<U8> bytes = buildSequence(3);
+    bytes.back() ^= 0xFF;
+    writeFile(bytes);
+    MmapSequence sequence(this->sequencer, MmapSequence::CRC_AT_LOAD);
+    ASSERT_FALSE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+    ASSERT_FALSE(sequence.hasMoreRecords());
+}
+
+void MmapSequenceTester ::testCrcStreaming() {
+    std::vector<U8> bytes = buildSequence(3);
+    bytes.back() ^= 0xFF;
+    writeFile(bytes);
+    bool aborted = false;
+    MmapSequence sequence(this->sequencer);
+    ASSERT_TRUE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+    // The last record is replaced by the abort record, which cancels the sequence instead of completing it
+    ASSERT_EQ(stream(sequence, aborted), 2U);
+    ASSERT_TRUE(aborted);
+    ASSERT_FALSE(sequence.hasMoreRecords());
+}
+
+void MmapSequenceTester ::testBadRecord() {
+    // The command size of the second record runs past the CRC
+    std::vector<U8> bytes = buildSequence(3);
+    const U32 second = Svc::CmdSequencerComponentImpl::Sequence::Header::SERIALIZED_SIZE + 13 + COMMAND_SIZE;
+    bytes[second + 12] = 0x40;
+    updateCrc(bytes);
+    writeFile(bytes);
+
+    MmapSequence atLoad(this->sequencer, MmapSequence::CRC_AT_LOAD);
+    ASSERT_FALSE(atLoad.loadFile(Fw::String(SEQUENCE_FILE)));
+
+    bool aborted = false;
+    MmapSequence streaming(this->sequencer, MmapSequence::CRC_STREAMING);
+    ASSERT_TRUE(streaming.loadFile(Fw::String(SEQUENCE_FILE)));
+    ASSERT_EQ(stream(streaming, aborted), 1U);
+    ASSERT_TRUE(aborted);
+    ASSERT_FALSE(streaming.hasMoreRecords());
+}
+
+void MmapSequenceTester ::testBadHeader() {
+    (void)remove(SEQUENCE_FILE);
+    MmapSequence sequence(this->sequencer);
+    ASSERT_FALSE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+
+    // Shorter than a header
+    std::vector<U8> bytes = buildSequence(2);
+    writeFile(std::vector<U8>(bytes.begin(), bytes.begin() + 5));
+    ASSERT_FALSE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+
+    // Header size beyond the end of the file
+    bytes[3] += 1;
+    writeFile(bytes);
+    ASSERT_FALSE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+    ASSERT_FALSE(sequence.hasMoreRecords());
+}
+
+void MmapSequenceTester ::testChangedFile() {
+    const MmapSequence::CrcCheck modes[] = {MmapSequence::CRC_STREAMING, MmapSequence::CRC_AT_LOAD};
+    for (const MmapSequence::CrcCheck mode : modes) {
+        const std::vector<U8> bytes = buildSequence(LONG_RECORDS);
+        writeFile(bytes);
+        MmapSequence sequence(this->sequencer, mode);
+        ASSERT_TRUE(sequence.loadFile(Fw::String(SEQUENCE_FILE)));
+        Svc::CmdSequencerComponentImpl::Sequence::Record record;
+        sequence.nextRecord(record);
+        ASSERT_EQ(record.m_command.getBuffLength(), COMMAND_SIZE);
+
+        // Truncated in place, as an uplink to the same path does: the mapped pages past the first one are gone
+        writeFile(std::vector<U8>(bytes.begin(), bytes.begin() + 100));
+        bool aborted = false;
+        ASSERT_EQ(stream(sequence, aborted), 0U);
+        ASSERT_TRUE(aborted);
+        ASSERT_FALSE(sequence.hasMoreRecords());
+        // A step queued ahead of the cancel gets the abort record again, and the reset of the cancel reads nothing
+        sequence.nextRecord(record);
+        ASSERT_EQ(record.m_descriptor, Svc::CmdSequencerComponentImpl::Sequence::Record::ABSOLUTE);
+        ASSERT_EQ(record.m_command.getBuffLength(), 0U);
+        sequence.reset();
+    }
+}
+
+// ----------------------------------------------------------------------
+// Helpers
+// ----------------------------------------------------------------------
+
+std::vector<U8> MmapSequenceTester ::buildSequence(U32 records) {
+    std::vector<U8> bytes;
+    const U32 recordSize = sizeof(U8) + 3 * sizeof(U32) + COMMAND_SIZE;
+    putU32(bytes, records * recordSize + MmapSequence::CRC_SIZE);
+    putU32(bytes, records);
+    putU16(bytes, static_cast<U16>(TB_NONE));
+    bytes.push_back(0);
+    for (U32 record = 0; record < records; record++) {
+        bytes.push_back(static_cast<U8>(Svc::CmdSequencerComponentImpl::Sequence::Record::RELATIVE));
+        putU32(bytes, record);
+        putU32(bytes, 0);
+        putU32(bytes, COMMAND_SIZE);
+        putU32(bytes, 0x1000 + record);
+        putU32(bytes, record);
+    }
+    putU32(bytes, 0);
+    updateCrc(bytes);
+    return bytes;
+}
+
+void MmapSequenceTester ::writeFile(const std::vector<U8>& bytes) {
+    FILE* file = fopen(SEQUENCE_FILE, "wb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(bytes.data(), 1, bytes.size(), file), bytes.size());
+    ASSERT_EQ(fclose(file), 0);
+}
+
+U32 MmapSequenceTester ::stream(MmapSequence& sequence, bool& aborted) {
+    Svc::CmdSequencerComponentImpl::Sequence::Record record;
+    U32 count = 0;
+    aborted = false;
+    while (sequence.hasMoreRecords()) {
+        sequence.nextRecord(record);
+        if (record.m_descriptor == Svc::CmdSequencerComponentImpl::Sequence::Record::END_OF_SEQUENCE) {
+            break;
+        }
+        // The abort record: an empty command never due, held until the queued cancel stops the sequence
+        if (record.m_command.getBuffLength() == 0) {
+            EXPECT_EQ(record.m_descriptor, Svc::CmdSequencerComponentImpl::Sequence::Record::ABSOLUTE);
+            EXPECT_EQ(record.m_timeTag.getSeconds(), 0xFFFFFFFFU);
+            aborted = true;
+            break;
+        }
+        EXPECT_EQ(record.m_descriptor, Svc::CmdSequencerComponentImpl::Sequence::Record::RELATIVE);
+        EXPECT_EQ(record.m_timeTag.getSeconds(), count);
+        EXPECT_EQ(record.m_command.getBuffLength(), COMMAND_SIZE);
+        U32 opcode = 0;
+        U32 number = 0;
+        EXPECT_EQ(record.m_command.deserialize(opcode), Fw::FW_SERIALIZE_OK);
+        EXPECT_EQ(record.m_command.deserialize(number), Fw::FW_SERIALIZE_OK);
+        EXPECT_EQ(opcode, 0x1000 + count);
+        EXPECT_EQ(number, count);
+        count++;
+    }
+    return count;
+}
+
+}  // namespace Components
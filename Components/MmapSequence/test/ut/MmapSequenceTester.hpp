@@ -0,0 +1,89 @@
+// ======================================================================
+// \title  MmapSequenceTester.hpp
+// \author ortega
+// \brief  hpp file for MmapSequence test harness implementation class
+// ======================================================================
+
+#ifndef Components_MmapSequenceTester_HPP
+#define Components_MmapSequenceTester_HPP
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "Components/MmapSequence/MmapSequence.hpp"
+
+namespace Components {
+
+class MmapSequenceTester {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    //! Sequence file written by the tests
+    static const char* const SEQUENCE_FILE;
+
+    //! Number of records of the long sequence, several pages of records
+    static const U32 LONG_RECORDS = 1000;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    MmapSequenceTester();
+
+    ~MmapSequenceTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! The records of a valid sequence are streamed in order, in both CRC modes, and again after a reset
+    void testStream();
+
+    //! A sequence longer than a page streams to its end
+    void testLongSequence();
+
+    //! A CRC mismatch fails the load when the CRC is checked at load
+    void testCrcAtLoad();
+
+    //! A CRC mismatch replaces the last record of a streamed sequence by the abort record
+    void testCrcStreaming();
+
+    //! A truncated record is rejected at load, or replaced by the abort record in a streamed sequence
+    void testBadRecord();
+
+    //! Missing files and bad headers fail the load
+    void testBadHeader();
+
+    //! A file rewritten while it runs is replaced by the abort record without reading it, in both CRC modes
+    void testChangedFile();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helpers
+    // ----------------------------------------------------------------------
+
+    //! Serialize a sequence of records, each command holding its record number, with a valid CRC
+    static std::vector<U8> buildSequence(U32 records);
+
+    //! Write the sequence file
+    static void writeFile(const std::vector<U8>& bytes);
+
+    //! Stream the sequence, checking each record
+    //!
+    //! \return the number of records streamed before the end of the sequence or the abort record
+    static U32 stream(MmapSequence& sequence,  //!< The sequence
+                      bool& aborted            //!< Set when the sequence ended with the abort record
+    );
+
+  private:
+    //! The sequencer the sequences report to
+    Svc::CmdSequencerComponentImpl sequencer;
+};
+
+}  // namespace Components
+
+#endif
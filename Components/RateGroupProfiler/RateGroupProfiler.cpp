@@ -0,0 +1,171 @@
+// ======================================================================
+// \title  RateGroupProfiler.cpp
+// \author ortega
+// \brief  cpp file for RateGroupProfiler component implementation class
+// ======================================================================
+
+#include "Components/RateGroupProfiler/RateGroupProfiler.hpp"
+#include "FpConfig.hpp"
+
+#include <chrono>
+
+namespace Components {
+
+namespace {
+//! Bucket 0 collects every call shorter than 2^FIRST_BUCKET_SHIFT nanoseconds
+const U32 FIRST_BUCKET_SHIFT = 8;
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+RateGroupProfiler ::RateGroupProfiler(const char* const compName)
+    : RateGroupProfilerComponentBase(compName), m_enabled(true), m_reportPeriodStale(true) {
+    this->resetWindow();
+}
+
+RateGroupProfiler ::~RateGroupProfiler() {}
+
+void RateGroupProfiler ::parameterUpdated(FwPrmIdType id) {
+    switch (id) {
+        case PARAMID_REPORT_PERIOD:
+            // Parameter updates arrive on the command dispatcher thread, so the rate group thread reloads the value
+            this->m_reportPeriodStale = true;
+            break;
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(id));
+            break;
+    }
+}
+
+void RateGroupProfiler ::parametersLoaded() {
+    this->m_reportPeriodStale = true;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void RateGroupProfiler ::schedIn_handler(FwIndexType portNum, U32 context) {
+    // Port may not be connected, so check before sending output
+    if (!this->isConnected_schedOut_OutputPort(portNum)) {
+        return;
+    }
+    // When profiling is off the only cost added to the member call is this flag check
+    if (!this->m_enabled.load(std::memory_order_relaxed)) {
+        this->schedOut_out(portNum, context);
+        return;
+    }
+
+    // Rate groups call their members in port order, so port 0 marks the start of a cycle
+    if (portNum == 0) {
+        if (this->m_reportPeriodStale.exchange(false)) {
+            Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+            const U32 period = this->paramGet_REPORT_PERIOD(isValid);
+            this->m_reportPeriod = (period == 0) ? 1 : period;
+        }
+        if (this->m_cycles >= this->m_reportPeriod) {
+            this->report();
+        }
+        this->m_cycles++;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    this->schedOut_out(portNum, context);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const U64 nanoseconds = static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    const U32 latency = (nanoseconds > 0xFFFFFFFFULL) ? 0xFFFFFFFF : static_cast<U32>(nanoseconds);
+    this->m_histograms[portNum][bucketOf(nanoseconds)]++;
+    this->m_counts[portNum]++;
+    if (latency > this->m_maximums[portNum]) {
+        this->m_maximums[portNum] = latency;
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void RateGroupProfiler ::PROFILE_ON_OFF_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::On onOff) {
+    this->m_enabled = (Fw::On::ON == onOff);
+
+    this->log_ACTIVITY_HI_SetProfilingState(onOff);
+
+    // Provide command response
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U32 RateGroupProfiler ::bucketOf(U64 nanoseconds) {
+    if (nanoseconds < (static_cast<U64>(1) << FIRST_BUCKET_SHIFT)) {
+        return 0;
+    }
+    // Index of the highest set bit, shifted so that [2^8, 2^9) lands in bucket 1
+    const U32 bucket = static_cast<U32>(63 - __builtin_clzll(nanoseconds)) - (FIRST_BUCKET_SHIFT - 1);
+    return (bucket < RG_PROFILER_BUCKETS) ? bucket : (RG_PROFILER_BUCKETS - 1);
+}
+
+U32 RateGroupProfiler ::percentile(const U32* histogram, U32 count, U32 maximum, U32 percent) {
+    FW_ASSERT(histogram != nullptr);
+    FW_ASSERT((percent > 0) && (percent <= 100), static_cast<FwAssertArgType>(percent));
+    if (count == 0) {
+        return 0;
+    }
+    // Rank of the percentile call, rounded up so that p100 is the last call
+    const U64 rank = (static_cast<U64>(count) * percent + 99) / 100;
+    U64 cumulative = 0;
+    for (U32 bucket = 0; bucket < RG_PROFILER_BUCKETS - 1; bucket++) {
+        cumulative += histogram[bucket];
+        if (cumulative >= rank) {
+            const U32 upper = static_cast<U32>(1) << (bucket + FIRST_BUCKET_SHIFT);
+            return (upper < maximum) ? upper : maximum;
+        }
+    }
+    // The last bucket is open ended
+    return maximum;
+}
+
+void RateGroupProfiler ::report() {
+    RgMemberValues p50;
+    RgMemberValues p99;
+    RgMemberValues maximums;
+    RgMemberValues counts;
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        const U32* histogram = this->m_histograms[member];
+        p50[member] = percentile(histogram, this->m_counts[member], this->m_maximums[member], 50);
+        p99[member] = percentile(histogram, this->m_counts[member], this->m_maximums[member], 99);
+        maximums[member] = this->m_maximums[member];
+        counts[member] = this->m_counts[member];
+    }
+    this->tlmWrite_LatencyP50(p50);
+    this->tlmWrite_LatencyP99(p99);
+    this->tlmWrite_LatencyMax(maximums);
+    this->tlmWrite_Invocations(counts);
+
+    RgLatencyHistograms histograms;
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        for (U32 bucket = 0; bucket < RG_PROFILER_BUCKETS; bucket++) {
+            histograms[member][bucket] = this->m_histograms[member][bucket];
+        }
+    }
+    this->tlmWrite_Histograms(histograms);
+    this->resetWindow();
+}
+
+void RateGroupProfiler ::resetWindow() {
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        for (U32 bucket = 0; bucket < RG_PROFILER_BUCKETS; bucket++) {
+            this->m_histograms[member][bucket] = 0;
+        }
+        this->m_counts[member] = 0;
+        this->m_maximums[member] = 0;
+    }
+    this->m_cycles = 0;
+}
+
+}  // namespace Components
@@ -0,0 +1,105 @@
+// ======================================================================
+// \title  RateGroupProfiler.hpp
+// \author ortega
+// \brief  hpp file for RateGroupProfiler component implementation class
+// ======================================================================
+
+#ifndef Components_RateGroupProfiler_HPP
+#define Components_RateGroupProfiler_HPP
+
+#include <atomic>
+
+#include "Components/RateGroupProfiler/FppConstantsAc.hpp"
+#include "Components/RateGroupProfiler/RateGroupProfilerComponentAc.hpp"
+
+namespace Components {
+
+class RateGroupProfiler : public RateGroupProfilerComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct RateGroupProfiler object
+    RateGroupProfiler(const char* const compName  //!< The component name
+    );
+
+    //! Destroy RateGroupProfiler object
+    ~RateGroupProfiler();
+
+    PRIVATE :
+        //! Mark the report period for reload when it is updated
+        //!
+        void
+        parameterUpdated(FwPrmIdType id  //!< The parameter ID
+                         ) override;
+
+    //! Mark the report period for reload once parameters are loaded
+    //!
+    void parametersLoaded() override;
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for schedIn
+        //!
+        //! Times the forwarded call to the member on the matching schedOut port
+        void
+        schedIn_handler(FwIndexType portNum,  //!< The port number
+                        U32 context  //!< The call order
+                        ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Handler implementations for commands
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for command PROFILE_ON_OFF
+        //!
+        //! Command to turn member timing on or off
+        void
+        PROFILE_ON_OFF_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                  U32 cmdSeq,           //!< The command sequence number
+                                  Fw::On onOff          //!< Indicates whether profiling should be on or off
+                                  ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Histogram bucket counting a call of the given duration
+        static U32
+        bucketOf(U64 nanoseconds  //!< Duration of the call
+        );
+
+    //! Latency under which the given percentage of the calls of a histogram fall
+    //!
+    //! \return upper bound of the bucket holding the percentile, capped to the longest call
+    static U32 percentile(const U32* histogram,  //!< Bucket counts, RG_PROFILER_BUCKETS entries
+                          U32 count,             //!< Total number of calls in the histogram
+                          U32 maximum,           //!< Longest call in the histogram in nanoseconds
+                          U32 percent            //!< Percentile to compute, 1 to 100
+    );
+
+    //! Send the telemetry of the current window and start a new one
+    void report();
+
+    //! Clear the histograms of the current window
+    void resetWindow();
+
+    U32 m_histograms[RG_PROFILER_MAX_MEMBERS][RG_PROFILER_BUCKETS];  //! Latency histograms of the current window
+    U32 m_counts[RG_PROFILER_MAX_MEMBERS];                           //! Calls timed in the current window
+    U32 m_maximums[RG_PROFILER_MAX_MEMBERS];                         //! Longest call in the current window (ns)
+    U32 m_reportPeriod = 1;                                          //! Rate group cycles per report window
+    U32 m_cycles = 0;                                                //! Rate group cycles in the current window
+    std::atomic<bool> m_enabled;             //! Flag: if true member calls are timed, else only forwarded
+    std::atomic<bool> m_reportPeriodStale;   //! Flag: set when REPORT_PERIOD must be reloaded
+};
+
+}  // namespace Components
+
+#endif
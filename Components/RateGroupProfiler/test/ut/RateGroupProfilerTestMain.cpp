@@ -0,0 +1,37 @@
+// ======================================================================
+// \title  RateGroupProfilerTestMain.cpp
+// \author ortega
+// \brief  cpp file for RateGroupProfiler component test main function
+// ======================================================================
+
+#include "RateGroupProfilerTester.hpp"
+
+TEST(Nominal, TestForwarding) {
+    Components::RateGroupProfilerTester tester;
+    tester.testForwarding();
+}
+
+TEST(Nominal, TestBuckets) {
+    Components::RateGroupProfilerTester tester;
+    tester.testBuckets();
+}
+
+TEST(Nominal, TestPercentiles) {
+    Components::RateGroupProfilerTester tester;
+    tester.testPercentiles();
+}
+
+TEST(Nominal, TestReport) {
+    Components::RateGroupProfilerTester tester;
+    tester.testReport();
+}
+
+TEST(Nominal, TestDisabled) {
+    Components::RateGroupProfilerTester tester;
+    tester.testDisabled();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
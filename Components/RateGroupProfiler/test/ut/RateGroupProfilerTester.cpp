@@ -0,0 +1,143 @@
+// ======================================================================
+// \title  RateGroupProfilerTester.cpp
+// \author ortega
+// \brief  cpp file for RateGroupProfiler component test harness implementation class
+// ======================================================================
+
+#include "RateGroupProfilerTester.hpp"
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+RateGroupProfilerTester ::RateGroupProfilerTester()
+    : RateGroupProfilerGTestBase("RateGroupProfilerTester", RateGroupProfilerTester::MAX_HISTORY_SIZE),
+      component("RateGroupProfiler") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+RateGroupProfilerTester ::~RateGroupProfilerTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void RateGroupProfilerTester ::testForwarding() {
+    this->component.loadParameters();
+
+    // Every member call is forwarded to the matching output port with its context
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        this->invoke_to_schedIn(static_cast<NATIVE_INT_TYPE>(member), 10 + member);
+    }
+    ASSERT_from_schedOut_SIZE(RG_PROFILER_MAX_MEMBERS);
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        ASSERT_from_schedOut(member, 10 + member);
+    }
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        ASSERT_EQ(this->component.m_counts[member], 1U);
+    }
+}
+
+void RateGroupProfilerTester ::testBuckets() {
+    ASSERT_EQ(RateGroupProfiler::bucketOf(0), 0U);
+    ASSERT_EQ(RateGroupProfiler::bucketOf(255), 0U);
+    ASSERT_EQ(RateGroupProfiler::bucketOf(256), 1U);
+    ASSERT_EQ(RateGroupProfiler::bucketOf(511), 1U);
+    ASSERT_EQ(RateGroupProfiler::bucketOf(512), 2U);
+    ASSERT_EQ(RateGroupProfiler::bucketOf(1000000), 12U);
+    // Anything past the last bound is kept in the last bucket
+    ASSERT_EQ(RateGroupProfiler::bucketOf(10000000000ULL), static_cast<U32>(RG_PROFILER_BUCKETS - 1));
+}
+
+void RateGroupProfilerTester ::testPercentiles() {
+    U32 histogram[RG_PROFILER_BUCKETS] = {};
+    ASSERT_EQ(RateGroupProfiler::percentile(histogram, 0, 0, 50), 0U);
+
+    // 98 calls in [256, 512) ns and 2 calls in [2048, 4096) ns, the longest taking 3000 ns
+    histogram[1] = 98;
+    histogram[4] = 2;
+    ASSERT_EQ(RateGroupProfiler::percentile(histogram, 100, 3000, 50), 512U);
+    ASSERT_EQ(RateGroupProfiler::percentile(histogram, 100, 3000, 98), 512U);
+    // The bucket bound is capped to the longest call observed
+    ASSERT_EQ(RateGroupProfiler::percentile(histogram, 100, 3000, 99), 3000U);
+    ASSERT_EQ(RateGroupProfiler::percentile(histogram, 100, 3000, 100), 3000U);
+
+    // A percentile in the open ended last bucket reports the longest call
+    U32 slow[RG_PROFILER_BUCKETS] = {};
+    slow[RG_PROFILER_BUCKETS - 1] = 1;
+    ASSERT_EQ(RateGroupProfiler::percentile(slow, 1, 900000000, 50), 900000000U);
+}
+
+void RateGroupProfilerTester ::testReport() {
+    this->component.loadParameters();
+
+    // Report every 2 cycles
+    this->paramSet_REPORT_PERIOD(2, Fw::ParamValid::VALID);
+    this->paramSend_REPORT_PERIOD(0, 0);
+
+    this->cycle(3);
+    this->cycle(3);
+    ASSERT_TLM_SIZE(0);
+
+    // The start of the third cycle closes the window of the first two
+    this->cycle(3);
+    ASSERT_TLM_Invocations_SIZE(1);
+    RgMemberValues expected;
+    expected[0] = 2;
+    expected[1] = 2;
+    expected[2] = 2;
+    ASSERT_TLM_Invocations(0, expected);
+    ASSERT_TLM_LatencyP50_SIZE(1);
+    ASSERT_TLM_LatencyP99_SIZE(1);
+    ASSERT_TLM_LatencyMax_SIZE(1);
+    ASSERT_TLM_Histograms_SIZE(1);
+
+    // Each histogram holds the calls of its member in the window
+    const RgLatencyHistograms& histograms = this->tlmHistory_Histograms->at(0).arg;
+    for (U32 member = 0; member < RG_PROFILER_MAX_MEMBERS; member++) {
+        U32 total = 0;
+        for (U32 bucket = 0; bucket < RG_PROFILER_BUCKETS; bucket++) {
+            total += histograms[member][bucket];
+        }
+        ASSERT_EQ(total, (member < 3) ? 2U : 0U);
+    }
+
+    // The new window only holds the calls of the third cycle
+    ASSERT_EQ(this->component.m_counts[0], 1U);
+}
+
+void RateGroupProfilerTester ::testDisabled() {
+    this->component.loadParameters();
+
+    this->sendCmd_PROFILE_ON_OFF(0, 0, Fw::On::OFF);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, RateGroupProfiler::OPCODE_PROFILE_ON_OFF, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_SetProfilingState(0, Fw::On::OFF);
+
+    // Calls are still forwarded but neither timed nor reported
+    this->cycle(2);
+    this->cycle(2);
+    this->cycle(2);
+    ASSERT_from_schedOut_SIZE(6);
+    ASSERT_TLM_SIZE(0);
+    ASSERT_EQ(this->component.m_counts[0], 0U);
+
+    this->sendCmd_PROFILE_ON_OFF(0, 0, Fw::On::ON);
+    this->cycle(2);
+    ASSERT_EQ(this->component.m_counts[0], 1U);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void RateGroupProfilerTester ::cycle(U32 memberCount) {
+    for (U32 member = 0; member < memberCount; member++) {
+        this->invoke_to_schedIn(static_cast<NATIVE_INT_TYPE>(member), 0);
+    }
+}
+
+}  // namespace Components
@@ -0,0 +1,74 @@
+// ======================================================================
+// \title  RateGroupProfilerTester.hpp
+// \author ortega
+// \brief  hpp file for RateGroupProfiler component test harness implementation class
+// ======================================================================
+
+#ifndef Components_RateGroupProfilerTester_HPP
+#define Components_RateGroupProfilerTester_HPP
+
+#include "Components/RateGroupProfiler/RateGroupProfiler.hpp"
+#include "Components/RateGroupProfiler/RateGroupProfilerGTestBase.hpp"
+
+namespace Components {
+
+class RateGroupProfilerTester : public RateGroupProfilerGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 20;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object RateGroupProfilerTester
+    RateGroupProfilerTester();
+
+    //! Destroy object RateGroupProfilerTester
+    ~RateGroupProfilerTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void testForwarding();
+    void testBuckets();
+    void testPercentiles();
+    void testReport();
+    void testDisabled();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! Run one rate group cycle calling the first memberCount members
+    void cycle(U32 memberCount);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    RateGroupProfiler component;
+};
+
+}  // namespace Components
+
+#endif
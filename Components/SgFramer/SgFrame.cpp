@@ -0,0 +1,38 @@
+// ======================================================================
+// \title  SgFrame.cpp
+// \author ortega
+// \brief  cpp file for the scatter-gather frame descriptor passed from SgFramer to the downlink driver
+// ======================================================================
+
+#include "Components/SgFramer/SgFrame.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <cstring>
+
+namespace Components {
+
+const U32 SgFrame::MAGIC;
+
+bool SgFrame ::read(const Fw::Buffer& buffer, SgFrame& frame) {
+    if ((buffer.getData() == nullptr) || (buffer.getSize() != sizeof(SgFrame))) {
+        return false;
+    }
+    (void)memcpy(&frame, buffer.getData(), sizeof(SgFrame));
+    if (frame.magic != MAGIC) {
+        return false;
+    }
+    FW_ASSERT(frame.headerSize <= MAX_HEADER_SIZE, static_cast<FwAssertArgType>(frame.headerSize));
+    FW_ASSERT(frame.trailerSize <= MAX_TRAILER_SIZE, static_cast<FwAssertArgType>(frame.trailerSize));
+    FW_ASSERT((frame.payload != nullptr) || (frame.payloadSize == 0));
+    return true;
+}
+
+void SgFrame ::write(const SgFrame& frame, Fw::Buffer& buffer) {
+    FW_ASSERT(buffer.getData() != nullptr);
+    FW_ASSERT(buffer.getSize() >= sizeof(SgFrame), static_cast<FwAssertArgType>(buffer.getSize()));
+    FW_ASSERT(frame.magic == MAGIC);
+    (void)memcpy(buffer.getData(), &frame, sizeof(SgFrame));
+    buffer.setSize(sizeof(SgFrame));
+}
+
+}  // namespace Components
@@ -0,0 +1,57 @@
+// ======================================================================
+// \title  SgFrame.hpp
+// \author ortega
+// \brief  hpp file for the scatter-gather frame descriptor passed from SgFramer to the downlink driver
+// ======================================================================
+
+#ifndef Components_SgFrame_HPP
+#define Components_SgFrame_HPP
+
+#include "FpConfig.hpp"
+#include "Fw/Buffer/Buffer.hpp"
+
+namespace Components {
+
+//! Frame sent as three pieces: a header and a trailer held in the descriptor and a payload left where it is
+//!
+//! SgFramer stores the descriptor at the start of a small buffer sent on the usual framed buffer path, so it reaches
+//! the driver through Svc.ComStub unchanged. The driver recognizes it by its magic, which cannot start a plain frame
+//! (those start with the F´ frame start word), and writes the pieces with one gather write. The payload is only
+//! borrowed: it stays valid until the call delivering the descriptor to the driver returns.
+struct SgFrame {
+    //! Magic number opening a descriptor ("SGFR")
+    static const U32 MAGIC = 0x53474652;
+
+    //! Room for the frame header: start word, size and packet type
+    static const U32 MAX_HEADER_SIZE = 16;
+
+    //! Room for the frame trailer: the hash
+    static const U32 MAX_TRAILER_SIZE = 8;
+
+    U32 magic;                        //!< MAGIC
+    U32 headerSize;                   //!< Bytes used in header
+    U32 trailerSize;                  //!< Bytes used in trailer
+    U32 payloadSize;                  //!< Bytes of payload
+    const U8* payload;                //!< Payload, borrowed for the duration of the send
+    U8 header[MAX_HEADER_SIZE];       //!< Frame bytes preceding the payload
+    U8 trailer[MAX_TRAILER_SIZE];     //!< Frame bytes following the payload
+
+    //! \return the size of the frame on the wire
+    U32 frameSize() const { return this->headerSize + this->payloadSize + this->trailerSize; }
+
+    //! Read the descriptor a buffer holds. Buffers carry no alignment guarantee, so the descriptor is copied out.
+    //!
+    //! \return true when the buffer holds a descriptor rather than a plain frame
+    static bool read(const Fw::Buffer& buffer,  //!< Framed buffer
+                     SgFrame& frame             //!< Filled with the descriptor
+    );
+
+    //! Store a descriptor at the start of a buffer at least sizeof(SgFrame) long, sizing the buffer to it
+    static void write(const SgFrame& frame,  //!< The descriptor
+                      Fw::Buffer& buffer     //!< Buffer receiving it
+    );
+};
+
+}  // namespace Components
+
+#endif
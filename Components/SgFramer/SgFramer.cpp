@@ -0,0 +1,104 @@
+// ======================================================================
+// \title  SgFramer.cpp
+// \author ortega
+// \brief  cpp file for SgFramer component implementation class
+// ======================================================================
+
+#include "Components/SgFramer/SgFramer.hpp"
+#include "FpConfig.hpp"
+#include "Svc/FramingProtocol/FprimeProtocol.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+#include <cstring>
+
+namespace Components {
+
+static_assert(HASH_DIGEST_LENGTH <= SgFrame::MAX_TRAILER_SIZE, "The frame hash must fit the descriptor trailer");
+static_assert(Svc::FpFrameHeader::SIZE + sizeof(I32) <= SgFrame::MAX_HEADER_SIZE,
+              "The frame header must fit the descriptor header");
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+SgFramer ::SgFramer(const char* const compName) : SgFramerComponentBase(compName) {}
+
+SgFramer ::~SgFramer() {}
+
+void SgFramer ::setScatterGather(bool enabled) {
+    this->m_scatterGather = enabled;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void SgFramer ::comIn_handler(FwIndexType portNum, Fw::ComBuffer& data, U32 context) {
+    this->frame(data.getBuffAddr(), static_cast<U32>(data.getBuffLength()), Fw::ComPacket::FW_PACKET_UNKNOWN);
+}
+
+void SgFramer ::bufferIn_handler(FwIndexType portNum, Fw::Buffer& fwBuffer) {
+    this->frame(fwBuffer.getData(), fwBuffer.getSize(), Fw::ComPacket::FW_PACKET_FILE);
+    // The frame was sent before framedOut returned, so the payload is no longer referenced
+    this->bufferDeallocate_out(0, fwBuffer);
+}
+
+void SgFramer ::comStatusIn_handler(FwIndexType portNum, Fw::Success& condition) {
+    if (this->isConnected_comStatusOut_OutputPort(portNum)) {
+        this->comStatusOut_out(portNum, condition);
+    }
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void SgFramer ::frame(const U8* data, U32 size, Fw::ComPacket::ComPacketType packetType) {
+    FW_ASSERT(data != nullptr);
+    SgFrame frame;
+    frame.magic = SgFrame::MAGIC;
+    frame.payload = data;
+    frame.payloadSize = size;
+
+    // Same layout as Svc::FprimeFraming: start word, data size, packet type when not part of the data, data, hash
+    Fw::ExternalSerializeBuffer header(frame.header, sizeof(frame.header));
+    const Svc::FpFrameHeader::TokenType dataSize =
+        size + ((packetType != Fw::ComPacket::FW_PACKET_UNKNOWN) ? static_cast<U32>(sizeof(I32)) : 0);
+    Fw::SerializeStatus status = header.serialize(Svc::FpFrameHeader::START_WORD);
+    status = (status == Fw::FW_SERIALIZE_OK) ? header.serialize(dataSize) : status;
+    if (packetType != Fw::ComPacket::FW_PACKET_UNKNOWN) {
+        status = (status == Fw::FW_SERIALIZE_OK) ? header.serialize(static_cast<I32>(packetType)) : status;
+    }
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    frame.headerSize = static_cast<U32>(header.getBuffLength());
+
+    // The hash covers the header and the payload, fed in pieces instead of over a contiguous copy
+    Utils::Hash hash;
+    Utils::HashBuffer digest;
+    hash.init();
+    hash.update(frame.header, static_cast<NATIVE_INT_TYPE>(frame.headerSize));
+    hash.update(data, static_cast<NATIVE_INT_TYPE>(size));
+    hash.final(digest);
+    (void)memcpy(frame.trailer, digest.getBuffAddr(), HASH_DIGEST_LENGTH);
+    frame.trailerSize = HASH_DIGEST_LENGTH;
+
+    Fw::Buffer buffer;
+    if (this->m_scatterGather) {
+        buffer = this->framedAllocate_out(0, sizeof(SgFrame));
+        FW_ASSERT(buffer.getSize() >= sizeof(SgFrame), static_cast<FwAssertArgType>(buffer.getSize()));
+        SgFrame::write(frame, buffer);
+    } else {
+        const U32 frameSize = frame.frameSize();
+        buffer = this->framedAllocate_out(0, frameSize);
+        FW_ASSERT(buffer.getSize() >= frameSize, static_cast<FwAssertArgType>(buffer.getSize()),
+                  static_cast<FwAssertArgType>(frameSize));
+        U8* const out = buffer.getData();
+        (void)memcpy(out, frame.header, frame.headerSize);
+        (void)memcpy(&out[frame.headerSize], data, size);
+        (void)memcpy(&out[frame.headerSize + size], frame.trailer, frame.trailerSize);
+        buffer.setSize(frameSize);
+    }
+    (void)this->framedOut_out(0, buffer);
+}
+
+}  // namespace Components
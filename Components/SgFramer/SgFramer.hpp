@@ -0,0 +1,81 @@
+// ======================================================================
+// \title  SgFramer.hpp
+// \author ortega
+// \brief  hpp file for SgFramer component implementation class
+// ======================================================================
+
+#ifndef Components_SgFramer_HPP
+#define Components_SgFramer_HPP
+
+#include "Components/SgFramer/SgFrame.hpp"
+#include "Components/SgFramer/SgFramerComponentAc.hpp"
+#include "Fw/Com/ComPacket.hpp"
+
+namespace Components {
+
+class SgFramer : public SgFramerComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct SgFramer object
+    SgFramer(const char* const compName  //!< The component name
+    );
+
+    //! Destroy SgFramer object
+    ~SgFramer();
+
+    //! Select scatter-gather framing. Only enable it when the driver behind framedOut understands SgFrame
+    //! descriptors, such as Components.SgTcpServer.
+    void setScatterGather(bool enabled  //!< true to send descriptors instead of whole frames
+    );
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for comIn
+        //!
+        //! Frames a com buffer, which already holds its packet type
+        void
+        comIn_handler(FwIndexType portNum,  //!< The port number
+                      Fw::ComBuffer& data,  //!< Buffer containing packet data
+                      U32 context           //!< Call context value; meaning chosen by user
+                      ) override;
+
+    //! Handler implementation for bufferIn
+    //!
+    //! Frames a file packet then returns its buffer
+    void bufferIn_handler(FwIndexType portNum,  //!< The port number
+                          Fw::Buffer& fwBuffer  //!< The buffer
+                          ) override;
+
+    //! Handler implementation for comStatusIn
+    //!
+    //! Forwards the status of the link
+    void comStatusIn_handler(FwIndexType portNum,       //!< The port number
+                             Fw::Success& condition  //!< Condition success/failure
+                             ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Frame data with the F´ protocol and send the frame. The data is only read during the call.
+        void
+        frame(const U8* data,                         //!< Payload
+              U32 size,                               //!< Payload size
+              Fw::ComPacket::ComPacketType packetType  //!< Type added to the header, FW_PACKET_UNKNOWN when the
+                                                       //!< payload holds its type
+        );
+
+    bool m_scatterGather = false;  //! Descriptors are sent instead of whole frames
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,32 @@
+// ======================================================================
+// \title  SgFramerTestMain.cpp
+// \author ortega
+// \brief  cpp file for SgFramer component test main function
+// ======================================================================
+
+#include "SgFramerTester.hpp"
+
+TEST(Nominal, TestCopyFraming) {
+    Components::SgFramerTester tester;
+    tester.testCopyFraming();
+}
+
+TEST(Nominal, TestScatterGatherCom) {
+    Components::SgFramerTester tester;
+    tester.testScatterGatherCom();
+}
+
+TEST(Nominal, TestScatterGatherFile) {
+    Components::SgFramerTester tester;
+    tester.testScatterGatherFile();
+}
+
+TEST(Nominal, TestComStatus) {
+    Components::SgFramerTester tester;
+    tester.testComStatus();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
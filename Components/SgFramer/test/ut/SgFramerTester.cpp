@@ -0,0 +1,133 @@
+// ======================================================================
+// \title  SgFramerTester.cpp
+// \author ortega
+// \brief  cpp file for SgFramer component test harness implementation class
+// ======================================================================
+
+#include "SgFramerTester.hpp"
+#include "Svc/FramingProtocol/FprimeProtocol.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+#include <cstring>
+
+namespace Components {
+
+namespace {
+//! Packet the tests frame
+const U8 TEST_PAYLOAD[] = {0x00, 0x00, 0x00, 0x01, 0xDE, 0xAD, 0x10, 0x20, 0x30, 0x40, 0x50};
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+SgFramerTester ::SgFramerTester()
+    : SgFramerGTestBase("SgFramerTester", SgFramerTester::MAX_HISTORY_SIZE), component("SgFramer") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+SgFramerTester ::~SgFramerTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void SgFramerTester ::testCopyFraming() {
+    Fw::ComBuffer com(TEST_PAYLOAD, sizeof(TEST_PAYLOAD));
+    this->invoke_to_comIn(0, com, 0);
+
+    U8 expected[TEST_BUFFER_SIZE];
+    const U32 expectedSize = referenceFrame(TEST_PAYLOAD, sizeof(TEST_PAYLOAD), false, expected);
+    ASSERT_EQ(this->m_allocatedSize, expectedSize);
+    ASSERT_from_framedOut_SIZE(1);
+    ASSERT_FALSE(this->m_wasScatterGather);
+    ASSERT_EQ(this->m_wireSize, expectedSize);
+    ASSERT_EQ(memcmp(this->m_wire, expected, expectedSize), 0);
+}
+
+void SgFramerTester ::testScatterGatherCom() {
+    this->component.setScatterGather(true);
+    Fw::ComBuffer com(TEST_PAYLOAD, sizeof(TEST_PAYLOAD));
+    this->invoke_to_comIn(0, com, 0);
+
+    // Only the descriptor is allocated, whatever the payload size
+    ASSERT_EQ(this->m_allocatedSize, sizeof(SgFrame));
+    U8 expected[TEST_BUFFER_SIZE];
+    const U32 expectedSize = referenceFrame(TEST_PAYLOAD, sizeof(TEST_PAYLOAD), false, expected);
+    ASSERT_from_framedOut_SIZE(1);
+    ASSERT_TRUE(this->m_wasScatterGather);
+    ASSERT_EQ(this->m_wireSize, expectedSize);
+    ASSERT_EQ(memcmp(this->m_wire, expected, expectedSize), 0);
+}
+
+void SgFramerTester ::testScatterGatherFile() {
+    this->component.setScatterGather(true);
+    U8 file[sizeof(TEST_PAYLOAD)];
+    (void)memcpy(file, TEST_PAYLOAD, sizeof(file));
+    Fw::Buffer buffer(file, sizeof(file));
+    this->invoke_to_bufferIn(0, buffer);
+
+    U8 expected[TEST_BUFFER_SIZE];
+    const U32 expectedSize = referenceFrame(file, sizeof(file), true, expected);
+    ASSERT_TRUE(this->m_wasScatterGather);
+    ASSERT_EQ(this->m_wireSize, expectedSize);
+    ASSERT_EQ(memcmp(this->m_wire, expected, expectedSize), 0);
+    ASSERT_from_bufferDeallocate_SIZE(1);
+    ASSERT_EQ(this->fromPortHistory_bufferDeallocate->at(0).fwBuffer.getData(), file);
+}
+
+void SgFramerTester ::testComStatus() {
+    Fw::Success status = Fw::Success::FAILURE;
+    this->invoke_to_comStatusIn(0, status);
+    ASSERT_from_comStatusOut_SIZE(1);
+    ASSERT_from_comStatusOut(0, Fw::Success::FAILURE);
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+Fw::Buffer SgFramerTester ::from_framedAllocate_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    this->pushFromPortEntry_framedAllocate(size);
+    this->m_allocatedSize = size;
+    return Fw::Buffer(this->m_allocation, sizeof(this->m_allocation));
+}
+
+Drv::SendStatus SgFramerTester ::from_framedOut_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& sendBuffer) {
+    this->pushFromPortEntry_framedOut(sendBuffer);
+    SgFrame frame;
+    this->m_wasScatterGather = SgFrame::read(sendBuffer, frame);
+    if (this->m_wasScatterGather) {
+        // The payload is read during the call, as the driver does
+        this->m_wireSize = frame.frameSize();
+        (void)memcpy(this->m_wire, frame.header, frame.headerSize);
+        (void)memcpy(&this->m_wire[frame.headerSize], frame.payload, frame.payloadSize);
+        (void)memcpy(&this->m_wire[frame.headerSize + frame.payloadSize], frame.trailer, frame.trailerSize);
+    } else {
+        this->m_wireSize = sendBuffer.getSize();
+        (void)memcpy(this->m_wire, sendBuffer.getData(), sendBuffer.getSize());
+    }
+    return Drv::SendStatus::SEND_OK;
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U32 SgFramerTester ::referenceFrame(const U8* data, U32 size, bool file, U8* frame) {
+    Fw::ExternalSerializeBuffer serializer(frame, TEST_BUFFER_SIZE);
+    const U32 dataSize = size + (file ? static_cast<U32>(sizeof(I32)) : 0);
+    EXPECT_EQ(serializer.serialize(Svc::FpFrameHeader::START_WORD), Fw::FW_SERIALIZE_OK);
+    EXPECT_EQ(serializer.serialize(dataSize), Fw::FW_SERIALIZE_OK);
+    if (file) {
+        EXPECT_EQ(serializer.serialize(static_cast<I32>(Fw::ComPacket::FW_PACKET_FILE)), Fw::FW_SERIALIZE_OK);
+    }
+    EXPECT_EQ(serializer.serialize(data, size, true), Fw::FW_SERIALIZE_OK);
+    Utils::HashBuffer digest;
+    Utils::Hash::hash(frame, static_cast<NATIVE_INT_TYPE>(serializer.getBuffLength()), digest);
+    EXPECT_EQ(serializer.serialize(digest.getBuffAddr(), HASH_DIGEST_LENGTH, true), Fw::FW_SERIALIZE_OK);
+    return static_cast<U32>(serializer.getBuffLength());
+}
+
+}  // namespace Components
@@ -0,0 +1,121 @@
+// ======================================================================
+// \title  SgFramerTester.hpp
+// \author ortega
+// \brief  hpp file for SgFramer component test harness implementation class
+// ======================================================================
+
+#ifndef Components_SgFramerTester_HPP
+#define Components_SgFramerTester_HPP
+
+#include "Components/SgFramer/SgFramer.hpp"
+#include "Components/SgFramer/SgFramerGTestBase.hpp"
+
+namespace Components {
+
+class SgFramerTester : public SgFramerGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    //! Size of the buffer handed out by framedAllocate and of the captured frame
+    static const U32 TEST_BUFFER_SIZE = 1024;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object SgFramerTester
+    SgFramerTester();
+
+    //! Destroy object SgFramerTester
+    ~SgFramerTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Without scatter-gather a com buffer is copied into a whole F´ frame
+    void testCopyFraming();
+
+    //! With scatter-gather only a descriptor is allocated, and it describes the same frame
+    void testScatterGatherCom();
+
+    //! File packets get their packet type in the header and their buffer is returned once sent
+    void testScatterGatherFile();
+
+    //! The link status is forwarded
+    void testComStatus();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for framedAllocate
+    Fw::Buffer from_framedAllocate_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                           U32 size                        //!< The requested size
+    );
+
+    //! Handler implementation for framedOut
+    //!
+    //! Captures the frame as the driver would put it on the wire
+    Drv::SendStatus from_framedOut_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                           Fw::Buffer& sendBuffer          //!< The framed buffer
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Build the F´ frame of a payload contiguously, as Svc::FprimeFraming does
+    //!
+    //! \return the frame size
+    static U32 referenceFrame(const U8* data,         //!< Payload
+                              U32 size,               //!< Payload size
+                              bool file,              //!< Add the file packet type to the header
+                              U8* frame               //!< Receives the frame
+    );
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    SgFramer component;
+
+    //! Memory of the buffer returned by framedAllocate
+    U8 m_allocation[TEST_BUFFER_SIZE];
+
+    //! Size requested by the last framedAllocate call
+    U32 m_allocatedSize = 0;
+
+    //! Bytes of the last frame as sent on the wire
+    U8 m_wire[TEST_BUFFER_SIZE];
+
+    //! Number of bytes in m_wire
+    U32 m_wireSize = 0;
+
+    //! The last frame was sent as a descriptor
+    bool m_wasScatterGather = false;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,452 @@
+// ======================================================================
+// \title  SgTcpServer.cpp
+// \author ortega
+// \brief  cpp file for SgTcpServer component implementation class
+// ======================================================================
+
+#include "Components/SgTcpServer/SgTcpServer.hpp"
+#include "Components/SgFramer/SgFrame.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Logger/Logger.hpp"
+#include "Fw/Types/StringUtils.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+namespace Components {
+
+namespace {
+//! Time waited before listening again, or allocating again when the buffers are exhausted
+void backOff(long milliseconds) {
+    const struct timespec delay = {milliseconds / 1000, (milliseconds % 1000) * 1000000L};
+    (void)nanosleep(&delay, nullptr);
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+SgTcpServer ::SgTcpServer(const char* const compName) : SgTcpServerComponentBase(compName) {
+    this->m_hostname[0] = '\0';
+}
+
+SgTcpServer ::~SgTcpServer() {
+    const int listenFd = this->m_listenFd.exchange(-1);
+    if (listenFd >= 0) {
+        (void)close(listenFd);
+    }
+}
+
+void SgTcpServer ::configureBatching(Fw::MemAllocator& allocator,
+                                     NATIVE_UINT_TYPE identifier,
+                                     U32 maxBytes,
+                                     U32 windowUs) {
+    FW_ASSERT(!this->m_running.load());
+    FW_ASSERT(this->m_batch == nullptr);
+    FW_ASSERT(maxBytes > 0);
+    NATIVE_UINT_TYPE size = maxBytes;
+    bool recoverable = false;
+    this->m_batch = static_cast<U8*>(allocator.allocate(identifier, size, recoverable));
+    FW_ASSERT(this->m_batch != nullptr);
+    FW_ASSERT(size >= maxBytes, static_cast<FwAssertArgType>(size), static_cast<FwAssertArgType>(maxBytes));
+    this->m_batchIdentifier = identifier;
+    this->m_batchCapacity = maxBytes;
+    this->m_batchWindow = std::chrono::microseconds(windowUs);
+}
+
+void SgTcpServer ::deallocateBatching(Fw::MemAllocator& allocator) {
+    FW_ASSERT(!this->m_running.load());
+    if (this->m_batch != nullptr) {
+        allocator.deallocate(this->m_batchIdentifier, this->m_batch);
+        this->m_batch = nullptr;
+        this->m_batchCapacity = 0;
+    }
+}
+
+void SgTcpServer ::configure(const char* hostname, U16 port) {
+    FW_ASSERT(hostname != nullptr);
+    (void)Fw::StringUtils::string_copy(this->m_hostname, hostname, sizeof(this->m_hostname));
+    this->m_port = port;
+}
+
+void SgTcpServer ::start(const Fw::StringBase& name, bool reconnect, FwSizeType priority, FwSizeType stackSize) {
+    FW_ASSERT(!this->m_running.load());
+    this->m_reconnect = reconnect;
+    this->m_running.store(true);
+    // Listening before the task starts lets clients connect right away; the task retries when this fails
+    if (this->m_listenFd.load() < 0) {
+        (void)this->openListener();
+    }
+    Os::Task::Arguments arguments(name, SgTcpServer::receiveTask, this, priority, stackSize);
+    Os::Task::Status status = this->m_task.start(arguments);
+    FW_ASSERT(status == Os::Task::OP_OK, static_cast<FwAssertArgType>(status));
+    if (this->m_batch != nullptr) {
+        Os::Task::Arguments flushArguments(Os::TaskString("DownlinkFlush"), SgTcpServer::flushTask, this, priority,
+                                           stackSize);
+        status = this->m_flushTask.start(flushArguments);
+        FW_ASSERT(status == Os::Task::OP_OK, static_cast<FwAssertArgType>(status));
+        this->m_flushStarted = true;
+    }
+}
+
+bool SgTcpServer ::listen() {
+    FW_ASSERT(!this->m_running.load());
+    return (this->m_listenFd.load() >= 0) || this->openListener();
+}
+
+U16 SgTcpServer ::getListenPort() const {
+    return this->m_listenPort.load();
+}
+
+void SgTcpServer ::stop() {
+    this->m_running.store(false);
+    // Shutting the sockets down wakes the receive task from accept and recv
+    const int listenFd = this->m_listenFd.load();
+    if (listenFd >= 0) {
+        (void)shutdown(listenFd, SHUT_RDWR);
+    }
+    {
+        Os::ScopeLock lock(this->m_lock);
+        if (this->m_fd >= 0) {
+            (void)shutdown(this->m_fd, SHUT_RDWR);
+        }
+    }
+    // Taking the batch mutex orders the store above before the flush task's next check of m_running
+    {
+        std::lock_guard<std::mutex> batchLock(this->m_batchMutex);
+    }
+    this->m_batchCondition.notify_all();
+}
+
+Os::Task::Status SgTcpServer ::join() {
+    Os::Task::Status status = this->m_task.join();
+    if (this->m_flushStarted) {
+        const Os::Task::Status flushStatus = this->m_flushTask.join();
+        this->m_flushStarted = false;
+        if (status == Os::Task::OP_OK) {
+            status = flushStatus;
+        }
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+Drv::SendStatus SgTcpServer ::send_handler(FwIndexType portNum, Fw::Buffer& fwBuffer) {
+    struct iovec vectors[3];
+    U32 count = 0;
+    SgFrame frame;
+    if (SgFrame::read(fwBuffer, frame)) {
+        // The payload is borrowed from the framer and only valid until this handler returns
+        vectors[0].iov_base = frame.header;
+        vectors[0].iov_len = frame.headerSize;
+        vectors[1].iov_base = const_cast<U8*>(frame.payload);
+        vectors[1].iov_len = frame.payloadSize;
+        vectors[2].iov_base = frame.trailer;
+        vectors[2].iov_len = frame.trailerSize;
+        count = 3;
+    } else {
+        vectors[0].iov_base = fwBuffer.getData();
+        vectors[0].iov_len = fwBuffer.getSize();
+        count = 1;
+    }
+
+    const bool sent =
+        (this->m_batch != nullptr) ? this->batchSend(vectors, count) : this->writeClient(vectors, count, 1);
+    // Without a client the frame is dropped; ComStub holds the queue until ready announces the next client
+    this->deallocate_out(0, fwBuffer);
+    return sent ? Drv::SendStatus::SEND_OK : Drv::SendStatus::SEND_ERROR;
+}
+
+void SgTcpServer ::run_handler(FwIndexType portNum, U32 context) {
+    U32 frames = 0;
+    U32 writes = 0;
+    U64 latencySumUs = 0;
+    U32 latencyMaxUs = 0;
+    U32 totalWrites = 0;
+    U32 framesLost = 0;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        frames = this->m_periodFrames;
+        writes = this->m_periodWrites;
+        latencySumUs = this->m_periodLatencySumUs;
+        latencyMaxUs = this->m_periodLatencyMaxUs;
+        totalWrites = this->m_writes;
+        framesLost = this->m_framesLost;
+        this->m_periodFrames = 0;
+        this->m_periodWrites = 0;
+        this->m_periodLatencySumUs = 0;
+        this->m_periodLatencyMaxUs = 0;
+    }
+    this->tlmWrite_FramesPerWrite((writes > 0) ? static_cast<F32>(frames) / static_cast<F32>(writes) : 0.0f);
+    this->tlmWrite_BatchLatencyMean((frames > 0) ? static_cast<U32>(latencySumUs / frames) : 0);
+    this->tlmWrite_BatchLatencyMax(latencyMaxUs);
+    this->tlmWrite_SocketWrites(totalWrites);
+    this->tlmWrite_FramesLost(framesLost);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void SgTcpServer ::receiveTask(void* pointer) {
+    FW_ASSERT(pointer != nullptr);
+    static_cast<SgTcpServer*>(pointer)->receiveLoop();
+}
+
+void SgTcpServer ::receiveLoop() {
+    while (this->m_running.load()) {
+        if ((this->m_listenFd.load() < 0) && !this->openListener()) {
+            backOff(1000);
+            continue;
+        }
+        const int client = accept(this->m_listenFd.load(), nullptr, nullptr);
+        if (client < 0) {
+            if ((errno != EINTR) && this->m_running.load()) {
+                Fw::Logger::log("[WARNING] SgTcpServer: accept failed: error %d\n", errno);
+                backOff(100);
+            }
+            continue;
+        }
+        {
+            Os::ScopeLock lock(this->m_lock);
+            this->m_fd = client;
+        }
+        Fw::Logger::log("[INFO] SgTcpServer: client connected on port %u\n", this->m_listenPort.load());
+        if (this->isConnected_ready_OutputPort(0)) {
+            this->ready_out(0);
+        }
+
+        // Deliver what the client sends until it disconnects or the server stops
+        while (this->m_running.load()) {
+            Fw::Buffer buffer = this->allocate_out(0, RECV_BUFFER_SIZE);
+            if ((buffer.getData() == nullptr) || (buffer.getSize() == 0)) {
+                backOff(10);
+                continue;
+            }
+            const ssize_t received = recv(client, buffer.getData(), buffer.getSize(), 0);
+            if (received > 0) {
+                buffer.setSize(static_cast<U32>(received));
+                this->recv_out(0, buffer, Drv::RecvStatus::RECV_OK);
+                continue;
+            }
+            const int error = errno;
+            this->deallocate_out(0, buffer);
+            if ((received < 0) && (error == EINTR)) {
+                continue;
+            }
+            break;
+        }
+        {
+            Os::ScopeLock lock(this->m_lock);
+            this->m_fd = -1;
+        }
+        {
+            // A write still in progress ends on the shut down connection before the socket is closed under it
+            (void)shutdown(client, SHUT_RDWR);
+            std::lock_guard<std::mutex> sendLock(this->m_sendMutex);
+            (void)close(client);
+        }
+        Fw::Logger::log("[INFO] SgTcpServer: client disconnected\n");
+        if (!this->m_reconnect) {
+            break;
+        }
+    }
+    const int listenFd = this->m_listenFd.exchange(-1);
+    if (listenFd >= 0) {
+        (void)close(listenFd);
+    }
+    this->m_listenPort.store(0);
+}
+
+void SgTcpServer ::flushTask(void* pointer) {
+    FW_ASSERT(pointer != nullptr);
+    static_cast<SgTcpServer*>(pointer)->flushLoop();
+}
+
+void SgTcpServer ::flushLoop() {
+    std::unique_lock<std::mutex> batchLock(this->m_batchMutex);
+    while (this->m_running.load()) {
+        if (this->m_batchFrames == 0) {
+            this->m_batchCondition.wait(batchLock);
+            continue;
+        }
+        // Frames arriving while waiting join the batch; one filling it is written by the send path instead
+        const std::chrono::steady_clock::time_point deadline = this->m_batchFirst + this->m_batchWindow;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            this->flushBatch();
+        } else {
+            (void)this->m_batchCondition.wait_until(batchLock, deadline);
+        }
+    }
+    // The connection is shut down by now, so what is left is counted lost
+    this->flushBatch();
+}
+
+bool SgTcpServer ::batchSend(const struct iovec* vectors, U32 count) {
+    U32 frameSize = 0;
+    for (U32 index = 0; index < count; index++) {
+        frameSize += static_cast<U32>(vectors[index].iov_len);
+    }
+    std::lock_guard<std::mutex> batchLock(this->m_batchMutex);
+    {
+        // Frames are refused as the unbatched ones are, so ComStub waits for a client in both modes
+        Os::ScopeLock lock(this->m_lock);
+        if (this->m_fd < 0) {
+            return false;
+        }
+    }
+    if ((this->m_batchSize + frameSize) > this->m_batchCapacity) {
+        this->flushBatch();
+    }
+    if (frameSize > this->m_batchCapacity) {
+        // Too large to batch: written on its own, after the frames batched before it
+        struct iovec pieces[3];
+        FW_ASSERT(count <= FW_NUM_ARRAY_ELEMENTS(pieces), static_cast<FwAssertArgType>(count));
+        (void)memcpy(pieces, vectors, count * sizeof(struct iovec));
+        return this->writeClient(pieces, count, 1);
+    }
+
+    // The payload is only borrowed for the duration of the send call, so the frame is copied into the batch: with
+    // batching on, the gather write saves no copy
+    for (U32 index = 0; index < count; index++) {
+        (void)memcpy(this->m_batch + this->m_batchSize, vectors[index].iov_base, vectors[index].iov_len);
+        this->m_batchSize += static_cast<U32>(vectors[index].iov_len);
+    }
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (this->m_batchFrames == 0) {
+        this->m_batchFirst = now;
+        this->m_batchArrivalSum = std::chrono::steady_clock::duration::zero();
+        this->m_batchCondition.notify_one();
+    } else {
+        this->m_batchArrivalSum += now - this->m_batchFirst;
+    }
+    this->m_batchFrames++;
+    if (this->m_batchSize == this->m_batchCapacity) {
+        this->flushBatch();
+    }
+    return true;
+}
+
+void SgTcpServer ::flushBatch() {
+    if (this->m_batchFrames == 0) {
+        return;
+    }
+    // Each frame waited from its arrival until now: the sum is frames * (now - first) less the arrival offsets
+    const std::chrono::steady_clock::duration oldest = std::chrono::steady_clock::now() - this->m_batchFirst;
+    const U64 latencyMaxUs =
+        static_cast<U64>(std::chrono::duration_cast<std::chrono::microseconds>(oldest).count());
+    const U64 latencySumUs = static_cast<U64>(
+        std::chrono::duration_cast<std::chrono::microseconds>(oldest * this->m_batchFrames - this->m_batchArrivalSum)
+            .count());
+
+    struct iovec vector;
+    vector.iov_base = this->m_batch;
+    vector.iov_len = this->m_batchSize;
+    const bool written = this->writeClient(&vector, 1, this->m_batchFrames);
+    {
+        Os::ScopeLock lock(this->m_lock);
+        if (written) {
+            this->m_periodLatencySumUs += latencySumUs;
+            this->m_periodLatencyMaxUs = FW_MAX(this->m_periodLatencyMaxUs, static_cast<U32>(latencyMaxUs));
+        } else {
+            this->m_framesLost += this->m_batchFrames;
+        }
+    }
+    this->m_batchSize = 0;
+    this->m_batchFrames = 0;
+}
+
+bool SgTcpServer ::writeClient(struct iovec* vectors, U32 count, U32 frames) {
+    std::lock_guard<std::mutex> sendLock(this->m_sendMutex);
+    int fd = -1;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        fd = this->m_fd;
+    }
+    if (fd < 0) {
+        return false;
+    }
+    // The receive task closes the client only with m_sendMutex held, so fd stays open during the write. stop shuts
+    // it down, which ends a write blocked on a client that stopped reading.
+    if (!writeAll(fd, vectors, count)) {
+        // The receive task sees the connection end, closes it and waits for a new client
+        (void)shutdown(fd, SHUT_RDWR);
+        return false;
+    }
+    Os::ScopeLock lock(this->m_lock);
+    this->m_periodFrames += frames;
+    this->m_periodWrites++;
+    this->m_writes++;
+    return true;
+}
+
+bool SgTcpServer ::openListener() {
+    struct sockaddr_in address;
+    (void)memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(this->m_port);
+    if (inet_pton(AF_INET, this->m_hostname, &address.sin_addr) != 1) {
+        Fw::Logger::log("[ERROR] SgTcpServer: invalid address %s\n", this->m_hostname);
+        return false;
+    }
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        Fw::Logger::log("[ERROR] SgTcpServer: failed to create socket: error %d\n", errno);
+        return false;
+    }
+    const int enable = 1;
+    (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    socklen_t length = sizeof(address);
+    if ((bind(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0) || (::listen(fd, 1) != 0) ||
+        (getsockname(fd, reinterpret_cast<struct sockaddr*>(&address), &length) != 0)) {
+        Fw::Logger::log("[ERROR] SgTcpServer: failed to listen on %s:%u: error %d\n", this->m_hostname, this->m_port,
+                        errno);
+        (void)close(fd);
+        return false;
+    }
+    this->m_listenPort.store(ntohs(address.sin_port));
+    this->m_listenFd.store(fd);
+    Fw::Logger::log("[INFO] SgTcpServer: listening on %s:%u\n", this->m_hostname, this->m_listenPort.load());
+    return true;
+}
+
+bool SgTcpServer ::writeAll(int fd, struct iovec* vectors, U32 count) {
+    // sendmsg is the gather write taking flags: a client gone away is reported as EPIPE instead of raising SIGPIPE
+    while (count > 0) {
+        struct msghdr message;
+        (void)memset(&message, 0, sizeof(message));
+        message.msg_iov = vectors;
+        message.msg_iovlen = count;
+        const ssize_t written = sendmsg(fd, &message, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        // Skip what was written and resume inside the first piece not fully written
+        size_t remaining = static_cast<size_t>(written);
+        while ((count > 0) && (remaining >= vectors->iov_len)) {
+            remaining -= vectors->iov_len;
+            vectors++;
+            count--;
+        }
+        if (count > 0) {
+            vectors->iov_base = static_cast<U8*>(vectors->iov_base) + remaining;
+            vectors->iov_len -= remaining;
+        }
+    }
+    return true;
+}
+
+}  // namespace Components
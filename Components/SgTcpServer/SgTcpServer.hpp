@@ -0,0 +1,193 @@
+// ======================================================================
+// \title  SgTcpServer.hpp
+// \author ortega
+// \brief  hpp file for SgTcpServer component implementation class
+// ======================================================================
+
+#ifndef Components_SgTcpServer_HPP
+#define Components_SgTcpServer_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "Components/SgTcpServer/SgTcpServerComponentAc.hpp"
+#include "Fw/Types/MemAllocator.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
+
+struct iovec;
+
+namespace Components {
+
+class SgTcpServer : public SgTcpServerComponentBase {
+  public:
+    //! Size of the buffers the received bytes are delivered in
+    static const U32 RECV_BUFFER_SIZE = 1024;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct SgTcpServer object
+    SgTcpServer(const char* const compName  //!< The component name
+    );
+
+    //! Destroy SgTcpServer object
+    ~SgTcpServer();
+
+    //! Set the address the server listens on
+    void configure(const char* hostname,  //!< Address to listen on, e.g. 0.0.0.0
+                   U16 port               //!< Port to listen on, 0 for an ephemeral port
+    );
+
+    //! Coalesce the frames into batches, each written by one socket call. Frames are copied into the batch, which
+    //! is written once it holds maxBytes or once its oldest frame waited for window. The payload of a scatter-gather
+    //! frame is only borrowed for the send call, so batching gives up the zero-copy write: every batched frame is
+    //! copied once. Call before start.
+    void configureBatching(Fw::MemAllocator& allocator,     //!< Allocator of the batch buffer
+                           NATIVE_UINT_TYPE identifier,     //!< Allocation identifier of the batch buffer
+                           U32 maxBytes,                    //!< Size of the batch buffer and flush threshold
+                           U32 windowUs                     //!< Longest time a frame waits in a batch
+    );
+
+    //! Return the batch buffer to its allocator. Call after join.
+    void deallocateBatching(Fw::MemAllocator& allocator  //!< Allocator given to configureBatching
+    );
+
+    //! Open the listening socket ahead of start, so the bring-up can overlap it with other work. Clients connecting
+    //! before start wait in the backlog: nothing is received or sent until start. Call after configure.
+    //!
+    //! \return true when listening
+    bool listen();
+
+    //! Listen unless listen did already, then start the task accepting a client and receiving from it, and the task
+    //! flushing the batches when batching is configured
+    void start(const Fw::StringBase& name,  //!< Name of the receive task
+               bool reconnect,              //!< Accept a new client when the current one disconnects
+               FwSizeType priority = Os::Task::TASK_DEFAULT,  //!< Priority of the receive and flush tasks
+               FwSizeType stackSize = Os::Task::TASK_DEFAULT  //!< Stack size of the receive and flush tasks
+    );
+
+    //! \return the port the server listens on, 0 when not listening
+    U16 getListenPort() const;
+
+    //! Ask the receive and flush tasks to close the connections and exit
+    void stop();
+
+    //! Wait for the receive and flush tasks to exit
+    Os::Task::Status join();
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for send
+        //!
+        //! Writes the frame, or the pieces of a scatter-gather frame, with one gather write, or adds it to the batch
+        Drv::SendStatus
+        send_handler(FwIndexType portNum,  //!< The port number
+                     Fw::Buffer& fwBuffer  //!< The buffer to send
+                     ) override;
+
+    //! Handler implementation for run
+    //!
+    //! Reports the send statistics of the last period
+    void run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Entry point of the receive task
+        static void
+        receiveTask(void* pointer  //!< The SgTcpServer
+        );
+
+    //! Accept clients and deliver what they send until stopped
+    void receiveLoop();
+
+    //! Entry point of the flush task
+    static void flushTask(void* pointer  //!< The SgTcpServer
+    );
+
+    //! Write the batches whose oldest frame waited for the window, until stopped
+    void flushLoop();
+
+    //! Add a frame to the batch, writing the batch first when the frame does not fit and once the batch is full.
+    //! A frame larger than the batch buffer is written on its own.
+    //!
+    //! \return false without a client or when the frame written on its own failed
+    bool batchSend(const struct iovec* vectors,  //!< Pieces of the frame
+                   U32 count                     //!< Number of pieces, at most 3
+    );
+
+    //! Write the batch to the client and empty it, with m_batchMutex held. Frames not written are counted lost.
+    void flushBatch();
+
+    //! Write pieces to the client and count the write. The socket call runs with m_sendMutex held, which keeps the
+    //! client open, and without m_lock, so stop, run and the receive task are never held up by a slow client. A failed
+    //! write shuts the connection down.
+    //!
+    //! \return true when written, false without a client or when the write failed
+    bool writeClient(struct iovec* vectors,  //!< Pieces to write, updated as they are written
+                     U32 count,              //!< Number of pieces
+                     U32 frames              //!< Number of frames in the pieces
+    );
+
+    //! Open the listening socket
+    //!
+    //! \return true when listening
+    bool openListener();
+
+    //! Write all the bytes of the vectors, resuming after partial writes
+    //!
+    //! \return true when everything was written
+    static bool writeAll(int fd,                 //!< Connected socket
+                         struct iovec* vectors,  //!< Pieces to write, updated as they are written
+                         U32 count               //!< Number of pieces
+    );
+
+    char m_hostname[64];                 //! Address to listen on
+    U16 m_port = 0;                      //! Port to listen on
+    std::atomic<U16> m_listenPort{0};    //! Port actually listened on
+    std::atomic<int> m_listenFd{-1};     //! Listening socket, -1 when not listening
+    int m_fd = -1;                       //! Connected client, -1 when none. Changed under m_lock.
+    bool m_reconnect = true;             //! Accept a new client after a disconnection
+    std::atomic<bool> m_running{false};  //! The tasks are asked to run
+    Os::Mutex m_lock;                    //! Guards m_fd and the write statistics, never held across a socket call
+    std::mutex m_sendMutex;              //! Serializes the writes; the receive task takes it before closing a client
+    Os::Task m_task;                     //! The receive task
+
+    // Batching state, guarded by m_batchMutex. Locks are taken in the order m_batchMutex, m_sendMutex, m_lock.
+    std::mutex m_batchMutex;                                      //! Guards the batch
+    std::condition_variable m_batchCondition;                     //! Signals a new batch or a stop to the flush task
+    U8* m_batch = nullptr;                                        //! Batch buffer, nullptr when not batching
+    NATIVE_UINT_TYPE m_batchIdentifier = 0;                       //! Allocation identifier of the batch buffer
+    U32 m_batchCapacity = 0;                                      //! Size of the batch buffer
+    std::chrono::microseconds m_batchWindow{0};                   //! Longest wait of a frame in the batch
+    U32 m_batchSize = 0;                                          //! Bytes in the batch
+    U32 m_batchFrames = 0;                                        //! Frames in the batch
+    std::chrono::steady_clock::time_point m_batchFirst;           //! Arrival of the oldest frame of the batch
+    std::chrono::steady_clock::duration m_batchArrivalSum{0};     //! Sum of the frame arrivals since m_batchFirst
+    Os::Task m_flushTask;                                         //! The flush task
+    bool m_flushStarted = false;                                  //! The flush task was started
+
+    // Statistics of the report period, guarded by m_lock
+    U32 m_periodFrames = 0;        //! Frames written
+    U32 m_periodWrites = 0;        //! Socket writes
+    U64 m_periodLatencySumUs = 0;  //! Sum of the batch waits of the frames written
+    U32 m_periodLatencyMaxUs = 0;  //! Longest batch wait of a frame written
+    U32 m_writes = 0;              //! Socket writes since startup
+    U32 m_framesLost = 0;          //! Batched frames that could not be written
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,47 @@
+// ======================================================================
+// \title  SgTcpServerTestMain.cpp
+// \author ortega
+// \brief  cpp file for SgTcpServer component test main function
+// ======================================================================
+
+#include "SgTcpServerTester.hpp"
+
+TEST(Nominal, TestScatterGatherSend) {
+    Components::SgTcpServerTester tester;
+    tester.testScatterGatherSend();
+}
+
+TEST(Nominal, TestPlainSendAndReceive) {
+    Components::SgTcpServerTester tester;
+    tester.testPlainSendAndReceive();
+}
+
+TEST(OffNominal, TestNoClient) {
+    Components::SgTcpServerTester tester;
+    tester.testNoClient();
+}
+
+TEST(OffNominal, TestStalledClient) {
+    Components::SgTcpServerTester tester;
+    tester.testStalledClient();
+}
+
+TEST(Batching, TestBatchThreshold) {
+    Components::SgTcpServerTester tester;
+    tester.testBatchThreshold();
+}
+
+TEST(Batching, TestBatchWindow) {
+    Components::SgTcpServerTester tester;
+    tester.testBatchWindow();
+}
+
+TEST(Batching, TestBatchOversize) {
+    Components::SgTcpServerTester tester;
+    tester.testBatchOversize();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
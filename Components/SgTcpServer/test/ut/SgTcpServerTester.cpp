@@ -0,0 +1,295 @@
+// ======================================================================
+// \title  SgTcpServerTester.cpp
+// \author ortega
+// \brief  cpp file for SgTcpServer component test harness implementation class
+// ======================================================================
+
+#include "SgTcpServerTester.hpp"
+#include "Components/SgFramer/SgFrame.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace Components {
+
+namespace {
+//! Longest wait for the receive task, in milliseconds
+const U32 WAIT_TIMEOUT_MS = 2000;
+
+//! Allocation identifier of the batch buffer
+const NATIVE_UINT_TYPE BATCH_MEMORY_ID = 7;
+
+//! Batch window long enough that the flush task never writes during the threshold tests
+const U32 LONG_WINDOW_US = 10000000;
+
+//! Batch window of the window test
+const U32 SHORT_WINDOW_US = 20000;
+
+//! Frame larger than the socket buffers of a loopback connection, so writing it blocks until the client reads
+const U32 STALL_FRAME_SIZE = 64 * 1024 * 1024;
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+SgTcpServerTester ::SgTcpServerTester()
+    : SgTcpServerGTestBase("SgTcpServerTester", SgTcpServerTester::MAX_HISTORY_SIZE), component("SgTcpServer") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+SgTcpServerTester ::~SgTcpServerTester() {
+    this->component.deallocateBatching(this->m_allocator);
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void SgTcpServerTester ::testScatterGatherSend() {
+    const int client = this->startAndConnect();
+
+    // Pieces kept apart in memory, as the framer leaves them
+    static const char PAYLOAD[] = "payload bytes";
+    SgFrame frame;
+    (void)memset(&frame, 0, sizeof(frame));
+    frame.magic = SgFrame::MAGIC;
+    (void)memcpy(frame.header, "HEAD", 4);
+    frame.headerSize = 4;
+    frame.payload = reinterpret_cast<const U8*>(PAYLOAD);
+    frame.payloadSize = sizeof(PAYLOAD) - 1;
+    (void)memcpy(frame.trailer, "TR", 2);
+    frame.trailerSize = 2;
+    U8 descriptor[sizeof(SgFrame)];
+    Fw::Buffer buffer(descriptor, sizeof(descriptor));
+    SgFrame::write(frame, buffer);
+
+    ASSERT_EQ(this->invoke_to_send(0, buffer), Drv::SendStatus::SEND_OK);
+    ASSERT_EQ(this->m_deallocated.load(), 1U);
+    U8 wire[64];
+    readClient(client, wire, frame.frameSize());
+    ASSERT_EQ(memcmp(wire, "HEADpayload bytesTR", frame.frameSize()), 0);
+    this->stopAndClose(client);
+}
+
+void SgTcpServerTester ::testPlainSendAndReceive() {
+    const int client = this->startAndConnect();
+
+    U8 plain[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+    Fw::Buffer buffer(plain, sizeof(plain));
+    ASSERT_EQ(this->invoke_to_send(0, buffer), Drv::SendStatus::SEND_OK);
+    U8 wire[sizeof(plain)];
+    readClient(client, wire, sizeof(wire));
+    ASSERT_EQ(memcmp(wire, plain, sizeof(plain)), 0);
+
+    // Bytes from the client are delivered on recv
+    static const char UPLINK[] = "uplink";
+    ASSERT_EQ(write(client, UPLINK, sizeof(UPLINK) - 1), static_cast<ssize_t>(sizeof(UPLINK) - 1));
+    ASSERT_TRUE(waitFor(this->m_hasReceived));
+    {
+        Os::ScopeLock lock(this->m_receivedLock);
+        ASSERT_EQ(this->m_receivedSize, sizeof(UPLINK) - 1);
+        ASSERT_EQ(memcmp(this->m_received, UPLINK, this->m_receivedSize), 0);
+    }
+    this->stopAndClose(client);
+}
+
+void SgTcpServerTester ::testNoClient() {
+    U8 plain[] = {1, 2, 3};
+    Fw::Buffer buffer(plain, sizeof(plain));
+    ASSERT_EQ(this->invoke_to_send(0, buffer), Drv::SendStatus::SEND_ERROR);
+    ASSERT_EQ(this->m_deallocated.load(), 1U);
+
+    // Listening ahead of start accepts no client yet
+    this->component.configure("127.0.0.1", 0);
+    ASSERT_TRUE(this->component.listen());
+    ASSERT_NE(this->component.getListenPort(), 0U);
+    ASSERT_EQ(this->invoke_to_send(0, buffer), Drv::SendStatus::SEND_ERROR);
+    ASSERT_FALSE(this->m_ready.load());
+}
+
+void SgTcpServerTester ::testStalledClient() {
+    const int client = this->startAndConnect();
+
+    // The client never reads, so the write fills the socket buffers and blocks
+    std::vector<U8> frame(STALL_FRAME_SIZE, 0x5A);
+    std::atomic<bool> sent(false);
+    Drv::SendStatus status = Drv::SendStatus::SEND_OK;
+    std::thread sender([this, &frame, &sent, &status] {
+        Fw::Buffer buffer(frame.data(), static_cast<U32>(frame.size()));
+        status = this->invoke_to_send(0, buffer);
+        sent.store(true);
+    });
+    (void)usleep(100000);
+    ASSERT_FALSE(sent.load());
+
+    // The statistics are reported meanwhile
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SocketWrites_SIZE(1);
+    ASSERT_TLM_SocketWrites(0, 0U);
+
+    // Stopping shuts the connection down, which fails the blocked write
+    this->component.stop();
+    ASSERT_TRUE(waitFor(sent));
+    sender.join();
+    ASSERT_EQ(status, Drv::SendStatus::SEND_ERROR);
+    ASSERT_EQ(this->m_deallocated.load(), 1U);
+    ASSERT_EQ(this->component.join(), Os::Task::OP_OK);
+    (void)close(client);
+}
+
+void SgTcpServerTester ::testBatchThreshold() {
+    // Three four-byte frames fill the batch exactly
+    this->component.configureBatching(this->m_allocator, BATCH_MEMORY_ID, 12, LONG_WINDOW_US);
+    const int client = this->startAndConnect();
+
+    this->sendFrame(0x10);
+    this->sendFrame(0x20);
+    this->sendFrame(0x30);
+    ASSERT_EQ(this->m_deallocated.load(), 3U);
+    U8 wire[12];
+    readClient(client, wire, sizeof(wire));
+    const U8 expected[] = {0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x33};
+    ASSERT_EQ(memcmp(wire, expected, sizeof(expected)), 0);
+
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesPerWrite_SIZE(1);
+    ASSERT_TLM_FramesPerWrite(0, 3.0f);
+    ASSERT_TLM_SocketWrites(0, 1U);
+    ASSERT_TLM_FramesLost(0, 0U);
+    this->stopAndClose(client);
+}
+
+void SgTcpServerTester ::testBatchWindow() {
+    this->component.configureBatching(this->m_allocator, BATCH_MEMORY_ID, 1024, SHORT_WINDOW_US);
+    const int client = this->startAndConnect();
+
+    this->sendFrame(0x40);
+    this->sendFrame(0x50);
+    // Written by the flush task once the first frame waited for the window
+    U8 wire[8];
+    readClient(client, wire, sizeof(wire));
+    const U8 expected[] = {0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x53};
+    ASSERT_EQ(memcmp(wire, expected, sizeof(expected)), 0);
+
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesPerWrite(0, 2.0f);
+    ASSERT_TLM_SocketWrites(0, 1U);
+    ASSERT_GE(this->tlmHistory_BatchLatencyMax->at(0).arg, SHORT_WINDOW_US);
+    ASSERT_LE(this->tlmHistory_BatchLatencyMean->at(0).arg, this->tlmHistory_BatchLatencyMax->at(0).arg);
+
+    // Nothing written since the last report
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesPerWrite(1, 0.0f);
+    ASSERT_TLM_BatchLatencyMax(1, 0U);
+    this->stopAndClose(client);
+}
+
+void SgTcpServerTester ::testBatchOversize() {
+    this->component.configureBatching(this->m_allocator, BATCH_MEMORY_ID, 6, LONG_WINDOW_US);
+    const int client = this->startAndConnect();
+
+    this->sendFrame(0x60);
+    U8 large[] = {0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77};
+    Fw::Buffer buffer(large, sizeof(large));
+    ASSERT_EQ(this->invoke_to_send(0, buffer), Drv::SendStatus::SEND_OK);
+    U8 wire[12];
+    readClient(client, wire, sizeof(wire));
+    const U8 expected[] = {0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77};
+    ASSERT_EQ(memcmp(wire, expected, sizeof(expected)), 0);
+
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesPerWrite(0, 1.0f);
+    ASSERT_TLM_SocketWrites(0, 2U);
+    this->stopAndClose(client);
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+Fw::Buffer SgTcpServerTester ::from_allocate_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    return Fw::Buffer(this->m_recvMemory, FW_MIN(size, static_cast<U32>(sizeof(this->m_recvMemory))));
+}
+
+void SgTcpServerTester ::from_deallocate_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->m_deallocated.fetch_add(1);
+}
+
+void SgTcpServerTester ::from_recv_handler(const NATIVE_INT_TYPE portNum,
+                                           Fw::Buffer& recvBuffer,
+                                           const Drv::RecvStatus& recvStatus) {
+    Os::ScopeLock lock(this->m_receivedLock);
+    EXPECT_EQ(recvStatus, Drv::RecvStatus::RECV_OK);
+    const U32 size = FW_MIN(recvBuffer.getSize(), static_cast<U32>(sizeof(this->m_received) - this->m_receivedSize));
+    (void)memcpy(&this->m_received[this->m_receivedSize], recvBuffer.getData(), size);
+    this->m_receivedSize += size;
+    this->m_hasReceived.store(true);
+}
+
+void SgTcpServerTester ::from_ready_handler(const NATIVE_INT_TYPE portNum) {
+    this->m_ready.store(true);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+int SgTcpServerTester ::startAndConnect() {
+    this->component.configure("127.0.0.1", 0);
+    this->component.start(Fw::String("SgTcpServerUt"), false);
+    const U16 port = this->component.getListenPort();
+    EXPECT_NE(port, 0U);
+
+    const int client = socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_GE(client, 0);
+    struct sockaddr_in address;
+    (void)memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    EXPECT_EQ(connect(client, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)), 0);
+    // Sends only succeed once the server has the client
+    EXPECT_TRUE(waitFor(this->m_ready));
+    return client;
+}
+
+void SgTcpServerTester ::stopAndClose(int client) {
+    this->component.stop();
+    ASSERT_EQ(this->component.join(), Os::Task::OP_OK);
+    (void)close(client);
+}
+
+void SgTcpServerTester ::sendFrame(U8 first) {
+    U8 plain[] = {first, static_cast<U8>(first + 1), static_cast<U8>(first + 2), static_cast<U8>(first + 3)};
+    Fw::Buffer buffer(plain, sizeof(plain));
+    ASSERT_EQ(this->invoke_to_send(0, buffer), Drv::SendStatus::SEND_OK);
+}
+
+void SgTcpServerTester ::readClient(int client, U8* data, U32 size) {
+    U32 total = 0;
+    while (total < size) {
+        const ssize_t received = recv(client, &data[total], size - total, 0);
+        ASSERT_GT(received, 0);
+        total += static_cast<U32>(received);
+    }
+}
+
+bool SgTcpServerTester ::waitFor(const std::atomic<bool>& flag) {
+    for (U32 elapsed = 0; elapsed < WAIT_TIMEOUT_MS; elapsed++) {
+        if (flag.load()) {
+            return true;
+        }
+        (void)usleep(1000);
+    }
+    return flag.load();
+}
+
+}  // namespace Components
@@ -0,0 +1,164 @@
+// ======================================================================
+// \title  SgTcpServerTester.hpp
+// \author ortega
+// \brief  hpp file for SgTcpServer component test harness implementation class
+// ======================================================================
+
+#ifndef Components_SgTcpServerTester_HPP
+#define Components_SgTcpServerTester_HPP
+
+#include <atomic>
+
+#include "Components/SgTcpServer/SgTcpServer.hpp"
+#include "Components/SgTcpServer/SgTcpServerGTestBase.hpp"
+#include "Fw/Types/MallocAllocator.hpp"
+#include "Os/Mutex.hpp"
+
+namespace Components {
+
+class SgTcpServerTester : public SgTcpServerGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object SgTcpServerTester
+    SgTcpServerTester();
+
+    //! Destroy object SgTcpServerTester
+    ~SgTcpServerTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! A scatter-gather frame reaches the client as header, payload and trailer back to back
+    void testScatterGatherSend();
+
+    //! Plain frames are sent as they are and client bytes are delivered on recv
+    void testPlainSendAndReceive();
+
+    //! Without a client sends fail and the buffer is still returned, also once listening ahead of start
+    void testNoClient();
+
+    //! A send blocked on a client that stopped reading holds up neither run nor stop, which ends it
+    void testStalledClient();
+
+    //! Batched frames are written together by one write once the batch is full
+    void testBatchThreshold();
+
+    //! A batch not filled is written once its oldest frame waited for the window
+    void testBatchWindow();
+
+    //! A frame larger than the batch is written after the frames batched before it
+    void testBatchOversize();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for allocate, called on the receive task
+    Fw::Buffer from_allocate_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                     U32 size                        //!< The requested size
+    );
+
+    //! Handler implementation for deallocate
+    void from_deallocate_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                 Fw::Buffer& fwBuffer            //!< The returned buffer
+    );
+
+    //! Handler implementation for recv, called on the receive task
+    void from_recv_handler(const NATIVE_INT_TYPE portNum,        //!< The port number
+                           Fw::Buffer& recvBuffer,               //!< The received bytes
+                           const Drv::RecvStatus& recvStatus     //!< The receive status
+    );
+
+    //! Handler implementation for ready, called on the receive task
+    void from_ready_handler(const NATIVE_INT_TYPE portNum  //!< The port number
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Start the server on an ephemeral loopback port and connect a client to it
+    //!
+    //! \return the client socket
+    int startAndConnect();
+
+    //! Stop the server and close the client
+    void stopAndClose(int client  //!< The client socket
+    );
+
+    //! Send a plain frame of four bytes starting with first
+    void sendFrame(U8 first  //!< Value of the first byte, the others follow it
+    );
+
+    //! Read exactly size bytes from the client
+    static void readClient(int client,  //!< The client socket
+                           U8* data,    //!< Receives the bytes
+                           U32 size     //!< Number of bytes to read
+    );
+
+    //! Wait until a flag is set
+    //!
+    //! \return true when set before the timeout
+    static bool waitFor(const std::atomic<bool>& flag  //!< The flag
+    );
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    SgTcpServer component;
+
+    //! Allocator of the batch buffer
+    Fw::MallocAllocator m_allocator;
+
+    //! Memory of the receive buffer, handed out one at a time
+    U8 m_recvMemory[SgTcpServer::RECV_BUFFER_SIZE];
+
+    //! Bytes delivered on recv
+    U8 m_received[SgTcpServer::RECV_BUFFER_SIZE];
+
+    //! Number of bytes in m_received
+    U32 m_receivedSize = 0;
+
+    //! Guards the received bytes against the receive task
+    Os::Mutex m_receivedLock;
+
+    //! Set once bytes were delivered on recv
+    std::atomic<bool> m_hasReceived{false};
+
+    //! Set once the server announced a client
+    std::atomic<bool> m_ready{false};
+
+    //! Number of buffers returned on deallocate
+    std::atomic<U32> m_deallocated{0};
+};
+
+}  // namespace Components
+
+#endif
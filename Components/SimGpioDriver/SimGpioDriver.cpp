@@ -0,0 +1,139 @@
+// ======================================================================
+// \title  SimGpioDriver.cpp
+// \author ortega
+// \brief  cpp file for SimGpioDriver component implementation class
+// ======================================================================
+
+#include "Components/SimGpioDriver/SimGpioDriver.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Types/StringUtils.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+namespace Components {
+
+const U32 SimGpioDriver::SHM_MAGIC;
+const U16 SimGpioDriver::SHM_VERSION;
+
+// The layout is read by external processes, keep it stable
+static_assert(sizeof(SimGpioDriver::ShmHeader) == 64, "Shared memory header must be one cache line");
+static_assert(sizeof(SimGpioDriver::ShmRecord) == 16, "Shared memory records must be 16 bytes");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory head must be lock-free to be shared across processes");
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+SimGpioDriver ::SimGpioDriver(const char* const compName) : SimGpioDriverComponentBase(compName), m_writes(0) {
+    this->m_name[0] = '\0';
+}
+
+SimGpioDriver ::~SimGpioDriver() {
+    this->close();
+}
+
+bool SimGpioDriver ::open(const char* name, U32 capacity) {
+    FW_ASSERT(name != nullptr);
+    FW_ASSERT(capacity > 0);
+    this->close();
+    (void)Fw::StringUtils::string_copy(this->m_name, name, sizeof(this->m_name));
+
+    // Round the capacity up to a power of two so readers can index with a mask
+    U32 records = 1;
+    while (records < capacity) {
+        records <<= 1;
+    }
+    const U64 size = sizeof(ShmHeader) + static_cast<U64>(records) * sizeof(ShmRecord);
+
+    // A stale object from a previous run is replaced so readers never see an old layout
+    (void)shm_unlink(this->m_name);
+    const int fd = shm_open(this->m_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        this->log_WARNING_HI_ShmOpenError(Fw::String(this->m_name), errno);
+        return false;
+    }
+    void* memory = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+        memory = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const int error = errno;
+    (void)::close(fd);
+    if (memory == MAP_FAILED) {
+        (void)shm_unlink(this->m_name);
+        this->log_WARNING_HI_ShmOpenError(Fw::String(this->m_name), error);
+        return false;
+    }
+
+    // The object is zero-filled by ftruncate: publish the layout, magic last
+    ShmHeader* header = static_cast<ShmHeader*>(memory);
+    header->version = SHM_VERSION;
+    header->recordSize = static_cast<U16>(sizeof(ShmRecord));
+    header->capacity = records;
+    header->head.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = SHM_MAGIC;
+
+    this->m_header = header;
+    this->m_records = reinterpret_cast<ShmRecord*>(header + 1);
+    this->m_mappedSize = size;
+    this->log_ACTIVITY_HI_ShmOpened(Fw::String(this->m_name), records);
+    return true;
+}
+
+void SimGpioDriver ::close() {
+    if (this->m_header == nullptr) {
+        return;
+    }
+    (void)munmap(this->m_header, static_cast<size_t>(this->m_mappedSize));
+    (void)shm_unlink(this->m_name);
+    this->m_header = nullptr;
+    this->m_records = nullptr;
+    this->m_mappedSize = 0;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+Drv::GpioStatus SimGpioDriver ::gpioWrite_handler(FwIndexType portNum, const Fw::Logic& state) {
+    // Writes are serialized by the guarded port, so the head has a single writer
+    if (this->m_header != nullptr) {
+        struct timespec now;
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        const U64 head = this->m_header->head.load(std::memory_order_relaxed);
+        ShmRecord& record = this->m_records[head & (this->m_header->capacity - 1)];
+
+        // Invalidate the slot first so a reader still on the previous lap notices it is being overwritten
+        record.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        record.timestamp = static_cast<U64>(now.tv_sec) * 1000000000ULL + static_cast<U64>(now.tv_nsec);
+        record.port = static_cast<U16>(portNum);
+        record.level = (Fw::Logic::HIGH == state) ? 1 : 0;
+        record.sequence.store(static_cast<U32>(head + 1), std::memory_order_release);
+        this->m_header->head.store(head + 1, std::memory_order_release);
+
+        // Writes arrive on the PWM thread too: they are only counted here, the count is sent by run
+        this->m_writes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Port may not be connected, the simulator then stands in for the driver
+    if (this->isConnected_gpioWriteOut_OutputPort(portNum)) {
+        return this->gpioWriteOut_out(portNum, state);
+    }
+    return (this->m_header != nullptr) ? Drv::GpioStatus::OP_OK : Drv::GpioStatus::NOT_OPENED;
+}
+
+void SimGpioDriver ::run_handler(FwIndexType portNum, U32 context) {
+    const U32 writes = this->m_writes.load(std::memory_order_relaxed);
+    if (writes != this->m_writesSent) {
+        this->m_writesSent = writes;
+        this->tlmWrite_SimGpioWrites(writes);
+    }
+}
+
+}  // namespace Components
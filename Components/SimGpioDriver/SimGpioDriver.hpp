@@ -0,0 +1,97 @@
+// ======================================================================
+// \title  SimGpioDriver.hpp
+// \author ortega
+// \brief  hpp file for SimGpioDriver component implementation class
+// ======================================================================
+
+#ifndef Components_SimGpioDriver_HPP
+#define Components_SimGpioDriver_HPP
+
+#include <atomic>
+
+#include "Components/SimGpioDriver/SimGpioDriverComponentAc.hpp"
+
+namespace Components {
+
+class SimGpioDriver : public SimGpioDriverComponentBase {
+  public:
+    //! Magic number opening the shared memory ring ("SGPI")
+    static const U32 SHM_MAGIC = 0x53475049;
+
+    //! Version of the shared memory layout
+    static const U16 SHM_VERSION = 1;
+
+    //! Shared memory header, followed by capacity records. Fields are in native byte order.
+    struct ShmHeader {
+        U32 magic;              //!< SHM_MAGIC, written last once the ring is initialized
+        U16 version;            //!< SHM_VERSION
+        U16 recordSize;         //!< sizeof(ShmRecord)
+        U32 capacity;           //!< Number of records, a power of two
+        U32 reserved;           //!< Zero
+        std::atomic<U64> head;  //!< Number of records written since the ring was created
+        U8 padding[40];         //!< Keeps the records on their own cache line
+    };
+
+    //! One GPIO write. Record N is stored at index N % capacity.
+    struct ShmRecord {
+        U64 timestamp;              //!< CLOCK_MONOTONIC time of the write in nanoseconds
+        std::atomic<U32> sequence;  //!< Low 32 bits of N + 1, written last: a reader seeing another value lost the
+                                    //!< record to the writer
+        U16 port;                   //!< Port number the write arrived on
+        U8 level;                   //!< 1 for HIGH, 0 for LOW
+        U8 reserved;                //!< Zero
+    };
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct SimGpioDriver object
+    SimGpioDriver(const char* const compName  //!< The component name
+    );
+
+    //! Destroy SimGpioDriver object
+    ~SimGpioDriver();
+
+    //! Create the shared memory ring, replacing any previous object of the same name
+    //!
+    //! \return true when the ring is ready
+    bool open(const char* name,  //!< Name of the POSIX shared memory object, e.g. "/ledblinker_gpio"
+              U32 capacity       //!< Number of records, rounded up to a power of two
+    );
+
+    //! Unmap and unlink the shared memory ring
+    void close();
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for gpioWrite
+        //!
+        //! Publishes the write then forwards it to the real driver
+        Drv::GpioStatus
+        gpioWrite_handler(FwIndexType portNum,  //!< The port number
+                          const Fw::Logic& state  //!< The GPIO state
+                          ) override;
+
+    //! Handler implementation for run
+    //!
+    //! Sends the write count when it changed since the last call
+    void run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
+    ShmHeader* m_header = nullptr;   //! Mapped shared memory, nullptr when not open
+    ShmRecord* m_records = nullptr;  //! Records following the header
+    U64 m_mappedSize = 0;            //! Size of the mapping in bytes
+    char m_name[64];                 //! Name of the shared memory object
+    std::atomic<U32> m_writes;       //! Number of writes published, counted on the writing thread
+    U32 m_writesSent = 0;            //! Value of m_writes last sent as telemetry, run only
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,27 @@
+// ======================================================================
+// \title  SimGpioDriverTestMain.cpp
+// \author ortega
+// \brief  cpp file for SimGpioDriver component test main function
+// ======================================================================
+
+#include "SimGpioDriverTester.hpp"
+
+TEST(Nominal, TestRing) {
+    Components::SimGpioDriverTester tester;
+    tester.testRing();
+}
+
+TEST(Nominal, TestPassThrough) {
+    Components::SimGpioDriverTester tester;
+    tester.testPassThrough();
+}
+
+TEST(OffNominal, TestOpenError) {
+    Components::SimGpioDriverTester tester;
+    tester.testOpenError();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+// ======================================================================
+// \title  SimGpioDriverTester.cpp
+// \author ortega
+// \brief  cpp file for SimGpioDriver component test harness implementation class
+// ======================================================================
+
+#include "SimGpioDriverTester.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+
+namespace Components {
+
+namespace {
+//! Map an existing shared memory object read-only, as an external reader would
+const U8* mapReader(const char* name, size_t& size) {
+    const int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info;
+    void* memory = MAP_FAILED;
+    if (fstat(fd, &info) == 0) {
+        size = static_cast<size_t>(info.st_size);
+        memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+    return (memory == MAP_FAILED) ? nullptr : static_cast<const U8*>(memory);
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+SimGpioDriverTester ::SimGpioDriverTester()
+    : SimGpioDriverGTestBase("SimGpioDriverTester", SimGpioDriverTester::MAX_HISTORY_SIZE),
+      component("SimGpioDriver") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+SimGpioDriverTester ::~SimGpioDriverTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void SimGpioDriverTester ::testRing() {
+    char name[64];
+    (void)snprintf(name, sizeof(name), "/SimGpioDriverUt_%d", static_cast<int>(getpid()));
+
+    // The capacity is rounded up to a power of two
+    ASSERT_TRUE(this->component.open(name, 3));
+    ASSERT_EVENTS_ShmOpened_SIZE(1);
+    ASSERT_EVENTS_ShmOpened(0, name, 4U);
+
+    size_t size = 0;
+    const U8* memory = mapReader(name, size);
+    ASSERT_NE(memory, nullptr);
+    ASSERT_EQ(size, sizeof(SimGpioDriver::ShmHeader) + 4U * sizeof(SimGpioDriver::ShmRecord));
+    const SimGpioDriver::ShmHeader* header = reinterpret_cast<const SimGpioDriver::ShmHeader*>(memory);
+    const SimGpioDriver::ShmRecord* records = reinterpret_cast<const SimGpioDriver::ShmRecord*>(header + 1);
+    ASSERT_EQ(header->magic, SimGpioDriver::SHM_MAGIC);
+    ASSERT_EQ(header->version, SimGpioDriver::SHM_VERSION);
+    ASSERT_EQ(header->recordSize, sizeof(SimGpioDriver::ShmRecord));
+    ASSERT_EQ(header->capacity, 4U);
+    ASSERT_EQ(header->head.load(), 0U);
+
+    // Six writes wrap the ring: the last four are kept in order of their sequence numbers
+    for (U32 i = 0; i < 6; i++) {
+        const Fw::Logic state = ((i % 2) == 0) ? Fw::Logic::HIGH : Fw::Logic::LOW;
+        ASSERT_EQ(this->invoke_to_gpioWrite(0, state), Drv::GpioStatus::OP_OK);
+    }
+    ASSERT_EQ(header->head.load(), 6U);
+    // The writes are only counted: the count is sent by run, once per change
+    ASSERT_TLM_SimGpioWrites_SIZE(0);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SimGpioWrites_SIZE(1);
+    ASSERT_TLM_SimGpioWrites(0, 6U);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SimGpioWrites_SIZE(1);
+    for (U32 n = 2; n < 6; n++) {
+        const SimGpioDriver::ShmRecord& record = records[n % 4];
+        ASSERT_EQ(record.sequence.load(), n + 1);
+        ASSERT_EQ(record.level, ((n % 2) == 0) ? 1U : 0U);
+        ASSERT_EQ(record.port, 0U);
+        if (n > 2) {
+            ASSERT_GE(record.timestamp, records[(n - 1) % 4].timestamp);
+        }
+    }
+
+    // Closing removes the object
+    (void)munmap(const_cast<U8*>(memory), size);
+    this->component.close();
+    ASSERT_EQ(mapReader(name, size), nullptr);
+}
+
+void SimGpioDriverTester ::testPassThrough() {
+    this->m_driverStatus = Drv::GpioStatus::INVALID_MODE;
+    ASSERT_EQ(this->invoke_to_gpioWrite(0, Fw::Logic::HIGH), Drv::GpioStatus::INVALID_MODE);
+    ASSERT_from_gpioWriteOut_SIZE(1);
+    ASSERT_from_gpioWriteOut(0, Fw::Logic::HIGH);
+    // Nothing is published without a ring
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SimGpioWrites_SIZE(0);
+}
+
+void SimGpioDriverTester ::testOpenError() {
+    // An empty name is rejected by shm_open
+    ASSERT_FALSE(this->component.open("", 4));
+    ASSERT_EVENTS_ShmOpenError_SIZE(1);
+
+    // Writes still reach the real driver
+    ASSERT_EQ(this->invoke_to_gpioWrite(0, Fw::Logic::LOW), Drv::GpioStatus::OP_OK);
+    ASSERT_from_gpioWriteOut_SIZE(1);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SimGpioWrites_SIZE(0);
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+Drv::GpioStatus SimGpioDriverTester ::from_gpioWriteOut_handler(const NATIVE_INT_TYPE portNum,
+                                                               const Fw::Logic& state) {
+    this->pushFromPortEntry_gpioWriteOut(state);
+    return this->m_driverStatus;
+}
+
+}  // namespace Components
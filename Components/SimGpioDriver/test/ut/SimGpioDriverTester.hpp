@@ -0,0 +1,87 @@
+// ======================================================================
+// \title  SimGpioDriverTester.hpp
+// \author ortega
+// \brief  hpp file for SimGpioDriver component test harness implementation class
+// ======================================================================
+
+#ifndef Components_SimGpioDriverTester_HPP
+#define Components_SimGpioDriverTester_HPP
+
+#include "Components/SimGpioDriver/SimGpioDriver.hpp"
+#include "Components/SimGpioDriver/SimGpioDriverGTestBase.hpp"
+
+namespace Components {
+
+class SimGpioDriverTester : public SimGpioDriverGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 40;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object SimGpioDriverTester
+    SimGpioDriverTester();
+
+    //! Destroy object SimGpioDriverTester
+    ~SimGpioDriverTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Writes are published to the ring as seen by an independent mapping, wrapping when full
+    void testRing();
+
+    //! Writes are forwarded to the real driver and its status returned
+    void testPassThrough();
+
+    //! A ring that cannot be created is reported and writes are still forwarded
+    void testOpenError();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for gpioWriteOut
+    Drv::GpioStatus from_gpioWriteOut_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                              const Fw::Logic& state          //!< The GPIO state
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    SimGpioDriver component;
+
+    //! Status returned by the simulated real driver
+    Drv::GpioStatus m_driverStatus = Drv::GpioStatus::OP_OK;
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Zero-copy reader of the SimGpioDriver shared memory ring
+
+The ring is a POSIX shared memory object (a file under /dev/shm on Linux) holding a 64 byte header followed by a power
+of two number of 16 byte records, all in native byte order:
+
+    header: magic U32 ("SGPI"), version U16, record size U16, capacity U32, reserved U32, head U64
+    record: timestamp U64 (CLOCK_MONOTONIC ns), sequence U32 (record index + 1), port U16, level U8, reserved U8
+
+The writer never blocks. A reader that falls more than a capacity behind loses the oldest records, which is detected
+from the head and from the sequence number of each record.
+"""
+import mmap
+import os
+import struct
+import time
+
+MAGIC = 0x53475049
+VERSION = 1
+HEADER = struct.Struct("=IHHIIQ")
+HEAD_OFFSET = 16
+RECORD = struct.Struct("=QIHBB")
+RECORDS_OFFSET = 64
+
+
+class SimGpioRing:
+    """Read the GPIO writes published by a SimGpioDriver in the order they were made"""
+
+    def __init__(self, name, timeout=5.0):
+        path = os.path.join("/dev/shm", name.lstrip("/"))
+        deadline = time.monotonic() + timeout
+        while True:
+            try:
+                fd = os.open(path, os.O_RDONLY)
+                break
+            except FileNotFoundError:
+                if time.monotonic() > deadline:
+                    raise
+                time.sleep(0.1)
+        try:
+            self._map = mmap.mmap(fd, 0, prot=mmap.PROT_READ)
+        finally:
+            os.close(fd)
+        self._view = memoryview(self._map)
+        magic, version, record_size, capacity, _, _ = HEADER.unpack_from(self._view, 0)
+        if magic != MAGIC or version != VERSION or record_size != RECORD.size:
+            raise ValueError(f"{path} is not a version {VERSION} SimGpioDriver ring")
+        self.capacity = capacity
+        self.tail = self.head()
+        self.lost = 0
+
+    def close(self):
+        self._view.release()
+        self._map.close()
+
+    def head(self):
+        """Number of records written since the ring was created"""
+        return struct.unpack_from("=Q", self._view, HEAD_OFFSET)[0]
+
+    def read(self):
+        """Return the (timestamp ns, port, level) records written since the last read"""
+        head = self.head()
+        if head - self.tail > self.capacity:
+            self.lost += head - self.tail - self.capacity
+            self.tail = head - self.capacity
+        records = []
+        while self.tail < head:
+            offset = RECORDS_OFFSET + (self.tail % self.capacity) * RECORD.size
+            timestamp, sequence, port, level, _ = RECORD.unpack_from(self._view, offset)
+            # The writer invalidates the sequence before overwriting a record: check it again after the copy
+            recheck = struct.unpack_from("=I", self._view, offset + 8)[0]
+            if sequence != (self.tail + 1) & 0xFFFFFFFF or recheck != sequence:
+                self.lost += 1
+            else:
+                records.append((timestamp, port, level))
+            self.tail += 1
+        return records
+
+
+def main():
+    """Print the writes of a running deployment as CSV"""
+    import argparse
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("name", help="shared memory object name given to LedBlinker -g")
+    args = parser.parse_args()
+    ring = SimGpioRing(args.name)
+    print("timestamp_ns,port,level")
+    try:
+        while True:
+            for timestamp, port, level in ring.read():
+                print(f"{timestamp},{port},{level}", flush=True)
+            time.sleep(0.01)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if ring.lost:
+            print(f"# {ring.lost} records lost", flush=True)
+        ring.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+// ======================================================================
+// \title  SimTime.cpp
+// \author ortega
+// \brief  cpp file for SimTime component implementation class
+// ======================================================================
+
+#include "Components/SimTime/SimTime.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <time.h>
+#include <chrono>
+
+namespace Components {
+
+static_assert(SIM_TIME_MAX_PARTICIPANTS <= 32, "Barrier participants are tracked in a 32-bit mask");
+
+namespace {
+const U64 US_PER_SECOND = 1000000;
+const U64 NS_PER_US = 1000;
+
+U64 toMicroseconds(U32 seconds, U32 useconds) {
+    return static_cast<U64>(seconds) * US_PER_SECOND + useconds;
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+SimTime ::SimTime(const char* const compName)
+    : SimTimeComponentBase(compName),
+      m_virtual(false),
+      m_virtualUs(0),
+      m_startUs(0),
+      m_cycles(0),
+      m_stalls(0),
+      m_missedDeadlines(0),
+      m_participants(),
+      m_pending(0) {}
+
+SimTime ::~SimTime() {}
+
+// ----------------------------------------------------------------------
+// Simulation control, from the cycle driver
+// ----------------------------------------------------------------------
+
+void SimTime ::configureBarrier(FwIndexType port, U32 divisor, U32 offset) {
+    FW_ASSERT((port >= 0) && (port < SIM_TIME_MAX_PARTICIPANTS), static_cast<FwAssertArgType>(port));
+    FW_ASSERT(divisor > 0);
+    FW_ASSERT(offset < divisor, static_cast<FwAssertArgType>(offset), static_cast<FwAssertArgType>(divisor));
+    this->m_participants[port].divisor = divisor;
+    this->m_participants[port].offset = offset;
+}
+
+void SimTime ::startVirtual(const Fw::Time& start) {
+    this->m_startUs = toMicroseconds(start.getSeconds(), start.getUSeconds());
+    this->m_virtualUs.store(this->m_startUs);
+    this->m_cycles = 0;
+    this->m_stalls = 0;
+    this->m_virtual.store(true);
+}
+
+bool SimTime ::isVirtual() const {
+    return this->m_virtual.load();
+}
+
+void SimTime ::beginCycle(U64 periodNs) {
+    FW_ASSERT(this->m_virtual.load());
+    U32 expected = 0;
+    for (U32 port = 0; port < SIM_TIME_MAX_PARTICIPANTS; port++) {
+        const Participant& participant = this->m_participants[port];
+        if ((participant.divisor != 0) && ((this->m_cycles % participant.divisor) == participant.offset)) {
+            expected |= 1U << port;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> guard(this->m_barrierLock);
+        this->m_pending = expected;
+    }
+    // Everything stamped during the cycle carries its start time, however long the cycle takes in real time. The
+    // offset is rounded down to microseconds from the nanosecond total, so periods that are not a whole number of
+    // microseconds do not accumulate a rounding error.
+    this->m_virtualUs.store(this->m_startUs + (this->m_cycles * periodNs) / NS_PER_US);
+    this->m_cycles++;
+}
+
+bool SimTime ::waitCycle(U32 timeoutUs) {
+    std::unique_lock<std::mutex> lock(this->m_barrierLock);
+    const bool done = this->m_barrierDone.wait_for(lock, std::chrono::microseconds(timeoutUs),
+                                                    [this] { return this->m_pending == 0; });
+    if (!done) {
+        // Give up on the missing reports, the next cycle arms the barrier again
+        this->m_pending = 0;
+        this->m_stalls++;
+    }
+    return done;
+}
+
+U64 SimTime ::getCycles() const {
+    return this->m_cycles;
+}
+
+U32 SimTime ::getStalls() const {
+    return this->m_stalls;
+}
+
+void SimTime ::reportMissedDeadlines(U64 missed) {
+    this->m_missedDeadlines += missed;
+    this->tlmWrite_CycleMissedDeadlines(this->m_missedDeadlines);
+    this->log_WARNING_LO_CycleDeadlinesMissed(missed, this->m_missedDeadlines);
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void SimTime ::timeGetPort_handler(FwIndexType portNum, Fw::Time& time) {
+    if (this->m_virtual.load()) {
+        const U64 now = this->m_virtualUs.load();
+        time.set(TB_WORKSTATION_TIME, 0, static_cast<U32>(now / US_PER_SECOND), static_cast<U32>(now % US_PER_SECOND));
+        return;
+    }
+    timespec stime;
+    (void)clock_gettime(CLOCK_REALTIME, &stime);
+    time.set(TB_WORKSTATION_TIME, 0, static_cast<U32>(stime.tv_sec), static_cast<U32>(stime.tv_nsec / 1000));
+}
+
+void SimTime ::cycleDone_handler(FwIndexType portNum, U32 context) {
+    if (!this->m_virtual.load()) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(this->m_barrierLock);
+    this->m_pending &= ~(1U << portNum);
+    if (this->m_pending == 0) {
+        this->m_barrierDone.notify_one();
+    }
+}
+
+}  // namespace Components
@@ -0,0 +1,112 @@
+// ======================================================================
+// \title  SimTime.hpp
+// \author ortega
+// \brief  hpp file for SimTime component implementation class
+// ======================================================================
+
+#ifndef Components_SimTime_HPP
+#define Components_SimTime_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "Components/SimTime/SimTimeComponentAc.hpp"
+#include "Components/SimTime/FppConstantsAc.hpp"
+
+namespace Components {
+
+class SimTime : public SimTimeComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct SimTime object
+    SimTime(const char* const compName  //!< The component name
+    );
+
+    //! Destroy SimTime object
+    ~SimTime();
+
+    // ----------------------------------------------------------------------
+    // Simulation control, from the cycle driver
+    // ----------------------------------------------------------------------
+
+    //! Make a barrier port expect a call on the cycles a rate group driver divider runs, cycle % divisor == offset
+    void configureBarrier(FwIndexType port,  //!< The cycleDone port of the participant
+                          U32 divisor,       //!< Divisor of the participant's cycles, 1 for every cycle
+                          U32 offset         //!< Offset of the participant's cycles
+    );
+
+    //! Serve a virtual time frozen at start until the first cycle begins. Call before the topology starts.
+    void startVirtual(const Fw::Time& start  //!< Virtual time of the bring-up and of the first cycle
+    );
+
+    //! \return true when the virtual time is served
+    bool isVirtual() const;
+
+    //! Set the virtual time to the start of the next cycle, the start time plus a period per cycle begun before, and
+    //! arm the barrier with the participants of that cycle. Call right before the cycle is driven.
+    void beginCycle(U64 periodNs  //!< Virtual duration of a cycle in nanoseconds
+    );
+
+    //! Wait for the participants of the cycle begun last
+    //!
+    //! \return true once they all reported, false when some did not within the timeout
+    bool waitCycle(U32 timeoutUs  //!< Longest wait in microseconds of real time
+    );
+
+    //! \return the number of cycles begun
+    U64 getCycles() const;
+
+    //! \return the number of cycles whose participants did not all report within the wait timeout
+    U32 getStalls() const;
+
+    //! Count cycle deadlines the real-time cycle driver overran, publishing the total as telemetry and an event. Called
+    //! by the driver only on the cycles it overran, so the cycles on time do not pay for the telemetry.
+    void reportMissedDeadlines(U64 missed  //!< Number of deadlines missed since the previous cycle
+    );
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for timeGetPort
+        //!
+        //! Returns the virtual time when simulating, the workstation time otherwise
+        void
+        timeGetPort_handler(FwIndexType portNum,  //!< The port number
+                            Fw::Time& time         //!< Set to the current time
+                            ) override;
+
+    //! Handler implementation for cycleDone
+    //!
+    //! Records that a participant finished its work of the current cycle
+    void cycleDone_handler(FwIndexType portNum,  //!< The port number
+                           U32 context           //!< The call order
+                           ) override;
+
+    //! Cycles of one barrier participant
+    struct Participant {
+        U32 divisor;  //!< 0 when the port does not take part
+        U32 offset;
+    };
+
+    std::atomic<bool> m_virtual;            //! The virtual time is served
+    std::atomic<U64> m_virtualUs;           //! Virtual time in microseconds
+    U64 m_startUs;                          //! Virtual time of the first cycle in microseconds
+    U64 m_cycles;                           //! Number of cycles begun, only used by the cycle driver
+    U32 m_stalls;                           //! Number of cycles the barrier gave up on, only used by the cycle driver
+    U64 m_missedDeadlines;                  //! Number of deadlines missed, only used by the cycle driver
+    Participant m_participants[SIM_TIME_MAX_PARTICIPANTS];  //! Cycles of each barrier port
+    std::mutex m_barrierLock;               //! Guards m_pending
+    std::condition_variable m_barrierDone;  //! Signalled when m_pending becomes empty
+    U32 m_pending;                          //! Mask of the barrier ports still expected in the current cycle
+};
+
+}  // namespace Components
+
+#endif
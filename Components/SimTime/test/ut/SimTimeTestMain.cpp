@@ -0,0 +1,37 @@
+// ======================================================================
+// \title  SimTimeTestMain.cpp
+// \author ortega
+// \brief  cpp file for SimTime component test main function
+// ======================================================================
+
+#include "SimTimeTester.hpp"
+
+TEST(Nominal, TestWallClock) {
+    Components::SimTimeTester tester;
+    tester.testWallClock();
+}
+
+TEST(Nominal, TestVirtual) {
+    Components::SimTimeTester tester;
+    tester.testVirtual();
+}
+
+TEST(Nominal, TestBarrier) {
+    Components::SimTimeTester tester;
+    tester.testBarrier();
+}
+
+TEST(OffNominal, TestStall) {
+    Components::SimTimeTester tester;
+    tester.testStall();
+}
+
+TEST(OffNominal, TestMissedDeadlines) {
+    Components::SimTimeTester tester;
+    tester.testMissedDeadlines();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
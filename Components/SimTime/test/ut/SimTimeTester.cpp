@@ -0,0 +1,157 @@
+// ======================================================================
+// \title  SimTimeTester.cpp
+// \author ortega
+// \brief  cpp file for SimTime component test harness implementation class
+// ======================================================================
+
+#include "SimTimeTester.hpp"
+
+#include <time.h>
+#include <thread>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 SimTimeTester::TEST_TIMEOUT_US;
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+SimTimeTester ::SimTimeTester()
+    : SimTimeGTestBase("SimTimeTester", SimTimeTester::MAX_HISTORY_SIZE), component("SimTime") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+SimTimeTester ::~SimTimeTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void SimTimeTester ::testWallClock() {
+    ASSERT_FALSE(this->component.isVirtual());
+    timespec before;
+    (void)clock_gettime(CLOCK_REALTIME, &before);
+    const Fw::Time time = this->now();
+    timespec after;
+    (void)clock_gettime(CLOCK_REALTIME, &after);
+    ASSERT_EQ(time.getTimeBase(), TB_WORKSTATION_TIME);
+    ASSERT_GE(time.getSeconds(), static_cast<U32>(before.tv_sec));
+    ASSERT_LE(time.getSeconds(), static_cast<U32>(after.tv_sec));
+
+    // Barrier reports are ignored outside of the simulation
+    this->invoke_to_cycleDone(0, 0);
+}
+
+void SimTimeTester ::testVirtual() {
+    this->component.startVirtual(Fw::Time(TB_WORKSTATION_TIME, 0, 100, 999000));
+    ASSERT_TRUE(this->component.isVirtual());
+    Fw::Time time = this->now();
+    ASSERT_EQ(time.getTimeBase(), TB_WORKSTATION_TIME);
+    ASSERT_EQ(time.getSeconds(), 100U);
+    ASSERT_EQ(time.getUSeconds(), 999000U);
+
+    // The first cycle starts at the start time, then each cycle a period later, however long it takes
+    const U64 period = 2000000;
+    this->component.beginCycle(period);
+    ASSERT_TRUE(this->component.waitCycle(TEST_TIMEOUT_US));
+    ASSERT_EQ(this->now().getUSeconds(), 999000U);
+    for (U32 cycle = 1; cycle <= 3; cycle++) {
+        this->component.beginCycle(period);
+        ASSERT_TRUE(this->component.waitCycle(TEST_TIMEOUT_US));
+    }
+    time = this->now();
+    ASSERT_EQ(time.getSeconds(), 101U);
+    ASSERT_EQ(time.getUSeconds(), 5000U);
+    ASSERT_EQ(this->component.getCycles(), 4U);
+
+    // A day of one second cycles
+    this->component.startVirtual(Fw::Time(TB_WORKSTATION_TIME, 0, 0, 0));
+    for (U32 cycle = 0; cycle <= 86400; cycle++) {
+        this->component.beginCycle(1000000000);
+    }
+    ASSERT_EQ(this->now().getSeconds(), 86400U);
+
+    // A second of 7 kHz cycles, whose period is not a whole number of microseconds, does not drift
+    this->component.startVirtual(Fw::Time(TB_WORKSTATION_TIME, 0, 0, 0));
+    for (U32 cycle = 0; cycle <= 7000; cycle++) {
+        this->component.beginCycle(1000000000 / 7000);
+    }
+    time = this->now();
+    ASSERT_EQ(time.getSeconds(), 0U);
+    ASSERT_EQ(time.getUSeconds(), 999999U);
+}
+
+void SimTimeTester ::testBarrier() {
+    // The rate groups of the deployment: every cycle, every second cycle and every fourth cycle
+    this->component.configureBarrier(0, 1, 0);
+    this->component.configureBarrier(1, 2, 0);
+    this->component.configureBarrier(2, 4, 0);
+    this->component.startVirtual(Fw::Time(TB_WORKSTATION_TIME, 0, 0, 0));
+    const U64 period = 1000000;
+
+    for (U32 cycle = 0; cycle < 8; cycle++) {
+        this->component.beginCycle(period);
+        // The participants report from their own threads
+        std::thread rateGroup1([this] { this->invoke_to_cycleDone(0, 0); });
+        std::thread rateGroup2([this, cycle] {
+            if ((cycle % 2) == 0) {
+                this->invoke_to_cycleDone(1, 0);
+            }
+        });
+        std::thread rateGroup3([this, cycle] {
+            if ((cycle % 4) == 0) {
+                this->invoke_to_cycleDone(2, 0);
+            }
+        });
+        ASSERT_TRUE(this->component.waitCycle(10 * TEST_TIMEOUT_US));
+        rateGroup1.join();
+        rateGroup2.join();
+        rateGroup3.join();
+    }
+    ASSERT_EQ(this->component.getStalls(), 0U);
+}
+
+void SimTimeTester ::testStall() {
+    this->component.configureBarrier(0, 1, 0);
+    this->component.configureBarrier(3, 1, 0);
+    this->component.startVirtual(Fw::Time(TB_WORKSTATION_TIME, 0, 0, 0));
+    const U64 period = 1000000000;
+
+    this->component.beginCycle(period);
+    this->invoke_to_cycleDone(0, 0);
+    ASSERT_FALSE(this->component.waitCycle(TEST_TIMEOUT_US));
+    ASSERT_EQ(this->component.getStalls(), 1U);
+
+    // The next cycle waits for its own reports again
+    this->component.beginCycle(period);
+    this->invoke_to_cycleDone(3, 0);
+    this->invoke_to_cycleDone(0, 0);
+    ASSERT_TRUE(this->component.waitCycle(TEST_TIMEOUT_US));
+    ASSERT_EQ(this->component.getStalls(), 1U);
+}
+
+void SimTimeTester ::testMissedDeadlines() {
+    this->component.reportMissedDeadlines(3);
+    this->component.reportMissedDeadlines(2);
+    ASSERT_TLM_CycleMissedDeadlines_SIZE(2);
+    ASSERT_TLM_CycleMissedDeadlines(0, 3U);
+    ASSERT_TLM_CycleMissedDeadlines(1, 5U);
+    ASSERT_EVENTS_CycleDeadlinesMissed_SIZE(2);
+    ASSERT_EVENTS_CycleDeadlinesMissed(0, 3U, 3U);
+    ASSERT_EVENTS_CycleDeadlinesMissed(1, 2U, 5U);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+Fw::Time SimTimeTester ::now() {
+    Fw::Time time;
+    this->invoke_to_timeGetPort(0, time);
+    return time;
+}
+
+}  // namespace Components
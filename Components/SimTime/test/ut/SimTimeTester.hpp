@@ -0,0 +1,86 @@
+// ======================================================================
+// \title  SimTimeTester.hpp
+// \author ortega
+// \brief  hpp file for SimTime component test harness implementation class
+// ======================================================================
+
+#ifndef Components_SimTimeTester_HPP
+#define Components_SimTimeTester_HPP
+
+#include "Components/SimTime/SimTime.hpp"
+#include "Components/SimTime/SimTimeGTestBase.hpp"
+
+namespace Components {
+
+class SimTimeTester : public SimTimeGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    //! Barrier wait used by the tests, in microseconds
+    static const U32 TEST_TIMEOUT_US = 100000;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object SimTimeTester
+    SimTimeTester();
+
+    //! Destroy object SimTimeTester
+    ~SimTimeTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! The workstation time is served until virtual time starts
+    void testWallClock();
+
+    //! The virtual time stays at the start during the bring-up and advances a period per cycle
+    void testVirtual();
+
+    //! The barrier waits for the participants of each cycle, following their dividers
+    void testBarrier();
+
+    //! A participant that does not report stalls the barrier for the timeout only
+    void testStall();
+
+    //! Missed cycle deadlines are published as telemetry and events while running
+    void testMissedDeadlines();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! \return the time served by the component
+    Fw::Time now();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    SimTime component;
+};
+
+}  // namespace Components
+
+#endif
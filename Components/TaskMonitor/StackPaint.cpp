@@ -0,0 +1,177 @@
+// ======================================================================
+// \title  StackPaint.cpp
+// \author ortega
+// \brief  cpp file for the stack painting of the threads of the process
+// ======================================================================
+
+#include "Components/TaskMonitor/StackPaint.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Components {
+namespace StackPaint {
+
+namespace {
+
+//! Bytes left unpainted below the frame of the painting function, covering the red zone and the painting loop
+const uintptr_t PAINT_MARGIN = 1024;
+
+//! Stack of one tracked thread. The fields are written by the thread itself before ready is set.
+struct Slot {
+    std::atomic<bool> ready;
+    std::atomic<bool> exited;
+    std::atomic<U32> finalUsed;  //!< High-water mark measured by the thread as it exited
+    I32 tid;
+    uintptr_t bottom;  //!< Lowest address of the stack, above the guard page
+    uintptr_t top;     //!< End of the stack
+};
+
+Slot s_slots[MAX_THREADS];
+std::atomic<U32> s_slotCount(0);
+std::atomic<bool> s_enabled(false);
+
+//! Routine and argument of a thread started through paintedStart
+struct Start {
+    void* (*routine)(void*);
+    void* arg;
+};
+
+//! Deepest use of the stack [bottom, top): the distance from the top to the lowest word no longer holding the pattern
+U32 measure(uintptr_t bottom, uintptr_t top) {
+    const volatile U32* word = reinterpret_cast<const volatile U32*>(bottom);
+    const volatile U32* const end = reinterpret_cast<const volatile U32*>(top);
+    while ((word < end) && (*word == PATTERN)) {
+        word++;
+    }
+    return static_cast<U32>(top - reinterpret_cast<uintptr_t>(word));
+}
+
+//! Fill the calling thread's stack with the pattern from its bottom up to just below the current frame
+//!
+//! \return false when the stack of the thread cannot be found, which is always the case elsewhere than on Linux
+bool paintCurrentStack(Slot& slot) {
+#ifdef __linux__
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) != 0) {
+        return false;
+    }
+    void* address = nullptr;
+    size_t size = 0;
+    const int status = pthread_attr_getstack(&attributes, &address, &size);
+    (void)pthread_attr_destroy(&attributes);
+    if (status != 0) {
+        return false;
+    }
+    // glibc reports the stack without its guard page
+    const uintptr_t align = sizeof(U32) - 1;
+    slot.bottom = (reinterpret_cast<uintptr_t>(address) + align) & ~align;
+    slot.top = reinterpret_cast<uintptr_t>(address) + size;
+    slot.tid = static_cast<I32>(syscall(SYS_gettid));
+
+    // Plain stores in a loop, so no call frame lands in the painted region while it is written
+    const uintptr_t limit = (reinterpret_cast<uintptr_t>(__builtin_frame_address(0)) - PAINT_MARGIN) & ~align;
+    for (volatile U32* word = reinterpret_cast<volatile U32*>(slot.bottom);
+         reinterpret_cast<uintptr_t>(word) < limit; word++) {
+        *word = PATTERN;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+//! Records the final high-water mark of a tracked thread, also when it leaves through pthread_exit
+class ExitRecorder {
+  public:
+    explicit ExitRecorder(Slot* slot) : m_slot(slot) {}
+    ~ExitRecorder() {
+        if (this->m_slot != nullptr) {
+            this->m_slot->finalUsed.store(measure(this->m_slot->bottom, this->m_slot->top));
+            this->m_slot->exited.store(true);
+        }
+    }
+
+  private:
+    Slot* m_slot;
+};
+
+//! Start routine of painted threads: paint the stack, publish it in a slot, then run the real routine
+void* paintedStart(void* argument) {
+    const Start start = *static_cast<Start*>(argument);
+    free(argument);
+
+    Slot* slot = nullptr;
+    const U32 index = s_slotCount.fetch_add(1);
+    if ((index < MAX_THREADS) && paintCurrentStack(s_slots[index])) {
+        slot = &s_slots[index];
+        slot->ready.store(true, std::memory_order_release);
+    }
+    ExitRecorder recorder(slot);
+    return start.routine(start.arg);
+}
+
+}  // namespace
+
+void enable() {
+    s_enabled.store(true);
+}
+
+bool isEnabled() {
+    return s_enabled.load();
+}
+
+U32 getThreadCount() {
+    return FW_MIN(s_slotCount.load(), MAX_THREADS);
+}
+
+bool getUsage(U32 slot, Usage& usage) {
+    FW_ASSERT(slot < MAX_THREADS, static_cast<FwAssertArgType>(slot));
+    const Slot& entry = s_slots[slot];
+    if (!entry.ready.load(std::memory_order_acquire)) {
+        return false;
+    }
+    usage.tid = entry.tid;
+    usage.size = static_cast<U32>(entry.top - entry.bottom);
+    // A thread that exited may have had its stack released, so only its final measurement is read
+    usage.exited = entry.exited.load();
+    usage.used = usage.exited ? entry.finalUsed.load() : measure(entry.bottom, entry.top);
+    return true;
+}
+
+int create(CreateFunction createThread,
+           pthread_t* thread,
+           const pthread_attr_t* attributes,
+           void* (*routine)(void*),
+           void* arg) {
+    // Called for every thread of the executable: errors are returned to the caller of pthread_create, never asserted
+    if ((createThread == nullptr) || (thread == nullptr) || (routine == nullptr)) {
+        return EINVAL;
+    }
+    Start* start = nullptr;
+#ifdef __linux__
+    if (s_enabled.load()) {
+        start = static_cast<Start*>(malloc(sizeof(Start)));
+    }
+#endif
+    if (start == nullptr) {
+        return createThread(thread, attributes, routine, arg);
+    }
+    start->routine = routine;
+    start->arg = arg;
+    const int status = createThread(thread, attributes, paintedStart, start);
+    if (status != 0) {
+        free(start);
+    }
+    return status;
+}
+
+}  // namespace StackPaint
+}  // namespace Components
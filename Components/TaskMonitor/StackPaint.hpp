@@ -0,0 +1,75 @@
+// ======================================================================
+// \title  StackPaint.hpp
+// \author ortega
+// \brief  hpp file for the stack painting of the threads of the process
+// ======================================================================
+
+#ifndef Components_StackPaint_HPP
+#define Components_StackPaint_HPP
+
+#include "FpConfig.hpp"
+
+#include <pthread.h>
+
+namespace Components {
+
+//! Stack painting, for measuring the stack high-water mark of the threads of the process (Linux only)
+//!
+//! Threads are painted when they are started through create, which an executable opting in calls from its own
+//! pthread_create wrapper, so that the Os::Task threads of the active components go through it too. Once enabled, each
+//! such thread fills the unused part of its own stack with PATTERN before running its routine. The deepest stack use
+//! of the thread is then the part of the stack no longer holding the pattern. Painting touches every page of the
+//! stacks, so it is a measurement mode and is off by default. Elsewhere than on Linux threads are never painted.
+namespace StackPaint {
+
+//! Word the unused part of a painted stack is filled with
+const U32 PATTERN = 0xA5C35A3C;
+
+//! Number of threads whose stacks can be tracked. Threads created after that are not painted.
+const U32 MAX_THREADS = 32;
+
+//! Signature of pthread_create, for passing the function create starts the threads with
+typedef int (*CreateFunction)(pthread_t* thread,
+                              const pthread_attr_t* attributes,
+                              void* (*routine)(void*),
+                              void* arg);
+
+//! Stack use of one tracked thread
+struct Usage {
+    I32 tid;      //!< Kernel thread id
+    U32 size;     //!< Size of the stack in bytes
+    U32 used;     //!< Deepest stack use in bytes
+    bool exited;  //!< The thread has exited, used is its final high-water mark
+};
+
+//! Paint the stacks of the threads created through create from now on. Call before the topology starts its tasks.
+void enable();
+
+//! \return true when new thread stacks are painted
+bool isEnabled();
+
+//! \return the number of threads tracked so far. Slots are assigned in thread start order.
+U32 getThreadCount();
+
+//! Measure the stack use of a tracked thread
+//!
+//! \return false when the slot does not hold a thread yet
+bool getUsage(U32 slot,     //!< Slot of the thread, less than getThreadCount()
+              Usage& usage  //!< Filled with the stack use of the thread
+);
+
+//! Start a thread with createThread, painting its stack first when painting is enabled. A thread whose start record
+//! cannot be allocated is started unpainted.
+//!
+//! \return the status of createThread, or EINVAL when createThread, thread or routine is null
+int create(CreateFunction createThread,       //!< Function starting the thread, the real pthread_create
+           pthread_t* thread,                 //!< Set to the new thread
+           const pthread_attr_t* attributes,  //!< Attributes of the new thread, may be null
+           void* (*routine)(void*),           //!< Start routine of the new thread
+           void* arg                          //!< Argument of the start routine
+);
+
+}  // namespace StackPaint
+}  // namespace Components
+
+#endif
@@ -0,0 +1,347 @@
+// ======================================================================
+// \title  TaskMonitor.cpp
+// \author ortega
+// \brief  cpp file for TaskMonitor component implementation class
+// ======================================================================
+
+#include "Components/TaskMonitor/TaskMonitor.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Logger/Logger.hpp"
+#include "Os/File.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Components {
+
+static_assert(StackPaint::MAX_THREADS == TASK_MONITOR_MAX_THREADS, "Every painted stack needs a telemetry slot");
+
+namespace {
+//! Longest line of the stack report
+const U32 REPORT_LINE_SIZE = 96;
+
+//! Largest value of the 16-bit CPU telemetry
+const U64 CPU_VALUE_MAX = 0xFFFF;
+
+//! Read a small text file of /proc whole, terminated
+//!
+//! \return false when the file cannot be read
+bool readProcFile(const char* path, char* text, U32 size) {
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    const ssize_t length = read(fd, text, size - 1);
+    (void)close(fd);
+    if (length <= 0) {
+        return false;
+    }
+    text[length] = '\0';
+    return true;
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+TaskMonitor ::TaskMonitor(const char* const compName) : TaskMonitorComponentBase(compName) {
+    (void)memset(this->m_usage, 0, sizeof(this->m_usage));
+    (void)memset(this->m_tracked, 0, sizeof(this->m_tracked));
+    (void)memset(this->m_names, 0, sizeof(this->m_names));
+    (void)memset(this->m_cpuThreads, 0, sizeof(this->m_cpuThreads));
+}
+
+TaskMonitor ::~TaskMonitor() {}
+
+bool TaskMonitor ::writeReport(const char* fileName) {
+    FW_ASSERT(fileName != nullptr);
+    if (!StackPaint::isEnabled()) {
+        return false;
+    }
+    char report[(TASK_MONITOR_MAX_THREADS + 1) * REPORT_LINE_SIZE];
+    U32 length = 0;
+    U32 threads = 0;
+
+    this->lock();
+    const U32 count = this->measure();
+    length += static_cast<U32>(snprintf(report, REPORT_LINE_SIZE, "%4s %7s %-15s %8s %8s %8s %5s\n", "slot", "tid",
+                                        "name", "size", "used", "free", "use%"));
+    // The report is also printed line by line, so it is not lost when the file cannot be written
+    Fw::Logger::log("[INFO] Thread stack use: %s", report);
+    for (U32 slot = 0; slot < count; slot++) {
+        if (!this->m_tracked[slot]) {
+            continue;
+        }
+        const StackPaint::Usage& usage = this->m_usage[slot];
+        const U32 percent = (usage.size > 0) ? static_cast<U32>((static_cast<U64>(usage.used) * 100) / usage.size) : 0;
+        char* const line = &report[length];
+        length += static_cast<U32>(snprintf(line, REPORT_LINE_SIZE, "%4u %7d %-15s %8u %8u %8u %4u%%\n", slot,
+                                            usage.tid, this->m_names[slot], usage.size, usage.used,
+                                            usage.size - usage.used, percent));
+        Fw::Logger::log("[INFO] Thread stack use: %s", line);
+        threads++;
+    }
+    this->unLock();
+
+    Os::File file;
+    Os::File::Status status = file.open(fileName, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE);
+    if (status == Os::File::OP_OK) {
+        FwSignedSizeType size = static_cast<FwSignedSizeType>(length);
+        status = file.write(reinterpret_cast<const U8*>(report), size, Os::File::WaitType::WAIT);
+        file.close();
+        if ((status == Os::File::OP_OK) && (size != static_cast<FwSignedSizeType>(length))) {
+            status = Os::File::NO_SPACE;
+        }
+    }
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_LO_StackReportError(Fw::String(fileName), static_cast<I32>(status));
+        return false;
+    }
+    this->log_ACTIVITY_HI_StackReportWritten(Fw::String(fileName), threads);
+    return true;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void TaskMonitor ::run_handler(FwIndexType portNum, U32 context) {
+    // Nothing is sampled until the parameters are loaded
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    const U32 samplePeriod = this->paramGet_CPU_SAMPLE_PERIOD(isValid);
+    if (((isValid == Fw::ParamValid::VALID) || (isValid == Fw::ParamValid::DEFAULT)) && (samplePeriod != 0)) {
+        this->m_cpuCalls++;
+        if (this->m_cpuCalls >= samplePeriod) {
+            this->m_cpuCalls = 0;
+            this->sampleCpu();
+        }
+    }
+
+    if (!StackPaint::isEnabled()) {
+        return;
+    }
+    const U32 count = this->measure();
+
+    TaskThreadValues highWater;
+    TaskThreadValues sizes;
+    U32 headroomMin = 0;
+    bool first = true;
+    for (U32 slot = 0; slot < count; slot++) {
+        if (this->m_tracked[slot]) {
+            const StackPaint::Usage& usage = this->m_usage[slot];
+            highWater[slot] = usage.used;
+            sizes[slot] = usage.size;
+            headroomMin = first ? (usage.size - usage.used) : FW_MIN(headroomMin, usage.size - usage.used);
+            first = false;
+        }
+    }
+
+    // High-water marks only grow and sizes only change when threads start, so most cycles send nothing
+    if (!this->m_reported || (highWater != this->m_highWaterReported)) {
+        this->tlmWrite_StackHighWater(highWater);
+        this->m_highWaterReported = highWater;
+    }
+    if (!this->m_reported || (sizes != this->m_sizeReported)) {
+        this->tlmWrite_StackSize(sizes);
+        this->m_sizeReported = sizes;
+    }
+    if (!this->m_reported || (headroomMin != this->m_headroomMinReported)) {
+        this->tlmWrite_StackHeadroomMin(headroomMin);
+        this->m_headroomMinReported = headroomMin;
+    }
+    this->m_reported = true;
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U32 TaskMonitor ::measure() {
+    const U32 count = StackPaint::getThreadCount();
+    for (U32 slot = 0; slot < count; slot++) {
+        if (!StackPaint::getUsage(slot, this->m_usage[slot])) {
+            continue;
+        }
+        if (!this->m_tracked[slot]) {
+            // Tasks are named right after their thread is created, long before the first measurement
+            readThreadName(this->m_usage[slot].tid, this->m_names[slot], sizeof(this->m_names[slot]));
+            this->m_tracked[slot] = true;
+            this->log_ACTIVITY_LO_StackTracked(slot, Fw::String(this->m_names[slot]), this->m_usage[slot].size);
+        }
+    }
+    return count;
+}
+
+void TaskMonitor ::sampleCpu() {
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    const U64 sampleTime = static_cast<U64>(now.tv_sec) * 1000000000ULL + static_cast<U64>(now.tv_nsec);
+    const U64 elapsed = sampleTime - this->m_cpuSampleTime;
+
+    TaskThreadCpu usage;
+    TaskThreadCpu switches;
+    bool sampled[TASK_MONITOR_MAX_THREADS] = {};
+    bool announced[TASK_MONITOR_MAX_THREADS] = {};
+    DIR* const threads = opendir("/proc/self/task");
+    if (threads == nullptr) {
+        return;
+    }
+    for (struct dirent* entry = readdir(threads); entry != nullptr; entry = readdir(threads)) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        const I32 tid = static_cast<I32>(atoi(entry->d_name));
+        U64 startTime = 0;
+        U64 cpuTime = 0;
+        U64 switchCount = 0;
+        if (!readThreadCpu(tid, startTime, cpuTime, switchCount)) {
+            continue;
+        }
+        U32 slot = 0;
+        while ((slot < TASK_MONITOR_MAX_THREADS) && (this->m_cpuThreads[slot].tid != tid)) {
+            slot++;
+        }
+        // A tid seen before with another start time was reused by a new thread, which takes over the slot
+        bool announce = (slot < TASK_MONITOR_MAX_THREADS) && (this->m_cpuThreads[slot].startTime != startTime);
+        if (slot == TASK_MONITOR_MAX_THREADS) {
+            slot = 0;
+            while ((slot < TASK_MONITOR_MAX_THREADS) && (this->m_cpuThreads[slot].tid != 0)) {
+                slot++;
+            }
+            if (slot == TASK_MONITOR_MAX_THREADS) {
+                this->log_WARNING_LO_ThreadSlotsFull(tid);
+                continue;
+            }
+            announce = true;
+        }
+        sampled[slot] = true;
+        CpuThread& thread = this->m_cpuThreads[slot];
+        if (announce) {
+            // A new thread: its use is measured from this sample on
+            readThreadName(tid, thread.name, sizeof(thread.name));
+            this->log_ACTIVITY_LO_ThreadTracked(slot, Fw::String(thread.name), tid);
+            announced[slot] = true;
+        } else {
+            const U64 used = (cpuTime > thread.cpuTime) ? (cpuTime - thread.cpuTime) : 0;
+            const U64 switched = (switchCount > thread.switches) ? (switchCount - thread.switches) : 0;
+            usage[slot] = static_cast<U16>(FW_MIN((elapsed > 0) ? (used * 10000) / elapsed : 0, CPU_VALUE_MAX));
+            switches[slot] = static_cast<U16>(FW_MIN(switched, CPU_VALUE_MAX));
+        }
+        thread.tid = tid;
+        thread.startTime = startTime;
+        thread.cpuTime = cpuTime;
+        thread.switches = switchCount;
+    }
+    (void)closedir(threads);
+
+    // The slots of the threads gone are free for the next new threads
+    for (U32 slot = 0; slot < TASK_MONITOR_MAX_THREADS; slot++) {
+        if (!sampled[slot]) {
+            this->m_cpuThreads[slot].tid = 0;
+        }
+    }
+
+    // The announcement of a slot is a single event the ground may have missed, so every slot in use is announced again
+    // now and then
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    const U32 announcePeriod = this->paramGet_CPU_ANNOUNCE_PERIOD(isValid);
+    this->m_cpuSamples++;
+    if ((announcePeriod != 0) && (this->m_cpuSamples >= announcePeriod)) {
+        this->m_cpuSamples = 0;
+        for (U32 slot = 0; slot < TASK_MONITOR_MAX_THREADS; slot++) {
+            const CpuThread& thread = this->m_cpuThreads[slot];
+            if ((thread.tid != 0) && !announced[slot]) {
+                this->log_ACTIVITY_LO_ThreadTracked(slot, Fw::String(thread.name), thread.tid);
+            }
+        }
+    }
+
+    // The first sample only sets the starting point
+    if (this->m_cpuSampleTime != 0) {
+        this->tlmWrite_ThreadCpuUsage(usage);
+        this->tlmWrite_ThreadSwitches(switches);
+    }
+    this->m_cpuSampleTime = sampleTime;
+}
+
+bool TaskMonitor ::readThreadCpu(I32 tid, U64& startTime, U64& cpuTime, U64& switches) {
+    char path[64];
+    char text[2048];
+    // The user and system times of stat, fields 14 and 15 in clock ticks, and the start time, field 22, follow the
+    // parenthesized name, which may itself hold spaces and parentheses
+    (void)snprintf(path, sizeof(path), "/proc/self/task/%d/stat", static_cast<int>(tid));
+    if (!readProcFile(path, text, sizeof(text))) {
+        return false;
+    }
+    const char* const fields = strrchr(text, ')');
+    unsigned long long userTime = 0;
+    unsigned long long systemTime = 0;
+    unsigned long long started = 0;
+    if ((fields == nullptr) ||
+        (sscanf(fields + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu %*d %*d %*d %*d %*d %*d %llu",
+                &userTime, &systemTime, &started) != 3)) {
+        return false;
+    }
+    startTime = static_cast<U64>(started);
+
+    // schedstat holds the CPU time in nanoseconds, the time waiting on a run queue and the times switched in
+    (void)snprintf(path, sizeof(path), "/proc/self/task/%d/schedstat", static_cast<int>(tid));
+    unsigned long long runTime = 0;
+    unsigned long long waitTime = 0;
+    unsigned long long slices = 0;
+    if (readProcFile(path, text, sizeof(text)) && (sscanf(text, "%llu %llu %llu", &runTime, &waitTime, &slices) == 3)) {
+        cpuTime = static_cast<U64>(runTime);
+        switches = static_cast<U64>(slices);
+        return true;
+    }
+
+    // Kernels without schedstat: the CPU time is the one of stat
+    const U64 ticksPerSecond = static_cast<U64>(sysconf(_SC_CLK_TCK));
+    cpuTime = (static_cast<U64>(userTime + systemTime) * 1000000000ULL) / FW_MAX(ticksPerSecond, 1ULL);
+
+    // The switches are the voluntary and involuntary ones of status
+    (void)snprintf(path, sizeof(path), "/proc/self/task/%d/status", static_cast<int>(tid));
+    if (!readProcFile(path, text, sizeof(text))) {
+        return false;
+    }
+    const char* const voluntary = strstr(text, "\nvoluntary_ctxt_switches:");
+    const char* const involuntary = strstr(text, "\nnonvoluntary_ctxt_switches:");
+    switches = 0;
+    if (voluntary != nullptr) {
+        switches += static_cast<U64>(strtoull(voluntary + strlen("\nvoluntary_ctxt_switches:"), nullptr, 10));
+    }
+    if (involuntary != nullptr) {
+        switches += static_cast<U64>(strtoull(involuntary + strlen("\nnonvoluntary_ctxt_switches:"), nullptr, 10));
+    }
+    return true;
+}
+
+void TaskMonitor ::readThreadName(I32 tid, char* name, U32 nameSize) {
+    FW_ASSERT(name != nullptr);
+    FW_ASSERT(nameSize > 1, static_cast<FwAssertArgType>(nameSize));
+    char path[64];
+    (void)snprintf(path, sizeof(path), "/proc/self/task/%d/comm", static_cast<int>(tid));
+    ssize_t length = -1;
+    const int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        length = read(fd, name, nameSize - 1);
+        (void)close(fd);
+    }
+    if (length <= 0) {
+        (void)snprintf(name, nameSize, "?");
+        return;
+    }
+    // The kernel terminates the name with a newline
+    name[length] = '\0';
+    if (name[length - 1] == '\n') {
+        name[length - 1] = '\0';
+    }
+}
+
+}  // namespace Components
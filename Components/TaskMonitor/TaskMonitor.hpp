@@ -0,0 +1,106 @@
+// ======================================================================
+// \title  TaskMonitor.hpp
+// \author ortega
+// \brief  hpp file for TaskMonitor component implementation class
+// ======================================================================
+
+#ifndef Components_TaskMonitor_HPP
+#define Components_TaskMonitor_HPP
+
+#include "Components/TaskMonitor/FppConstantsAc.hpp"
+#include "Components/TaskMonitor/StackPaint.hpp"
+#include "Components/TaskMonitor/TaskMonitorComponentAc.hpp"
+
+namespace Components {
+
+class TaskMonitor : public TaskMonitorComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct TaskMonitor object
+    TaskMonitor(const char* const compName  //!< The component name
+    );
+
+    //! Destroy TaskMonitor object
+    ~TaskMonitor();
+
+    //! Write the stack use of every tracked thread to a text file and the console, one thread per line. Call while
+    //! the threads are still running, before the topology stops its tasks.
+    //!
+    //! \return true when the report was written
+    bool writeReport(const char* fileName  //!< The report file
+    );
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for run
+        //!
+        //! Samples the CPU use of the threads every CPU_SAMPLE_PERIOD calls, then measures the stacks and reports the
+        //! high-water marks that changed
+        void
+        run_handler(FwIndexType portNum,  //!< The port number
+                    U32 context           //!< The call order
+                    ) override;
+
+    PRIVATE :
+        //! CPU accounting of one sampled thread at the last sample
+        struct CpuThread {
+            I32 tid;        //!< Kernel thread id, 0 for a free slot
+            U64 startTime;  //!< Start time of the thread in clock ticks after boot, telling a reused tid apart
+            U64 cpuTime;    //!< CPU time used so far in nanoseconds
+            U64 switches;   //!< Times switched in so far
+            char name[16];  //!< Thread name read when the thread was first sampled
+        };
+
+    PRIVATE :
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Measure the stacks of all tracked threads, announcing the threads measured for the first time
+        //!
+        //! \return the number of threads measured
+        U32 measure();
+
+    //! Sample the CPU use of every thread of the process, announcing the threads given a slot, and every slot in use
+    //! each CPU_ANNOUNCE_PERIOD samples, and freeing the slots of the threads gone
+    void sampleCpu();
+
+    //! Start time, CPU time and switches of a thread so far, from its stat and schedstat or, on kernels without
+    //! schedstat, its stat and status
+    //!
+    //! \return false when the thread is gone
+    static bool readThreadCpu(I32 tid,         //!< Kernel thread id
+                              U64& startTime,  //!< Start time of the thread in clock ticks after boot
+                              U64& cpuTime,    //!< CPU time used so far in nanoseconds
+                              U64& switches    //!< Times switched in so far
+    );
+
+    //! Name of a thread as the kernel knows it, "?" once the thread is gone
+    static void readThreadName(I32 tid,      //!< Kernel thread id
+                               char* name,   //!< Buffer receiving the name
+                               U32 nameSize  //!< Size of the buffer
+    );
+
+    StackPaint::Usage m_usage[TASK_MONITOR_MAX_THREADS];  //! Last measurement of each slot
+    bool m_tracked[TASK_MONITOR_MAX_THREADS];             //! The slot was measured and announced
+    char m_names[TASK_MONITOR_MAX_THREADS][16];           //! Thread names read when first measured
+    TaskThreadValues m_highWaterReported;                 //! Last high-water marks sent as telemetry
+    TaskThreadValues m_sizeReported;                      //! Last stack sizes sent as telemetry
+    U32 m_headroomMinReported = 0;                        //! Last headroom sent as telemetry
+    bool m_reported = false;                              //! Telemetry was sent at least once
+    CpuThread m_cpuThreads[TASK_MONITOR_MAX_THREADS];     //! Last CPU sample of each slot
+    U32 m_cpuCalls = 0;                                   //! Run calls since the last CPU sample
+    U32 m_cpuSamples = 0;                                 //! CPU samples since every slot was last announced
+    U64 m_cpuSampleTime = 0;                              //! Monotonic time of the last CPU sample in nanoseconds
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,187 @@
+// ======================================================================
+// \title  TaskSchedule.cpp
+// \author ortega
+// \brief  cpp file for the scheduling policy and CPU affinity of the threads of the process
+// ======================================================================
+
+#include "Components/TaskMonitor/TaskSchedule.hpp"
+#include "Fw/Logger/Logger.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <pthread.h>
+#include "Os/Posix/Task.hpp"
+#endif
+
+namespace Components {
+namespace TaskSchedule {
+
+namespace {
+
+//! Kernel name of a thread of the process
+//!
+//! \return false when the thread is gone
+bool readName(I32 tid, char* name, U32 nameSize) {
+    char path[64];
+    (void)snprintf(path, sizeof(path), "/proc/self/task/%d/comm", static_cast<int>(tid));
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    const ssize_t length = read(fd, name, nameSize - 1);
+    (void)close(fd);
+    if (length <= 0) {
+        return false;
+    }
+    // The kernel terminates the name with a newline
+    name[length] = '\0';
+    if (name[length - 1] == '\n') {
+        name[length - 1] = '\0';
+    }
+    return true;
+}
+
+//! Set the policy, priority and CPUs of one thread after its entry
+//!
+//! \return false when the thread exited meanwhile
+bool schedule(I32 tid, const char* name, const Entry& entry, const cpu_set_t& allowed, Result& result) {
+    bool complete = true;
+    if (entry.cpus != 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (U32 cpu = 0; cpu < 32; cpu++) {
+            if (((entry.cpus >> cpu) & 1U) && CPU_ISSET(cpu, &allowed)) {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        const bool pinned = (CPU_COUNT(&cpus) != 0) && (sched_setaffinity(tid, sizeof(cpus), &cpus) == 0);
+        if (!pinned && (CPU_COUNT(&cpus) != 0) && (errno == ESRCH)) {
+            return false;
+        }
+        if (!pinned) {
+            Fw::Logger::log("[WARNING] CPUs 0x%x of thread %s are not available, it runs on any CPU\n", entry.cpus,
+                            name);
+            result.unpinned++;
+            complete = false;
+        }
+    }
+
+    struct sched_param parameters;
+    (void)memset(&parameters, 0, sizeof(parameters));
+    int status = 0;
+    if (entry.policy == FIFO) {
+        parameters.sched_priority = static_cast<int>(entry.priority);
+        status = sched_setscheduler(tid, SCHED_FIFO, &parameters);
+    } else {
+        status = sched_setscheduler(tid, SCHED_OTHER, &parameters);
+        if (status == 0) {
+            status = setpriority(PRIO_PROCESS, static_cast<id_t>(tid), static_cast<int>(entry.priority));
+        }
+    }
+    if ((status != 0) && (errno == ESRCH)) {
+        return false;
+    }
+    if (status != 0) {
+        // The tuning is optional: whatever the kernel refuses, the thread keeps its scheduling
+        const char* const policy = (entry.policy == FIFO) ? "SCHED_FIFO" : "SCHED_OTHER";
+        if ((errno == EPERM) || (errno == EACCES)) {
+            Fw::Logger::log("[WARNING] No permission for the %s priority %d of thread %s (needs CAP_SYS_NICE or an "
+                            "rtprio limit), it keeps its scheduling\n",
+                            policy, static_cast<int>(entry.priority), name);
+        } else {
+            Fw::Logger::log("[WARNING] The %s priority %d of thread %s failed with errno %d, it keeps its "
+                            "scheduling\n",
+                            policy, static_cast<int>(entry.priority), name, errno);
+        }
+        result.denied++;
+        complete = false;
+    }
+    result.applied += complete ? 1 : 0;
+    return true;
+}
+
+}  // namespace
+
+void TaskNamer ::addTask(Os::Task* task) {
+    FW_ASSERT(task != nullptr);
+#ifdef __linux__
+    // Os::Task registers the task once its thread is created, so the handle holds the thread
+    Os::Posix::Task::PosixTaskHandle* const handle =
+        static_cast<Os::Posix::Task::PosixTaskHandle*>(task->getHandle());
+    if ((handle != nullptr) && handle->m_is_valid) {
+        char name[16];
+        (void)snprintf(name, sizeof(name), "%s", task->getName().toChar());
+        (void)pthread_setname_np(handle->m_task_descriptor, name);
+    }
+#endif
+}
+
+void TaskNamer ::removeTask(Os::Task* task) {}
+
+Result apply(const Entry* table, U32 count) {
+    FW_ASSERT(table != nullptr);
+    FW_ASSERT(count <= MAX_ENTRIES, static_cast<FwAssertArgType>(count));
+    for (U32 index = 0; index < count; index++) {
+        FW_ASSERT(table[index].name != nullptr, static_cast<FwAssertArgType>(index));
+        if (table[index].policy == FIFO) {
+            FW_ASSERT((table[index].priority >= sched_get_priority_min(SCHED_FIFO)) &&
+                          (table[index].priority <= sched_get_priority_max(SCHED_FIFO)),
+                      static_cast<FwAssertArgType>(index), static_cast<FwAssertArgType>(table[index].priority));
+        } else {
+            FW_ASSERT((table[index].priority >= -20) && (table[index].priority <= 19),
+                      static_cast<FwAssertArgType>(index), static_cast<FwAssertArgType>(table[index].priority));
+        }
+    }
+
+    Result result = {0, 0, 0, 0};
+    bool found[MAX_ENTRIES] = {};
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        CPU_ZERO(&allowed);
+    }
+    DIR* const threads = opendir("/proc/self/task");
+    if (threads == nullptr) {
+        Fw::Logger::log("[WARNING] Cannot list the threads of the process, none is scheduled\n");
+        result.missing = count;
+        return result;
+    }
+    const I32 process = static_cast<I32>(getpid());
+    for (struct dirent* thread = readdir(threads); thread != nullptr; thread = readdir(threads)) {
+        if (thread->d_name[0] == '.') {
+            continue;
+        }
+        const I32 tid = static_cast<I32>(atoi(thread->d_name));
+        char name[16];
+        if (tid == process) {
+            (void)snprintf(name, sizeof(name), "%s", MAIN_THREAD);
+        } else if (!readName(tid, name, sizeof(name))) {
+            continue;
+        }
+        for (U32 index = 0; index < count; index++) {
+            if (strcmp(table[index].name, name) == 0) {
+                // A thread that exited since it was listed is not running, as if it had not been listed
+                found[index] = schedule(tid, name, table[index], allowed, result) || found[index];
+                break;
+            }
+        }
+    }
+    (void)closedir(threads);
+
+    for (U32 index = 0; index < count; index++) {
+        result.missing += found[index] ? 0 : 1;
+    }
+    return result;
+}
+
+}  // namespace TaskSchedule
+}  // namespace Components
@@ -0,0 +1,74 @@
+// ======================================================================
+// \title  TaskSchedule.hpp
+// \author ortega
+// \brief  hpp file for the scheduling policy and CPU affinity of the threads of the process
+// ======================================================================
+
+#ifndef Components_TaskSchedule_HPP
+#define Components_TaskSchedule_HPP
+
+#include "FpConfig.hpp"
+#include "Os/Task.hpp"
+
+namespace Components {
+
+//! Scheduling policy and CPU affinity of the threads of the process (Linux only)
+//!
+//! The topology describes the scheduling of its threads in a table keyed by thread name, the task name the TaskNamer
+//! gives every Os::Task thread. Once the threads are started, apply looks each running thread of
+//! the process up in the table and sets its policy, priority and CPUs. The real-time policy needs CAP_SYS_NICE or an
+//! RLIMIT_RTPRIO limit: without them the threads keep their policy and a warning is printed, and their CPUs are
+//! still set.
+namespace TaskSchedule {
+
+//! Table name of the thread running the main function of the process, whose kernel name is the executable name
+const char MAIN_THREAD[] = "main";
+
+//! Most entries of a table
+const U32 MAX_ENTRIES = 32;
+
+//! Scheduling policy of a thread
+enum Policy {
+    OTHER,  //!< Time-shared SCHED_OTHER. The priority is the nice value, from -20 to 19, lower runs more.
+    FIFO    //!< Real-time SCHED_FIFO. The priority is from 1 to 99, higher runs first.
+};
+
+//! Scheduling of the threads of one name
+struct Entry {
+    const char* name;  //!< Thread name: the task name truncated to the 15 characters Linux keeps, or MAIN_THREAD
+    Policy policy;     //!< Scheduling policy
+    I32 priority;      //!< Real-time priority or nice value, depending on the policy
+    U32 cpus;          //!< CPUs the thread may run on, bit n for CPU n, 0 for any CPU
+};
+
+//! Outcome of applying a table
+struct Result {
+    U32 applied;   //!< Threads given both their policy and their CPUs
+    U32 denied;    //!< Threads whose policy or priority was refused, usually for lack of permission, left unchanged
+    U32 unpinned;  //!< Threads none of whose CPUs the process may use, left on any CPU
+    U32 missing;   //!< Entries without a running thread of that name
+};
+
+//! Task registry naming the thread of every Os::Task after the task, so the scheduling table, stack reports and tools
+//! such as top -H find threads by task name instead of the executable name. Register it before the first task starts.
+class TaskNamer : public Os::TaskRegistry {
+  public:
+    //! Name the thread the task was just started on, truncated to the 15 characters Linux keeps
+    void addTask(Os::Task* task) override;
+
+    //! Nothing to do: the thread name goes away with the thread
+    void removeTask(Os::Task* task) override;
+};
+
+//! Schedule the running threads of the process after the table, printing a warning for every thread it could not
+//! schedule fully. Threads started afterwards are not affected.
+//!
+//! \return the outcome, per thread
+Result apply(const Entry* table,  //!< Scheduling of the threads, looked up by name
+             U32 count            //!< Number of entries, at most MAX_ENTRIES
+);
+
+}  // namespace TaskSchedule
+}  // namespace Components
+
+#endif
@@ -0,0 +1,38 @@
+// ======================================================================
+// \title  TaskMonitorTestMain.cpp
+// \author ortega
+// \brief  cpp file for TaskMonitor component test main function
+// ======================================================================
+
+#include "TaskMonitorTester.hpp"
+
+// Stack painting cannot be turned off once enabled, so this test comes first
+TEST(OffNominal, TestDisabled) {
+    Components::TaskMonitorTester tester;
+    tester.testDisabled();
+}
+
+TEST(Nominal, TestHighWater) {
+    Components::TaskMonitorTester tester;
+    tester.testHighWater();
+}
+
+TEST(Nominal, TestReport) {
+    Components::TaskMonitorTester tester;
+    tester.testReport();
+}
+
+TEST(Nominal, TestSchedule) {
+    Components::TaskMonitorTester tester;
+    tester.testSchedule();
+}
+
+TEST(Nominal, TestCpu) {
+    Components::TaskMonitorTester tester;
+    tester.testCpu();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,335 @@
+// ======================================================================
+// \title  TaskMonitorTester.cpp
+// \author ortega
+// \brief  cpp file for TaskMonitor component test harness implementation class
+// ======================================================================
+
+#include "TaskMonitorTester.hpp"
+#include "Components/TaskMonitor/TaskSchedule.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 TaskMonitorTester::TEST_STACK_SIZE;
+const U32 TaskMonitorTester::TEST_STACK_USE;
+
+namespace {
+//! Thread using a known amount of stack, then waiting to be released
+struct TestThread {
+    std::atomic<bool> started{false};
+    std::atomic<bool> released{false};
+    std::atomic<I32> tid{0};
+};
+
+void* testThreadRoutine(void* argument) {
+    TestThread* thread = static_cast<TestThread*>(argument);
+    volatile U8 buffer[TaskMonitorTester::TEST_STACK_USE];
+    for (U32 i = 0; i < sizeof(buffer); i++) {
+        buffer[i] = static_cast<U8>(i);
+    }
+    thread->tid.store(static_cast<I32>(syscall(SYS_gettid)));
+    thread->started.store(true);
+    while (!thread->released.load()) {
+        (void)usleep(1000);
+    }
+    return nullptr;
+}
+
+//! Thread using the CPU without pause until it is released
+void* busyThreadRoutine(void* argument) {
+    TestThread* thread = static_cast<TestThread*>(argument);
+    thread->tid.store(static_cast<I32>(syscall(SYS_gettid)));
+    thread->started.store(true);
+    volatile U64 sum = 0;
+    while (!thread->released.load()) {
+        sum = sum + 1;
+    }
+    return nullptr;
+}
+
+//! Start a named test thread through the stack painting hook, as the deployment does, and wait until it used its stack
+void startThread(TestThread& thread, pthread_t& id, const char* name) {
+    pthread_attr_t attributes;
+    ASSERT_EQ(pthread_attr_init(&attributes), 0);
+    ASSERT_EQ(pthread_attr_setstacksize(&attributes, TaskMonitorTester::TEST_STACK_SIZE), 0);
+    ASSERT_EQ(StackPaint::create(pthread_create, &id, &attributes, testThreadRoutine, &thread), 0);
+    (void)pthread_attr_destroy(&attributes);
+    ASSERT_EQ(pthread_setname_np(id, name), 0);
+    while (!thread.started.load()) {
+        (void)usleep(1000);
+    }
+}
+
+//! Release a test thread and wait for it to exit
+void stopThread(TestThread& thread, pthread_t id) {
+    thread.released.store(true);
+    ASSERT_EQ(pthread_join(id, nullptr), 0);
+}
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TaskMonitorTester ::TaskMonitorTester()
+    : TaskMonitorGTestBase("TaskMonitorTester", TaskMonitorTester::MAX_HISTORY_SIZE), component("TaskMonitor") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+TaskMonitorTester ::~TaskMonitorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TaskMonitorTester ::testDisabled() {
+    ASSERT_FALSE(StackPaint::isEnabled());
+    TestThread thread;
+    pthread_t id;
+    startThread(thread, id, "plainThread");
+
+    // Unpainted threads are not tracked and nothing is reported
+    ASSERT_EQ(StackPaint::getThreadCount(), 0U);
+    // The hook reports bad arguments to its caller instead of asserting
+    pthread_t unused;
+    ASSERT_EQ(StackPaint::create(nullptr, &unused, nullptr, testThreadRoutine, &thread), EINVAL);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_FALSE(this->component.writeReport("TaskMonitorUtDisabled.txt"));
+    ASSERT_EQ(access("TaskMonitorUtDisabled.txt", F_OK), -1);
+    stopThread(thread, id);
+}
+
+void TaskMonitorTester ::testHighWater() {
+    StackPaint::enable();
+    TestThread thread;
+    pthread_t id;
+    startThread(thread, id, "deepThread");
+    const U32 slot = StackPaint::getThreadCount() - 1;
+    StackPaint::Usage usage;
+    ASSERT_TRUE(StackPaint::getUsage(slot, usage));
+    ASSERT_FALSE(usage.exited);
+    ASSERT_GE(usage.size, TEST_STACK_SIZE - 4096U);
+    ASSERT_GE(usage.used, TEST_STACK_USE);
+    ASSERT_LT(usage.used, usage.size);
+
+    // The first measurement announces the thread under the name given after its creation
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_StackTracked_SIZE(1);
+    ASSERT_EVENTS_StackTracked(0, slot, "deepThread", usage.size);
+    ASSERT_TLM_StackHighWater_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_StackHighWater->at(0).arg[slot], usage.used);
+    ASSERT_TLM_StackSize_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_StackSize->at(0).arg[slot], usage.size);
+    ASSERT_TLM_StackHeadroomMin_SIZE(1);
+    ASSERT_TLM_StackHeadroomMin(0, usage.size - usage.used);
+
+    // Unchanged stacks send no telemetry
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SIZE(3);
+    ASSERT_EVENTS_StackTracked_SIZE(1);
+
+    // The final high-water mark is kept once the thread exits
+    stopThread(thread, id);
+    StackPaint::Usage last;
+    ASSERT_TRUE(StackPaint::getUsage(slot, last));
+    ASSERT_TRUE(last.exited);
+    ASSERT_GE(last.used, usage.used);
+    ASSERT_EQ(last.size, usage.size);
+}
+
+void TaskMonitorTester ::testReport() {
+    StackPaint::enable();
+    TestThread thread;
+    pthread_t id;
+    startThread(thread, id, "reportThread");
+    const char* const fileName = "TaskMonitorUtReport.txt";
+
+    ASSERT_TRUE(this->component.writeReport(fileName));
+    ASSERT_EVENTS_StackReportWritten_SIZE(1);
+    const U32 threads = this->eventHistory_StackReportWritten->at(0).threads;
+    ASSERT_EQ(threads, StackPaint::getThreadCount());
+    ASSERT_EVENTS_StackTracked_SIZE(threads);
+
+    // A header line then one line per thread
+    FILE* file = fopen(fileName, "r");
+    ASSERT_NE(file, nullptr);
+    char line[128];
+    U32 lines = 0;
+    bool found = false;
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        found = found || (strstr(line, "reportThread") != nullptr);
+        lines++;
+    }
+    (void)fclose(file);
+    (void)remove(fileName);
+    ASSERT_TRUE(found);
+    ASSERT_EQ(lines, threads + 1);
+
+    // A report that cannot be written is announced
+    ASSERT_FALSE(this->component.writeReport("TaskMonitorUtMissing/Report.txt"));
+    ASSERT_EVENTS_StackReportError_SIZE(1);
+    stopThread(thread, id);
+}
+
+void TaskMonitorTester ::testSchedule() {
+    TestThread shared;
+    TestThread realTime;
+    pthread_t sharedId;
+    pthread_t realTimeId;
+    startThread(shared, sharedId, "sharedThread");
+    startThread(realTime, realTimeId, "realTimeThread");
+    cpu_set_t allowed;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+    U32 cpu = 0;
+    while (!CPU_ISSET(cpu, &allowed)) {
+        cpu++;
+    }
+    ASSERT_LT(cpu, 32U);
+
+    const TaskSchedule::Entry table[] = {
+        {"sharedThread", TaskSchedule::OTHER, 5, 1U << cpu},
+        {"realTimeThread", TaskSchedule::FIFO, 10, 0},
+        {"missingThread", TaskSchedule::OTHER, 0, 0},
+    };
+    const TaskSchedule::Result result = TaskSchedule::apply(table, FW_NUM_ARRAY_ELEMENTS(table));
+    ASSERT_EQ(result.missing, 1U);
+    ASSERT_EQ(result.unpinned, 0U);
+    // The real-time policy is only granted with the permission for it, the nice value and CPUs always are
+    ASSERT_EQ(result.applied + result.denied, 2U);
+    ASSERT_LE(result.denied, 1U);
+    ASSERT_EQ(getpriority(PRIO_PROCESS, static_cast<id_t>(shared.tid.load())), 5);
+    cpu_set_t cpus;
+    ASSERT_EQ(sched_getaffinity(shared.tid.load(), sizeof(cpus), &cpus), 0);
+    ASSERT_EQ(CPU_COUNT(&cpus), 1);
+    ASSERT_TRUE(CPU_ISSET(cpu, &cpus));
+    ASSERT_EQ(sched_getscheduler(realTime.tid.load()), (result.denied == 0) ? SCHED_FIFO : SCHED_OTHER);
+
+    stopThread(shared, sharedId);
+    stopThread(realTime, realTimeId);
+}
+
+void TaskMonitorTester ::testCpu() {
+    this->component.loadParameters();
+    // Sample every second call
+    this->paramSet_CPU_SAMPLE_PERIOD(2, Fw::ParamValid::VALID);
+    this->paramSend_CPU_SAMPLE_PERIOD(0, 0);
+
+    TestThread idle;
+    TestThread busy;
+    pthread_t idleId;
+    pthread_t busyId;
+    startThread(idle, idleId, "idleThread");
+    ASSERT_EQ(pthread_create(&busyId, nullptr, busyThreadRoutine, &busy), 0);
+    ASSERT_EQ(pthread_setname_np(busyId, "busyThread"), 0);
+    while (!busy.started.load()) {
+        (void)usleep(1000);
+    }
+
+    // The second call takes the first sample, which announces the threads and only sets the starting point
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_ThreadTracked_SIZE(0);
+    this->invoke_to_run(0, 0);
+    const U32 idleSlot = this->trackedSlot("idleThread");
+    const U32 busySlot = this->trackedSlot("busyThread");
+    ASSERT_LT(idleSlot, TASK_MONITOR_MAX_THREADS);
+    ASSERT_LT(busySlot, TASK_MONITOR_MAX_THREADS);
+    ASSERT_NE(idleSlot, busySlot);
+    ASSERT_TLM_ThreadCpuUsage_SIZE(0);
+
+    // The next sample reports the use over the period between the two
+    (void)usleep(200000);
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_ThreadCpuUsage_SIZE(1);
+    ASSERT_TLM_ThreadSwitches_SIZE(1);
+    const TaskThreadCpu& usage = this->tlmHistory_ThreadCpuUsage->at(0).arg;
+    const TaskThreadCpu& switches = this->tlmHistory_ThreadSwitches->at(0).arg;
+    ASSERT_GT(usage[busySlot], usage[idleSlot]);
+    ASSERT_LE(usage[busySlot], 10000U);
+    // The idle thread wakes up every millisecond
+    ASSERT_GT(switches[idleSlot], 0U);
+    // Known threads are not announced again before CPU_ANNOUNCE_PERIOD samples
+    const U32 tracked = static_cast<U32>(this->eventHistory_ThreadTracked->size());
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_ThreadTracked_SIZE(tracked);
+    ASSERT_TLM_ThreadCpuUsage_SIZE(2);
+
+    // A thread gone frees its slot, which the next new thread takes and announces
+    stopThread(idle, idleId);
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    ASSERT_EQ(this->component.m_cpuThreads[idleSlot].tid, 0);
+    this->clearHistory();
+    TestThread next;
+    pthread_t nextId;
+    startThread(next, nextId, "nextThread");
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_ThreadTracked_SIZE(1);
+    ASSERT_EQ(this->trackedSlot("nextThread"), idleSlot);
+
+    // A tid reused by a new thread, told apart by its start time, is announced again in its slot
+    this->clearHistory();
+    this->component.m_cpuThreads[busySlot].startTime++;
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_ThreadTracked_SIZE(1);
+    ASSERT_EQ(this->trackedSlot("busyThread"), busySlot);
+    ASSERT_TLM_ThreadCpuUsage_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_ThreadCpuUsage->at(0).arg[busySlot], 0U);
+
+    // Every slot in use is announced again every CPU_ANNOUNCE_PERIOD samples, with the name first read
+    this->paramSet_CPU_ANNOUNCE_PERIOD(3, Fw::ParamValid::VALID);
+    this->paramSend_CPU_ANNOUNCE_PERIOD(0, 0);
+    this->clearHistory();
+    U32 inUse = 0;
+    for (U32 slot = 0; slot < TASK_MONITOR_MAX_THREADS; slot++) {
+        inUse += (this->component.m_cpuThreads[slot].tid != 0) ? 1 : 0;
+    }
+    for (U32 call = 0; call < 6; call++) {
+        this->invoke_to_run(0, 0);
+    }
+    ASSERT_EVENTS_ThreadTracked_SIZE(inUse);
+    ASSERT_EQ(this->trackedSlot("busyThread"), busySlot);
+    ASSERT_EQ(this->trackedSlot("nextThread"), idleSlot);
+
+    // A period of 0 stops the sampling
+    this->paramSet_CPU_SAMPLE_PERIOD(0, Fw::ParamValid::VALID);
+    this->paramSend_CPU_SAMPLE_PERIOD(0, 0);
+    for (U32 call = 0; call < 4; call++) {
+        this->invoke_to_run(0, 0);
+    }
+    ASSERT_TLM_ThreadCpuUsage_SIZE(1);
+
+    stopThread(next, nextId);
+    stopThread(busy, busyId);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U32 TaskMonitorTester ::trackedSlot(const char* name) {
+    for (U32 event = 0; event < this->eventHistory_ThreadTracked->size(); event++) {
+        if (strcmp(this->eventHistory_ThreadTracked->at(event).name.toChar(), name) == 0) {
+            return this->eventHistory_ThreadTracked->at(event).slot;
+        }
+    }
+    return TASK_MONITOR_MAX_THREADS;
+}
+
+}  // namespace Components
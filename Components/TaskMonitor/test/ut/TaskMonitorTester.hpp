@@ -0,0 +1,91 @@
+// ======================================================================
+// \title  TaskMonitorTester.hpp
+// \author ortega
+// \brief  hpp file for TaskMonitor component test harness implementation class
+// ======================================================================
+
+#ifndef Components_TaskMonitorTester_HPP
+#define Components_TaskMonitorTester_HPP
+
+#include "Components/TaskMonitor/TaskMonitor.hpp"
+#include "Components/TaskMonitor/TaskMonitorGTestBase.hpp"
+
+namespace Components {
+
+class TaskMonitorTester : public TaskMonitorGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 40;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    //! Stack size of the threads started by the tests
+    static const U32 TEST_STACK_SIZE = 64 * 1024;
+
+    //! Stack the deep test thread uses on top of its start routine
+    static const U32 TEST_STACK_USE = 16 * 1024;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object TaskMonitorTester
+    TaskMonitorTester();
+
+    //! Destroy object TaskMonitorTester
+    ~TaskMonitorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Nothing is reported while stack painting is off. Must run before any test enabling it.
+    void testDisabled();
+
+    //! The high-water mark of a painted thread covers its deepest use and survives the thread
+    void testHighWater();
+
+    //! The report lists the tracked threads by name
+    void testReport();
+
+    //! The threads named in a scheduling table get their policy and CPUs
+    void testSchedule();
+
+    //! The CPU use of every thread is sampled at the period set and announced by thread name, again at the announce
+    //! period, and the slots of the threads gone are reused
+    void testCpu();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! \return the slot ThreadTracked announced for a thread, TASK_MONITOR_MAX_THREADS when none
+    U32 trackedSlot(const char* name  //!< Name of the thread
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    TaskMonitor component;
+};
+
+}  // namespace Components
+
+#endif
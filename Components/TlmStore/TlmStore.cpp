@@ -0,0 +1,156 @@
+// ======================================================================
+// \title  TlmStore.cpp
+// \author ortega
+// \brief  cpp file for TlmStore component implementation class
+// ======================================================================
+
+#include "Components/TlmStore/TlmStore.hpp"
+#include "FpConfig.hpp"
+#include "Fw/Tlm/TlmPacket.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Components {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+TlmStore ::TlmStore(const char* const compName)
+    : TlmStoreComponentBase(compName), m_channels(nullptr), m_channelCount(0) {
+    for (U32 slot = 0; slot < TLM_STORE_MAX_CHANNELS; slot++) {
+        this->m_slots[slot].sequence.store(0, std::memory_order_relaxed);
+        this->m_slots[slot].updated.store(false, std::memory_order_relaxed);
+        this->m_slots[slot].size = 0;
+    }
+}
+
+TlmStore ::~TlmStore() {}
+
+void TlmStore ::configure(const FwChanIdType* channels, U32 count) {
+    FW_ASSERT(channels != nullptr);
+    FW_ASSERT(count <= TLM_STORE_MAX_CHANNELS, static_cast<FwAssertArgType>(count));
+    for (U32 slot = 1; slot < count; slot++) {
+        FW_ASSERT(channels[slot - 1] < channels[slot], static_cast<FwAssertArgType>(channels[slot]));
+    }
+    this->m_channels = channels;
+    this->m_channelCount = count;
+}
+
+U32 TlmStore ::getChannelCount() const {
+    return this->m_channelCount;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void TlmStore ::TlmRecv_handler(FwIndexType portNum, FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+    // The table holds every channel of the topology dictionary, so a channel missing from it is a configuration error
+    const U32 index = this->findSlot(id);
+    FW_ASSERT(index < this->m_channelCount, static_cast<FwAssertArgType>(id));
+    Slot& slot = this->m_slots[index];
+
+    // A channel usually has a single writer, but nothing prevents two: they take turns by making the sequence odd
+    U32 sequence = slot.sequence.load(std::memory_order_relaxed);
+    while (((sequence & 1U) != 0) ||
+           !slot.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_relaxed)) {
+        sequence = slot.sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.seconds = timeTag.getSeconds();
+    slot.useconds = timeTag.getUSeconds();
+    slot.timeBase = static_cast<FwTimeBaseStoreType>(timeTag.getTimeBase());
+    slot.context = timeTag.getContext();
+    slot.size = val.getBuffLength();
+    (void)memcpy(slot.value, val.getBuffAddr(), static_cast<size_t>(slot.size));
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    slot.updated.store(true, std::memory_order_release);
+}
+
+Fw::TlmValid TlmStore ::TlmGet_handler(FwIndexType portNum, FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+    const U32 index = this->findSlot(id);
+    if ((index == this->m_channelCount) || !this->readSlot(this->m_slots[index], timeTag, val)) {
+        val.resetSer();
+        return Fw::TlmValid::INVALID;
+    }
+    return Fw::TlmValid::VALID;
+}
+
+void TlmStore ::Run_handler(FwIndexType portNum, U32 context) {
+    // Only write packets if connected
+    if (!this->isConnected_PktSend_OutputPort(0)) {
+        return;
+    }
+    Fw::TlmPacket packet;
+    packet.resetPktSer();
+    Fw::Time timeTag;
+    Fw::TlmBuffer value;
+
+    for (U32 index = 0; index < this->m_channelCount; index++) {
+        Slot& slot = this->m_slots[index];
+        // Cleared before the copy, so a write landing during the copy is sent again on the next run
+        if (!slot.updated.exchange(false, std::memory_order_acq_rel) || !this->readSlot(slot, timeTag, value)) {
+            continue;
+        }
+        Fw::SerializeStatus status = packet.addValue(this->m_channels[index], timeTag, value);
+        // Send the packet once it is full and start the next one with the value
+        if (status == Fw::FW_SERIALIZE_NO_ROOM_LEFT) {
+            this->PktSend_out(0, packet.getBuffer(), 0);
+            packet.resetPktSer();
+            status = packet.addValue(this->m_channels[index], timeTag, value);
+        }
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    }
+
+    // Send remnant entries
+    if (packet.getNumEntries() > 0) {
+        this->PktSend_out(0, packet.getBuffer(), 0);
+    }
+}
+
+void TlmStore ::pingIn_handler(FwIndexType portNum, U32 key) {
+    this->pingOut_out(0, key);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U32 TlmStore ::findSlot(FwChanIdType id) const {
+    const FwChanIdType* const end = this->m_channels + this->m_channelCount;
+    const FwChanIdType* const found = std::lower_bound(this->m_channels, end, id);
+    return ((found != end) && (*found == id)) ? static_cast<U32>(found - this->m_channels) : this->m_channelCount;
+}
+
+bool TlmStore ::readSlot(const Slot& slot, Fw::Time& timeTag, Fw::TlmBuffer& value) const {
+    U32 before = 0;
+    U32 seconds = 0;
+    U32 useconds = 0;
+    FwTimeBaseStoreType timeBase = 0;
+    FwTimeContextStoreType context = 0;
+    FwSizeType size = 0;
+    do {
+        before = slot.sequence.load(std::memory_order_acquire);
+        if (before == 0) {
+            return false;
+        }
+        seconds = slot.seconds;
+        useconds = slot.useconds;
+        timeBase = slot.timeBase;
+        context = slot.context;
+        // A torn size is discarded with the rest of the copy, but must not overrun the buffer meanwhile
+        size = FW_MIN(slot.size, static_cast<FwSizeType>(value.getBuffCapacity()));
+        (void)memcpy(value.getBuffAddr(), slot.value, static_cast<size_t>(size));
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (((before & 1U) != 0) || (before != slot.sequence.load(std::memory_order_relaxed)));
+
+    timeTag.set(static_cast<TimeBase>(timeBase), context, seconds, useconds);
+    const Fw::SerializeStatus status = value.setBuffLen(static_cast<NATIVE_UINT_TYPE>(size));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    return true;
+}
+
+}  // namespace Components
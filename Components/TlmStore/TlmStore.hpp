@@ -0,0 +1,118 @@
+// ======================================================================
+// \title  TlmStore.hpp
+// \author ortega
+// \brief  hpp file for TlmStore component implementation class
+// ======================================================================
+
+#ifndef Components_TlmStore_HPP
+#define Components_TlmStore_HPP
+
+#include <atomic>
+
+#include "Components/TlmStore/FppConstantsAc.hpp"
+#include "Components/TlmStore/TlmStoreComponentAc.hpp"
+
+namespace Components {
+
+class TlmStore : public TlmStoreComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct TlmStore object
+    TlmStore(const char* const compName  //!< The component name
+    );
+
+    //! Destroy TlmStore object
+    ~TlmStore();
+
+    //! Give the store its channels, one slot each
+    //!
+    //! The table is generated from the topology dictionary at build time by tools/tlm_channel_table.py. It is not
+    //! copied and must outlive the store. Configure the store before any telemetry is written.
+    void configure(const FwChanIdType* channels,  //!< Channel IDs in increasing order
+                   U32 count                      //!< Number of channels, at most TLM_STORE_MAX_CHANNELS
+    );
+
+    //! \return the number of channels of the table
+    U32 getChannelCount() const;
+
+    PRIVATE :
+
+        // ----------------------------------------------------------------------
+        // Handler implementations for user-defined typed input ports
+        // ----------------------------------------------------------------------
+
+        //! Handler implementation for TlmRecv
+        //!
+        //! Stores the value of a channel in its slot
+        void
+        TlmRecv_handler(FwIndexType portNum,   //!< The port number
+                        FwChanIdType id,       //!< Telemetry Channel ID
+                        Fw::Time& timeTag,     //!< Time Tag
+                        Fw::TlmBuffer& val     //!< Buffer containing serialized telemetry value
+                        ) override;
+
+    //! Handler implementation for TlmGet
+    //!
+    //! Returns the last value of a channel, invalid when it has none
+    Fw::TlmValid TlmGet_handler(FwIndexType portNum,  //!< The port number
+                                FwChanIdType id,      //!< Telemetry Channel ID
+                                Fw::Time& timeTag,    //!< Set to the time tag of the value
+                                Fw::TlmBuffer& val    //!< Set to the serialized value
+                                ) override;
+
+    //! Handler implementation for Run
+    //!
+    //! Sends the channels updated since the previous run in packets
+    void Run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
+    //! Handler implementation for pingIn
+    //!
+    //! Answers the health ping
+    void pingIn_handler(FwIndexType portNum,  //!< The port number
+                        U32 key               //!< Value to return to pinger
+                        ) override;
+
+    PRIVATE :
+        //! Last value of one channel, on its own cache line so writers of different channels do not contend
+        struct alignas(64) Slot {
+            std::atomic<U32> sequence;  //!< Twice the number of writes, odd during a write
+            std::atomic<bool> updated;  //!< Written since the previous run
+            U32 seconds;
+            U32 useconds;
+            FwTimeBaseStoreType timeBase;
+            FwTimeContextStoreType context;
+            FwSizeType size;  //!< Size of the serialized value
+            U8 value[FW_TLM_BUFFER_MAX_SIZE];
+        };
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Find the slot of a channel by binary search of the channel table
+    //!
+    //! \return the slot, the channel count when the channel is not in the table
+    U32 findSlot(FwChanIdType id  //!< The channel
+    ) const;
+
+    //! Copy the value of a slot, retrying while a write overlaps
+    //!
+    //! \return false when the slot was never written
+    bool readSlot(const Slot& slot,      //!< The slot
+                  Fw::Time& timeTag,     //!< Set to the time tag of the value
+                  Fw::TlmBuffer& value   //!< Set to the serialized value
+    ) const;
+
+    const FwChanIdType* m_channels;        //! Channel of each slot, in increasing order
+    U32 m_channelCount;                    //! Number of channels of the table
+    Slot m_slots[TLM_STORE_MAX_CHANNELS];  //! Channel values, in the order of the table
+};
+
+}  // namespace Components
+
+#endif
@@ -0,0 +1,42 @@
+// ======================================================================
+// \title  TlmStoreTestMain.cpp
+// \author ortega
+// \brief  cpp file for TlmStore component test main function
+// ======================================================================
+
+#include "TlmStoreTester.hpp"
+
+TEST(Nominal, TestStore) {
+    Components::TlmStoreTester tester;
+    tester.testStore();
+}
+
+TEST(OffNominal, TestConfigure) {
+    Components::TlmStoreTester tester;
+    tester.testConfigure();
+}
+
+TEST(Nominal, TestRun) {
+    Components::TlmStoreTester tester;
+    tester.testRun();
+}
+
+TEST(Nominal, TestManyChannels) {
+    Components::TlmStoreTester tester;
+    tester.testManyChannels();
+}
+
+TEST(Nominal, TestConcurrentWrites) {
+    Components::TlmStoreTester tester;
+    tester.testConcurrentWrites();
+}
+
+TEST(Nominal, TestPing) {
+    Components::TlmStoreTester tester;
+    tester.testPing();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
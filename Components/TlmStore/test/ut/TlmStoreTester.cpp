@@ -0,0 +1,223 @@
+// ======================================================================
+// \title  TlmStoreTester.cpp
+// \author ortega
+// \brief  cpp file for TlmStore component test harness implementation class
+// ======================================================================
+
+#include "TlmStoreTester.hpp"
+#include "Fw/Com/ComPacket.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace Components {
+
+// The assertions take their operands by reference
+const U32 TlmStoreTester::MANY_CHANNELS;
+const U32 TlmStoreTester::TEST_CHANNELS;
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TlmStoreTester ::TlmStoreTester()
+    : TlmStoreGTestBase("TlmStoreTester", TlmStoreTester::MAX_HISTORY_SIZE), component("TlmStore") {
+    this->initComponents();
+    this->connectPorts();
+    U32 count = 0;
+    this->channels[count++] = 0x0E01;
+    this->channels[count++] = 0x0E02;
+    this->channels[count++] = 0x0F03;
+    for (U32 channel = 0; channel < MANY_CHANNELS; channel++) {
+        this->channels[count++] = 0x1000 + channel;
+    }
+    this->channels[count++] = 0x5201;
+    this->component.configure(this->channels, count);
+}
+
+TlmStoreTester ::~TlmStoreTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TlmStoreTester ::testStore() {
+    U32 value = 0;
+    Fw::Time timeTag;
+    ASSERT_EQ(this->component.getChannelCount(), TEST_CHANNELS);
+    ASSERT_EQ(this->read(0x0E01, value, timeTag), Fw::TlmValid::INVALID);
+    ASSERT_EQ(this->read(0x0E03, value, timeTag), Fw::TlmValid::INVALID);
+    ASSERT_EQ(this->read(0x6000, value, timeTag), Fw::TlmValid::INVALID);
+
+    this->write(0x0E01, 5, 100);
+    this->write(0x0E02, 6, 101);
+    ASSERT_EQ(this->read(0x0E01, value, timeTag), Fw::TlmValid::VALID);
+    ASSERT_EQ(value, 5U);
+    ASSERT_EQ(timeTag.getSeconds(), 100U);
+    ASSERT_EQ(timeTag.getUSeconds(), 7U);
+    ASSERT_EQ(timeTag.getTimeBase(), TB_WORKSTATION_TIME);
+
+    // A new value replaces the previous one in the same slot
+    this->write(0x0E01, 8, 102);
+    ASSERT_EQ(this->read(0x0E01, value, timeTag), Fw::TlmValid::VALID);
+    ASSERT_EQ(value, 8U);
+    ASSERT_EQ(timeTag.getSeconds(), 102U);
+    ASSERT_EQ(this->read(0x0E02, value, timeTag), Fw::TlmValid::VALID);
+    ASSERT_EQ(value, 6U);
+
+    ASSERT_EQ(this->read(0x5201, value, timeTag), Fw::TlmValid::INVALID);
+
+    // A channel missing from the table is a configuration error
+    ASSERT_DEATH(this->write(0x0E03, 1, 0), "");
+}
+
+void TlmStoreTester ::testConfigure() {
+    const FwChanIdType unsorted[] = {0x0E01, 0x0F03, 0x0E02};
+    ASSERT_DEATH(this->component.configure(unsorted, FW_NUM_ARRAY_ELEMENTS(unsorted)), "");
+    const FwChanIdType repeated[] = {0x0E01, 0x0E01};
+    ASSERT_DEATH(this->component.configure(repeated, FW_NUM_ARRAY_ELEMENTS(repeated)), "");
+    ASSERT_DEATH(this->component.configure(this->channels, TLM_STORE_MAX_CHANNELS + 1), "");
+
+    // An empty table holds no channel
+    this->component.configure(this->channels, 0);
+    ASSERT_EQ(this->component.getChannelCount(), 0U);
+    U32 value = 0;
+    Fw::Time timeTag;
+    ASSERT_EQ(this->read(0x0E01, value, timeTag), Fw::TlmValid::INVALID);
+}
+
+void TlmStoreTester ::testRun() {
+    // Nothing written, nothing sent
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(0);
+
+    this->write(0x0F03, 3, 1);
+    this->write(0x0E01, 1, 1);
+    this->write(0x5201, 2, 1);
+    this->write(0x0E01, 4, 2);
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(1);
+    FwChanIdType ids[4];
+    U32 values[4];
+    ASSERT_EQ(this->decodePacket(0, ids, values, 4), 3U);
+    ASSERT_EQ(ids[0], 0x0E01U);
+    ASSERT_EQ(values[0], 4U);
+    ASSERT_EQ(ids[1], 0x0F03U);
+    ASSERT_EQ(values[1], 3U);
+    ASSERT_EQ(ids[2], 0x5201U);
+    ASSERT_EQ(values[2], 2U);
+
+    // Only the channels updated since are sent again
+    this->clearHistory();
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(0);
+    this->write(0x5201, 9, 3);
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(1);
+    ASSERT_EQ(this->decodePacket(0, ids, values, 4), 1U);
+    ASSERT_EQ(ids[0], 0x5201U);
+    ASSERT_EQ(values[0], 9U);
+}
+
+void TlmStoreTester ::testManyChannels() {
+    for (U32 channel = 0; channel < MANY_CHANNELS; channel++) {
+        this->write(0x1000 + channel, channel, 1);
+    }
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_GT(this->fromPortHistory_PktSend->size(), 1U);
+
+    // Every channel is sent once, in order, across the packets
+    FwChanIdType ids[MANY_CHANNELS];
+    U32 values[MANY_CHANNELS];
+    U32 entries = 0;
+    for (U32 packet = 0; packet < this->fromPortHistory_PktSend->size(); packet++) {
+        entries += this->decodePacket(packet, &ids[entries], &values[entries], MANY_CHANNELS - entries);
+    }
+    ASSERT_EQ(entries, MANY_CHANNELS);
+    for (U32 channel = 0; channel < MANY_CHANNELS; channel++) {
+        ASSERT_EQ(ids[channel], 0x1000 + channel);
+        ASSERT_EQ(values[channel], channel);
+    }
+}
+
+void TlmStoreTester ::testConcurrentWrites() {
+    // Each value repeats its low byte in all four bytes and is written with a matching time tag, so a torn read shows
+    std::atomic<bool> done(false);
+    auto writer = [this](U32 first) {
+        for (U32 i = 0; i < 100000; i++) {
+            const U32 byte = (first + i) & 0xFF;
+            this->write(0x0E01, byte * 0x01010101, byte);
+        }
+    };
+    std::thread first(writer, 0);
+    std::thread second(writer, 128);
+    std::thread reader([this, &done] {
+        while (!done.load()) {
+            U32 value = 0;
+            Fw::Time timeTag;
+            if (this->read(0x0E01, value, timeTag) == Fw::TlmValid::VALID) {
+                EXPECT_EQ(value, (value & 0xFF) * 0x01010101);
+                EXPECT_EQ(timeTag.getSeconds(), value & 0xFF);
+            }
+        }
+    });
+    first.join();
+    second.join();
+    done.store(true);
+    reader.join();
+}
+
+void TlmStoreTester ::testPing() {
+    this->invoke_to_pingIn(0, 0x1234);
+    this->component.doDispatch();
+    ASSERT_from_pingOut_SIZE(1);
+    ASSERT_from_pingOut(0, 0x1234U);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void TlmStoreTester ::write(FwChanIdType id, U32 value, U32 seconds) {
+    Fw::TlmBuffer buffer;
+    ASSERT_EQ(buffer.serialize(value), Fw::FW_SERIALIZE_OK);
+    Fw::Time timeTag(TB_WORKSTATION_TIME, 0, seconds, 7);
+    this->invoke_to_TlmRecv(0, id, timeTag, buffer);
+}
+
+Fw::TlmValid TlmStoreTester ::read(FwChanIdType id, U32& value, Fw::Time& timeTag) {
+    Fw::TlmBuffer buffer;
+    const Fw::TlmValid valid = this->invoke_to_TlmGet(0, id, timeTag, buffer);
+    if (valid == Fw::TlmValid::VALID) {
+        EXPECT_EQ(buffer.getBuffLength(), sizeof(U32));
+        EXPECT_EQ(buffer.deserialize(value), Fw::FW_SERIALIZE_OK);
+    } else {
+        EXPECT_EQ(buffer.getBuffLength(), 0U);
+    }
+    return valid;
+}
+
+U32 TlmStoreTester ::decodePacket(U32 index, FwChanIdType* ids, U32* values, U32 capacity) {
+    Fw::ComBuffer packet = this->fromPortHistory_PktSend->at(index).data;
+    packet.resetDeser();
+    FwPacketDescriptorType descriptor = 0;
+    EXPECT_EQ(packet.deserialize(descriptor), Fw::FW_SERIALIZE_OK);
+    EXPECT_EQ(descriptor, static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_TELEM));
+    U32 entries = 0;
+    while ((packet.getBuffLeft() > 0) && (entries < capacity)) {
+        Fw::Time timeTag;
+        EXPECT_EQ(packet.deserialize(ids[entries]), Fw::FW_SERIALIZE_OK);
+        EXPECT_EQ(packet.deserialize(timeTag), Fw::FW_SERIALIZE_OK);
+        EXPECT_EQ(packet.deserialize(values[entries]), Fw::FW_SERIALIZE_OK);
+        entries++;
+    }
+    EXPECT_EQ(packet.getBuffLeft(), 0U);
+    return entries;
+}
+
+}  // namespace Components
@@ -0,0 +1,108 @@
+// ======================================================================
+// \title  TlmStoreTester.hpp
+// \author ortega
+// \brief  hpp file for TlmStore component test harness implementation class
+// ======================================================================
+
+#ifndef Components_TlmStoreTester_HPP
+#define Components_TlmStoreTester_HPP
+
+#include "Components/TlmStore/TlmStore.hpp"
+#include "Components/TlmStore/TlmStoreGTestBase.hpp"
+
+namespace Components {
+
+class TlmStoreTester : public TlmStoreGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 40;
+
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+    //! Number of channels filling several packets
+    static const U32 MANY_CHANNELS = 100;
+
+    //! Number of channels of the store under test: 0x0E01, 0x0E02, 0x0F03, the many channels from 0x1000 and 0x5201
+    static const U32 TEST_CHANNELS = MANY_CHANNELS + 4;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object TlmStoreTester
+    TlmStoreTester();
+
+    //! Destroy object TlmStoreTester
+    ~TlmStoreTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! The last value of each channel is returned with its time tag, channels never written are invalid
+    void testStore();
+
+    //! The channel table must be in increasing order and fit the slots
+    void testConfigure();
+
+    //! Each run sends the channels updated since the previous one, in the order of the channel table
+    void testRun();
+
+    //! Channels beyond one packet are sent in several
+    void testManyChannels();
+
+    //! Values read while other threads write are never torn
+    void testConcurrentWrites();
+
+    //! Health pings are answered
+    void testPing();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+    //! Write a U32 value to a channel
+    void write(FwChanIdType id, U32 value, U32 seconds);
+
+    //! Read the U32 value of a channel
+    //!
+    //! \return the validity of the value
+    Fw::TlmValid read(FwChanIdType id, U32& value, Fw::Time& timeTag);
+
+    //! Decode the U32 entries of a sent packet into ids and values
+    //!
+    //! \return the number of entries
+    U32 decodePacket(U32 index, FwChanIdType* ids, U32* values, U32 capacity);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! Channel table of the component under test
+    FwChanIdType channels[TEST_CHANNELS];
+
+    //! The component under test
+    TlmStore component;
+};
+
+}  // namespace Components
+
+#endif
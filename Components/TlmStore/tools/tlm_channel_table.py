@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Generate the channel table of a TlmStore from a topology dictionary.
+
+The table lists the ID of every telemetry channel of the dictionary in increasing order. TlmStore::configure gives
+each one a slot, so the store holds exactly the channels of the topology. Both the XML dictionary
+(<Topology>TopologyAppDictionary.xml) and the JSON dictionary (<Topology>TopologyDictionary.json) are read.
+
+The generated C++ file defines <namespace>::TLM_CHANNELS and <namespace>::TLM_CHANNEL_COUNT. Its build fails when the
+dictionary has more channels than TLM_STORE_MAX_CHANNELS.
+
+Usage: tlm_channel_table.py <dictionary> <output.cpp> <namespace>
+"""
+import argparse
+import json
+import sys
+import xml.etree.ElementTree as ElementTree
+
+
+def read_channels(path):
+    """Return (id, name) of the telemetry channels of a dictionary, sorted by ID"""
+    if path.endswith(".json"):
+        with open(path) as dictionary:
+            channels = [(int(channel["id"]), channel["name"]) for channel in json.load(dictionary)["telemetryChannels"]]
+    else:
+        root = ElementTree.parse(path).getroot()
+        channels = [
+            (int(channel.get("id"), 0), f"{channel.get('component')}.{channel.get('name')}")
+            for channel in root.iter("channel")
+        ]
+    channels.sort()
+    for (earlier, earlier_name), (later, later_name) in zip(channels, channels[1:]):
+        if earlier == later:
+            raise ValueError(f"{path}: {earlier_name} and {later_name} share ID {earlier:#x}")
+    return channels
+
+
+def write_table(path, dictionary, namespace, channels):
+    """Write the C++ definition of the table"""
+    lines = [
+        f"// Generated from {dictionary} by Components/TlmStore/tools/tlm_channel_table.py. Do not edit.",
+        "",
+        '#include "Components/TlmStore/TlmStore.hpp"',
+        "",
+        f"namespace {namespace} {{",
+        "",
+        f"static_assert({len(channels)} <= Components::TLM_STORE_MAX_CHANNELS,",
+        '              "The dictionary has more channels than TLM_STORE_MAX_CHANNELS");',
+        "",
+        f"extern const FwChanIdType TLM_CHANNELS[] = {{",
+    ]
+    lines += [f"    {identifier:#06x},  // {name}" for identifier, name in channels]
+    lines += [
+        "};",
+        "",
+        f"extern const U32 TLM_CHANNEL_COUNT = {len(channels)};",
+        "",
+        f"}}  // namespace {namespace}",
+        "",
+    ]
+    with open(path, "w") as output:
+        output.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dictionary", help="topology dictionary, XML or JSON")
+    parser.add_argument("output", help="C++ file to write")
+    parser.add_argument("namespace", help="namespace of the table, the topology module")
+    args = parser.parse_args()
+    try:
+        channels = read_channels(args.dictionary)
+    except (OSError, ValueError, KeyError, ElementTree.ParseError) as error:
+        print(f"tlm_channel_table.py: {error}", file=sys.stderr)
+        return 1
+    if not channels:
+        print(f"tlm_channel_table.py: {args.dictionary} has no telemetry channels", file=sys.stderr)
+        return 1
+    write_table(args.output, args.dictionary.rsplit("/", 1)[-1], args.namespace, channels)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -8,12 +8,16 @@
 // OSAL initialization
 #include <Os/Os.hpp>
 // Used for signal handling shutdown
+#include <pthread.h>
 #include <signal.h>
 // Used for command line argument processing
 #include <getopt.h>
 // Used for printf functions
 #include <cstdlib>
 
+//! Fastest rate at which the simulated cycle may drive the rate groups
+static const U32 MAX_CYCLE_RATE_HZ = 10000;
+
 /**
  * \brief print command line help message
  *
@@ -22,14 +26,24 @@
  * @param app: name of application
  */
 void print_usage(const char* app) {
-    (void)printf("Usage: ./%s [options]\n-a\thostname/IP address\n-p\tport_number\n", app);
+    (void)printf(
+        "Usage: ./%s [options]\n-a\thostname/IP address\n-p\tport_number\n-r\tcycle rate in Hz (1-%u)\n"
+        "-g\tshared memory name the LED GPIO writes are published to (e.g. /ledblinker_gpio)\n"
+        "-s\tmeasure the thread stacks and write StackReport.txt on exit (LEDBLINKER_STACK_PAINT builds)\n"
+        "-H\tback the memory arena with huge pages\n"
+        "-b\tcoalesce the downlink frames into batched socket writes\n"
+        "-P\topen the GPIO devices and the socket while the commands and parameters are loaded\n"
+        "-F\tfast-forward that many cycles (0 until Ctrl-C) in virtual time, as fast as they complete\n"
+        "-R\tpin the threads to CPUs and run the cycle, rate group and LED threads SCHED_FIFO\n",
+        app, MAX_CYCLE_RATE_HZ);
 }
 
 /**
  * \brief shutdown topology cycling on signal
  *
  * The reference topology allows for a simulated cycling of the rate groups. This simulated cycling needs to be stopped
- * in order for the program to shutdown. This is done via handling signals such that it is performed via Ctrl-C
+ * in order for the program to shutdown. This is done via handling signals such that it is performed via Ctrl-C.
+ * stopSimulatedCycle only stores to a lock-free flag, so it is async-signal-safe.
  *
  * @param signum
  */
@@ -51,10 +65,19 @@ int main(int argc, char* argv[]) {
     I32 option = 0;
     CHAR* hostname = nullptr;
     U16 port_number = 0;
+    U32 cycle_rate = 1;
+    CHAR* sim_gpio = nullptr;
+    bool stack_paint = false;
+    bool huge_pages = false;
+    bool batch_downlink = false;
+    bool parallel_boot = false;
+    bool fast_forward = false;
+    U64 fast_forward_cycles = 0;
+    bool real_time = false;
     Os::init();
 
     // Loop while reading the getopt supplied options
-    while ((option = getopt(argc, argv, "hp:a:")) != -1) {
+    while ((option = getopt(argc, argv, "hp:a:r:g:sHbPF:R")) != -1) {
         switch (option) {
             // Handle the -a argument for address/hostname
             case 'a':
@@ -64,6 +87,48 @@ int main(int argc, char* argv[]) {
             case 'p':
                 port_number = static_cast<U16>(atoi(optarg));
                 break;
+            // Handle the -r cycle rate argument
+            case 'r':
+                cycle_rate = static_cast<U32>(atoi(optarg));
+                if ((cycle_rate == 0) || (cycle_rate > MAX_CYCLE_RATE_HZ)) {
+                    print_usage(argv[0]);
+                    return 1;
+                }
+                break;
+            // Handle the -g simulated GPIO shared memory name argument
+            case 'g':
+                sim_gpio = optarg;
+                break;
+            // Handle the -s stack measurement argument, available when built with LEDBLINKER_STACK_PAINT
+            case 's':
+#ifdef LEDBLINKER_STACK_PAINT
+                stack_paint = true;
+                break;
+#else
+                (void)printf("-s needs a build configured with -DLEDBLINKER_STACK_PAINT=ON (Linux only)\n");
+                return 1;
+#endif
+            // Handle the -H huge pages argument
+            case 'H':
+                huge_pages = true;
+                break;
+            // Handle the -b downlink batching argument
+            case 'b':
+                batch_downlink = true;
+                break;
+            // Handle the -P parallel bring-up argument
+            case 'P':
+                parallel_boot = true;
+                break;
+            // Handle the -F fast-forward cycle count argument
+            case 'F':
+                fast_forward = true;
+                fast_forward_cycles = static_cast<U64>(strtoull(optarg, nullptr, 10));
+                break;
+            // Handle the -R real-time scheduling argument
+            case 'R':
+                real_time = true;
+                break;
             // Cascade intended: help output
             case 'h':
             // Cascade intended: help output
@@ -78,15 +143,37 @@ int main(int argc, char* argv[]) {
     LedBlinker::TopologyState inputs;
     inputs.hostname = hostname;
     inputs.port = port_number;
+    inputs.simGpio = sim_gpio;
+    inputs.stackPaint = stack_paint;
+    inputs.hugePages = huge_pages;
+    inputs.batchDownlink = batch_downlink;
+    inputs.parallelBoot = parallel_boot;
+    inputs.virtualTime = fast_forward;
+    inputs.realTime = real_time;
 
     // Setup program shutdown via Ctrl-C
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
     (void)printf("Hit Ctrl-C to quit\n");
 
+    // Shutdown signals are blocked while the topology starts its threads, which inherit the mask. Once unblocked here
+    // the signals are delivered to this thread and interrupt the cycle loop's sleep immediately.
+    sigset_t shutdownSignals;
+    sigemptyset(&shutdownSignals);
+    sigaddset(&shutdownSignals, SIGINT);
+    sigaddset(&shutdownSignals, SIGTERM);
+    (void)pthread_sigmask(SIG_BLOCK, &shutdownSignals, nullptr);
+
     // Setup, cycle, and teardown topology
     LedBlinker::setupTopology(inputs);
-    LedBlinker::startSimulatedCycle(Fw::TimeInterval(1,0));  // Program loop cycling rate groups at 1Hz
+    (void)pthread_sigmask(SIG_UNBLOCK, &shutdownSignals, nullptr);
+    // Program loop cycling rate groups at the requested rate (default 1Hz)
+    const U64 period_ns = 1000000000ULL / cycle_rate;
+    if (fast_forward) {
+        LedBlinker::startFastForwardCycle(period_ns, fast_forward_cycles);
+    } else {
+        LedBlinker::startSimulatedCycle(period_ns);
+    }
     LedBlinker::teardownTopology(inputs);
     (void)printf("Exiting...\n");
     return 0;
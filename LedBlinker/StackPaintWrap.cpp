@@ -0,0 +1,26 @@
+// ======================================================================
+// \title  StackPaintWrap.cpp
+// \author ortega
+// \brief  pthread_create wrapper starting the LedBlinker threads through stack painting
+// ======================================================================
+
+#include <Components/TaskMonitor/StackPaint.hpp>
+
+#include <pthread.h>
+
+// Only built with LEDBLINKER_STACK_PAINT, which links LedBlinker with --wrap=pthread_create: the pthread_create calls
+// of the executable, those of the Os::Task threads included, then reach __wrap_pthread_create, and the real function
+// is __real_pthread_create.
+
+extern "C" int __real_pthread_create(pthread_t* thread,
+                                     const pthread_attr_t* attributes,
+                                     void* (*routine)(void*),
+                                     void* arg);
+
+//! Start every thread through stack painting, which leaves them unpainted until -s enables it
+extern "C" int __wrap_pthread_create(pthread_t* thread,
+                                     const pthread_attr_t* attributes,
+                                     void* (*routine)(void*),
+                                     void* arg) {
+    return Components::StackPaint::create(__real_pthread_create, thread, attributes, routine, arg);
+}
@@ -9,28 +9,42 @@
 //#include <LedBlinker/Top/LedBlinkerPacketsAc.hpp>
 
 // Necessary project-specified types
-#include <Fw/Types/MallocAllocator.hpp>
+#include <Components/ArenaAllocator/ArenaAllocator.hpp>
+#include <Components/MmapSequence/MmapSequence.hpp>
+#include <Components/SgFramer/SgFrame.hpp>
+#include <Components/TaskMonitor/StackPaint.hpp>
+#include <Components/TaskMonitor/TaskSchedule.hpp>
 #include <Svc/FramingProtocol/FprimeProtocol.hpp>
 
-// Used for 1Hz synthetic cycling
-#include <Os/Mutex.hpp>
+// Used for synthetic cycling on absolute deadlines
+#include <time.h>
+#include <atomic>
+#include <cerrno>
 
 #include <Fw/Logger/Logger.hpp>
 
 // Allows easy reference to objects in FPP/autocoder required namespaces
 using namespace LedBlinker;
 
-// The reference topology uses a malloc-based allocator for components that need to allocate memory during the
-// initialization phase.
-Fw::MallocAllocator mallocator;
+// Components that need to allocate memory during the initialization phase allocate it from one region reserved at
+// startup, so the memory footprint of the deployment is fixed and accounted per allocation identifier.
+Components::ArenaAllocator arena;
 
 // The reference topology uses the F´ packet protocol when communicating with the ground and therefore uses the F´
-// framing and deframing implementations.
-Svc::FprimeFraming framing;
+// deframing implementation. The framer implements the protocol itself.
 Svc::FprimeDeframing deframing;
 
 Svc::ComQueue::QueueConfigurationTable configurationTable;
 
+// Command sequences are read from the mapped sequence files instead of being copied into a buffer, checked as they run
+Components::MmapSequence cmdSeqFormat(cmdSeq);
+
+// Threads are named after their tasks so the stack report and tools such as top -H can tell them apart
+Components::TaskSchedule::TaskNamer taskNamer;
+
+// Reads the parameter file and opens the GPIO devices during the parallel bring-up
+Os::Task bootIoTask;
+
 // The reference topology divides the incoming clock signal (1Hz) into sub-signals: 1Hz, 1/2Hz, and 1/4Hz with 0 offset
 Svc::RateGroupDriver::DividerSet rateGroupDivisorsSet{{{1, 0}, {2, 0}, {4, 0}}};
 
@@ -42,23 +56,78 @@ NATIVE_INT_TYPE rateGroup3Context[Svc::ActiveRateGroup::CONNECTION_COUNT_MAX] =
 
 // A number of constants are needed for construction of the topology. These are specified here.
 enum TopologyConstants {
-    CMD_SEQ_BUFFER_SIZE = 5 * 1024,
     FILE_DOWNLINK_TIMEOUT = 1000,
     FILE_DOWNLINK_COOLDOWN = 1000,
     FILE_DOWNLINK_CYCLE_TIME = 1000,
     FILE_DOWNLINK_FILE_QUEUE_DEPTH = 10,
     HEALTH_WATCHDOG_CODE = 0x123,
     COMM_PRIORITY = 100,
+    LED_PWM_PRIORITY = 141,
+    // The edge log segment files are written below the rate groups, like the file downlink they go to
+    LED_EDGE_LOG_PRIORITY = 5,
+    // The text logger writes the events to the console when nothing else needs the processor
+    TEXT_LOGGER_PRIORITY = 1,
+    SIM_GPIO_RECORDS = 65536,
     // bufferManager constants
-    FRAMER_BUFFER_SIZE = FW_MAX(FW_COM_BUFFER_MAX_SIZE, FW_FILE_BUFFER_MAX_SIZE + sizeof(U32)) + HASH_DIGEST_LENGTH + Svc::FpFrameHeader::SIZE,
+    // Scatter-gather framing allocates frame descriptors only. Whole frames would need FW_MAX(FW_COM_BUFFER_MAX_SIZE,
+    // FW_FILE_BUFFER_MAX_SIZE + sizeof(U32)) + HASH_DIGEST_LENGTH + Svc::FpFrameHeader::SIZE bytes.
+    FRAMER_BUFFER_SIZE = sizeof(Components::SgFrame),
     FRAMER_BUFFER_COUNT = 30,
     DEFRAMER_BUFFER_SIZE = FW_MAX(FW_COM_BUFFER_MAX_SIZE, FW_FILE_BUFFER_MAX_SIZE + sizeof(U32)),
     DEFRAMER_BUFFER_COUNT = 30,
     COM_DRIVER_BUFFER_SIZE = 3000,
     COM_DRIVER_BUFFER_COUNT = 30,
-    BUFFER_MANAGER_ID = 200
+    // comDriver downlink batching: a batch is written once it holds this many bytes or its oldest frame waited for
+    // this many microseconds
+    COM_DRIVER_BATCH_BYTES = 8192,
+    COM_DRIVER_BATCH_WINDOW_US = 2000,
+    BUFFER_MANAGER_ID = 200,
+    // Memory arena budget, sized with the usage report printed at startup
+    MEMORY_ARENA_SIZE = 1024 * 1024,
+    // Memory arena allocation identifiers
+    MEMORY_ID_BUFFER_MANAGER = 1,
+    MEMORY_ID_COM_QUEUE = 3,
+    MEMORY_ID_COM_DRIVER = 4,
+    // simTime barrier port of the led ticks, after those of the three rate groups
+    SIM_BARRIER_LED = 3,
+    // Longest real time the fast-forward cycle waits for a cycle to complete before moving on
+    SIM_CYCLE_STALL_US = 1000000,
+    // CPUs of the -R scheduling table: the timing-critical threads share CPU 1, the others CPU 0
+    SCHEDULE_CPUS_CONTROL = 0x2,
+    SCHEDULE_CPUS_IO = 0x1
 };
 
+// Scheduling table applied with -R. The cycle driver, the rate groups and the LED threads run SCHED_FIFO on their own
+// CPU, ordered like their instance priorities, so a tick is never queued behind communication or file work. The
+// threads handling commands, telemetry, files and the console stay time-shared on the other CPU.
+const Components::TaskSchedule::Entry scheduleTable[] = {
+    {"LedPwm", Components::TaskSchedule::FIFO, 90, SCHEDULE_CPUS_CONTROL},
+    {Components::TaskSchedule::MAIN_THREAD, Components::TaskSchedule::FIFO, 85, SCHEDULE_CPUS_CONTROL},
+    {"blockDrv", Components::TaskSchedule::FIFO, 80, SCHEDULE_CPUS_CONTROL},
+    {"rateGroup1", Components::TaskSchedule::FIFO, 70, SCHEDULE_CPUS_CONTROL},
+    {"rateGroup2", Components::TaskSchedule::FIFO, 69, SCHEDULE_CPUS_CONTROL},
+    {"rateGroup3", Components::TaskSchedule::FIFO, 68, SCHEDULE_CPUS_CONTROL},
+    {"led", Components::TaskSchedule::FIFO, 60, SCHEDULE_CPUS_CONTROL},
+    {"ledBank", Components::TaskSchedule::FIFO, 60, SCHEDULE_CPUS_CONTROL},
+    {"cmdDisp", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"cmdSeq", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"comQueue", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"ReceiveTask", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    // Started with -b only, missing otherwise
+    {"DownlinkFlush", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"tlmSend", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"eventLogger", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"prmDb", Components::TaskSchedule::OTHER, 0, SCHEDULE_CPUS_IO},
+    {"fileDownlink", Components::TaskSchedule::OTHER, 5, SCHEDULE_CPUS_IO},
+    {"LedEdgeLog", Components::TaskSchedule::OTHER, 5, SCHEDULE_CPUS_IO},
+    {"fileUplink", Components::TaskSchedule::OTHER, 5, SCHEDULE_CPUS_IO},
+    {"fileManager", Components::TaskSchedule::OTHER, 5, SCHEDULE_CPUS_IO},
+    {"TextLogger", Components::TaskSchedule::OTHER, 10, SCHEDULE_CPUS_IO},
+};
+
+// GPIO chip lines driven by the LED bank. Bit N of the bank masks drives ledBankLines[N].
+const U32 ledBankLines[] = {17, 18, 22, 23, 24, 25, 26, 27};
+
 // Ping entries are autocoded, however; this code is not properly exported. Thus, it is copied here.
 Svc::Health::PingEntry pingEntries[] = {
     {PingEntries::LedBlinker_blockDrv::WARN, PingEntries::LedBlinker_blockDrv::FATAL, "blockDrv"},
@@ -83,6 +152,9 @@ Svc::Health::PingEntry pingEntries[] = {
  * desired, but is extracted here for clarity.
  */
 void configureTopology() {
+    // The telemetry store holds the channels of the dictionary, so it is configured before anything writes telemetry
+    tlmSend.configure(TLM_CHANNELS, TLM_CHANNEL_COUNT);
+
     // Buffer managers need a configured set of buckets and an allocator used to allocate memory for those buckets.
     Svc::BufferManager::BufferBins upBuffMgrBins;
     memset(&upBuffMgrBins, 0, sizeof(upBuffMgrBins));
@@ -92,18 +164,25 @@ void configureTopology() {
     upBuffMgrBins.bins[1].numBuffers = DEFRAMER_BUFFER_COUNT;
     upBuffMgrBins.bins[2].bufferSize = COM_DRIVER_BUFFER_SIZE;
     upBuffMgrBins.bins[2].numBuffers = COM_DRIVER_BUFFER_COUNT;
-    bufferManager.setup(BUFFER_MANAGER_ID, 0, mallocator, upBuffMgrBins);
+    bufferManager.setup(BUFFER_MANAGER_ID, MEMORY_ID_BUFFER_MANAGER, arena, upBuffMgrBins);
 
-    // Framer and Deframer components need to be passed a protocol handler
-    framer.setup(framing);
+    // The framer hands the payloads to comDriver in place, the deframer needs to be passed a protocol handler
+    framer.setScatterGather(true);
     deframer.setup(deframing);
 
-    // Command sequencer needs to allocate memory to hold contents of command sequences
-    cmdSeq.allocateBuffer(0, mallocator, CMD_SEQ_BUFFER_SIZE);
+    // Command sequencer reads the sequences in place, so it needs no sequence buffer
+    cmdSeq.setSequenceFormat(cmdSeqFormat);
 
     // Rate group driver needs a divisor list
     rateGroupDriver.configure(rateGroupDivisorsSet);
 
+    // The fast-forward cycle waits for each rate group on the cycles its divider runs it, and for the led tick
+    for (FwIndexType group = 0; group < SIM_BARRIER_LED; group++) {
+        simTime.configureBarrier(group, static_cast<U32>(rateGroupDivisorsSet.dividers[group].divisor),
+                                 static_cast<U32>(rateGroupDivisorsSet.dividers[group].offset));
+    }
+    simTime.configureBarrier(SIM_BARRIER_LED, 1, 0);
+
     // Rate groups require context arrays.
     rateGroup1.configure(rateGroup1Context, FW_NUM_ARRAY_ELEMENTS(rateGroup1Context));
     rateGroup2.configure(rateGroup2Context, FW_NUM_ARRAY_ELEMENTS(rateGroup2Context));
@@ -113,9 +192,9 @@ void configureTopology() {
     fileDownlink.configure(FILE_DOWNLINK_TIMEOUT, FILE_DOWNLINK_COOLDOWN, FILE_DOWNLINK_CYCLE_TIME,
                            FILE_DOWNLINK_FILE_QUEUE_DEPTH);
 
-    // Parameter database is configured with a database file name, and that file must be initially read.
-    prmDb.configure("PrmDb.dat");
-    prmDb.readParamFile();
+    // Parameter database is configured with its log file and the Svc.PrmDb file imported when there is no log yet.
+    // The files are read by setupTopology before the tasks start.
+    prmDb.configure("PrmDb.log", "PrmDb.dat");
 
     // Health is supplied a set of ping entires.
     health.setPingEntries(pingEntries, FW_NUM_ARRAY_ELEMENTS(pingEntries), HEALTH_WATCHDOG_CODE);
@@ -128,81 +207,273 @@ void configureTopology() {
     configurationTable.entries[1] = {.depth = 500, .priority = 2};
     // File Downlink
     configurationTable.entries[2] = {.depth = 100, .priority = 1};
-    // Allocation identifier is 0 as the MallocAllocator discards it
-    comQueue.configure(configurationTable, 0, mallocator);
+    comQueue.configure(configurationTable, MEMORY_ID_COM_QUEUE, arena);
+
+    ledBank.configure(static_cast<U8>(FW_NUM_ARRAY_ELEMENTS(ledBankLines)));
+}
+
+/**
+ * \brief open the GPIO devices and the downlink listening socket
+ *
+ * The blocking device and socket I/O of the bring-up. It only touches the GPIO drivers and comDriver's listening
+ * socket, which nothing uses before the tasks are started, so the parallel bring-up runs it on its own thread while
+ * the commands and parameters are loaded. A client connecting meanwhile waits in the backlog until comDriver starts.
+ */
+void openDevices(const LedBlinker::TopologyState& state) {
+    const U32 phase = bootProfiler.begin("openDevices");
+    // Initialize socket communication if and only if there is a valid specification
+    if (state.hostname != nullptr && state.port != 0) {
+        comDriver.configure(state.hostname, state.port);
+        (void)comDriver.listen();
+    }
 
     Os::File::Status status =
         gpioDriver.open("/dev/gpiochip0", 13, Drv::LinuxGpioDriver::GpioConfiguration::GPIO_OUTPUT);
     if (status != Os::File::Status::OP_OK) {
         Fw::Logger::log("[ERROR] Failed to open GPIO pin\n");
     }
+
+    // The LED bank holds all of its lines in a single line request so each tick is one write
+    status =
+        gpioBankDriver.open("/dev/gpiochip0", ledBankLines, static_cast<U32>(FW_NUM_ARRAY_ELEMENTS(ledBankLines)));
+    if (status != Os::File::Status::OP_OK) {
+        Fw::Logger::log("[ERROR] Failed to open GPIO bank lines\n");
+    }
+    bootProfiler.end(phase);
+}
+
+//! Entry point of the task opening the devices during the parallel bring-up
+void openDevicesTask(void* state) {
+    FW_ASSERT(state != nullptr);
+    openDevices(*static_cast<const LedBlinker::TopologyState*>(state));
 }
 
 // Public functions for use in main program are namespaced with deployment name LedBlinker
 namespace LedBlinker {
 void setupTopology(const TopologyState& state) {
+    // Fast-forward runs are stamped from a fixed virtual epoch, the bring-up included, so they are reproducible
+    if (state.virtualTime) {
+        simTime.startVirtual(Fw::Time(TB_WORKSTATION_TIME, 0, 0, 0));
+    }
+    bootProfiler.start();
+    U32 phase = bootProfiler.begin("setupTopology");
+    // Both must precede the first thread: threads are named as they are started, and painted as they are created
+    Os::Task::registerTaskRegistry(&taskNamer);
+    if (state.stackPaint) {
+        Components::StackPaint::enable();
+    }
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("initComponents");
     // Autocoded initialization. Function provided by autocoder.
     initComponents(state);
     // Autocoded id setup. Function provided by autocoder.
     setBaseIds();
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("connectComponents");
     // Autocoded connection wiring. Function provided by autocoder.
     connectComponents();
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("configComponents");
     // Autocoded configuration. Function provided by autocoder.
     configComponents(state);
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("arenaSetup");
+    // The allocations of the component configuration are carved from the arena, which fails fast when over budget
+    const bool arenaReady = arena.setup(MEMORY_ARENA_SIZE, state.hugePages);
+    FW_ASSERT(arenaReady);
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("configureTopology");
     // Deployment-specific component configuration. Function provided above. May be inlined, if desired.
     configureTopology();
+    // The downlink frames are coalesced into batched socket writes when requested
+    if (state.batchDownlink) {
+        comDriver.configureBatching(arena, MEMORY_ID_COM_DRIVER, COM_DRIVER_BATCH_BYTES, COM_DRIVER_BATCH_WINDOW_US);
+    }
+    arena.report();
+    // Publish the LED GPIO writes for external test processes when requested
+    if (state.simGpio != nullptr) {
+        (void)simGpio.open(state.simGpio, SIM_GPIO_RECORDS);
+    }
+    bootProfiler.end(phase);
+    // The parallel bring-up opens the GPIO devices and the listening socket while the commands are registered and the
+    // parameters loaded, and waits for them before starting the tasks: the threads themselves are started afterwards,
+    // as a running task could otherwise take a command during the parameter replay
+    if (state.parallelBoot) {
+        Os::Task::Arguments arguments(Os::TaskString("BootIo"), openDevicesTask,
+                                      const_cast<LedBlinker::TopologyState*>(&state), Os::Task::TASK_DEFAULT,
+                                      Default::STACK_SIZE);
+        const Os::Task::Status status = bootIoTask.start(arguments);
+        FW_ASSERT(status == Os::Task::OP_OK, static_cast<FwAssertArgType>(status));
+    } else {
+        openDevices(state);
+    }
+    phase = bootProfiler.begin("regCommands");
     // Autocoded command registration. Function provided by autocoder.
     regCommands();
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("loadParameters");
+    // The parameter log must be initially replayed. Both run before the tasks start, so no parameter command races
+    // the replay and every component starts with the loaded parameters.
+    prmDb.readParamFile();
     // Autocoded parameter loading. Function provided by autocoder.
     loadParameters();
+    bootProfiler.end(phase);
+    if (state.parallelBoot) {
+        phase = bootProfiler.begin("joinBootIo");
+        (void)bootIoTask.join();
+        bootProfiler.end(phase);
+    }
+    phase = bootProfiler.begin("startTasks");
+    // The text events logged so far wait in the text logger ring until its thread starts
+    textLogger.start(Os::TaskString("TextLogger"), TEXT_LOGGER_PRIORITY, Default::STACK_SIZE);
     // Autocoded task kick-off (active components). Function provided by autocoder.
     startTasks(state);
-    // Initialize socket communication if and only if there is a valid specification
+    bootProfiler.end(phase);
+    // The socket is listening since openDevices when there is a valid specification
     if (state.hostname != nullptr && state.port != 0) {
+        phase = bootProfiler.begin("comDriverStart");
         Os::TaskString name("ReceiveTask");
         // Uplink is configured for receive so a socket task is started
-        comDriver.configure(state.hostname, state.port);
         comDriver.start(name, true, COMM_PRIORITY, Default::STACK_SIZE);
+        bootProfiler.end(phase);
     }
+    phase = bootProfiler.begin("startEdgeLog");
+    led.startEdgeLog(Os::TaskString("LedEdgeLog"), LED_EDGE_LOG_PRIORITY, Default::STACK_SIZE);
+    bootProfiler.end(phase);
+    phase = bootProfiler.begin("startPwm");
+    // The LED PWM carrier is timed by its own thread, the highest priority one of the deployment. It drives the GPIO
+    // pin with the loaded parameters, so it starts last.
+    led.startPwm(Os::TaskString("LedPwm"), LED_PWM_PRIORITY, Default::STACK_SIZE);
+    bootProfiler.end(phase);
+    // Every thread is running and named by now, the calling one included, which goes on to run the cycle driver
+    if (state.realTime) {
+        phase = bootProfiler.begin("applySchedule");
+        const Components::TaskSchedule::Result result =
+            Components::TaskSchedule::apply(scheduleTable, FW_NUM_ARRAY_ELEMENTS(scheduleTable));
+        Fw::Logger::log("[INFO] Scheduled %u threads, %u kept their policy, %u their CPUs, %u not running\n",
+                        result.applied, result.denied, result.unpinned, result.missing);
+        bootProfiler.end(phase);
+    }
+    (void)bootProfiler.report(state.parallelBoot);
+}
+
+// Variables used for cycle simulation. The flag is cleared from a signal handler and must therefore be lock-free.
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "Cycle flag must be lock-free to be async-signal-safe");
+std::atomic<bool> cycleFlag(true);
+
+namespace {
+const U64 NANOSECONDS_PER_SECOND = 1000000000ULL;
+
+//! Convert a monotonic timespec to nanoseconds
+U64 toNanoseconds(const struct timespec& time) {
+    return static_cast<U64>(time.tv_sec) * NANOSECONDS_PER_SECOND + static_cast<U64>(time.tv_nsec);
+}
+
+//! Convert nanoseconds to a monotonic timespec
+struct timespec toTimespec(U64 nanoseconds) {
+    struct timespec time;
+    time.tv_sec = static_cast<time_t>(nanoseconds / NANOSECONDS_PER_SECOND);
+    time.tv_nsec = static_cast<long>(nanoseconds % NANOSECONDS_PER_SECOND);
+    return time;
 }
+}  // namespace
 
-// Variables used for cycle simulation
-Os::Mutex cycleLock;
-volatile bool cycleFlag = true;
+void startSimulatedCycle(U64 period) {
+    FW_ASSERT(period > 0);
+    U64 cycles = 0;
+    U64 missedDeadlines = 0;
+    // Wake-up lateness: how long after its deadline the loop ran again, the jitter of the cycles
+    U64 latenessSum = 0;
+    U64 latenessMax = 0;
+    U64 wakeups = 0;
 
-void startSimulatedCycle(Fw::TimeInterval interval) {
-    cycleLock.lock();
-    bool cycling = cycleFlag;
-    cycleLock.unLock();
+    // Deadlines are absolute multiples of the period from the first cycle, so the time spent in the ISR call and any
+    // scheduling latency do not accumulate into the period.
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    U64 deadline = toNanoseconds(now);
 
     // Main loop
-    while (cycling) {
+    while (cycleFlag.load()) {
         LedBlinker::blockDrv.callIsr();
-        Os::Task::delay(interval);
+        cycles++;
+
+        deadline += period;
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        const U64 current = toNanoseconds(now);
+        if (current >= deadline) {
+            // Overran one or more cycles: count them and resume on the next deadline still in the future instead of
+            // bursting to catch up
+            const U64 missed = (current - deadline) / period + 1;
+            missedDeadlines += missed;
+            deadline += missed * period;
+            simTime.reportMissedDeadlines(missed);
+        }
+
+        // A shutdown signal interrupts the sleep (EINTR) so the flag is checked right away
+        const struct timespec wake = toTimespec(deadline);
+        while ((clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr) == EINTR) && cycleFlag.load()) {
+        }
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        const U64 woken = toNanoseconds(now);
+        if (cycleFlag.load() && (woken >= deadline)) {
+            latenessSum += woken - deadline;
+            latenessMax = FW_MAX(latenessMax, woken - deadline);
+            wakeups++;
+        }
+    }
+    Fw::Logger::log("[INFO] Cycle driver ran %llu cycles with %llu missed deadlines\n",
+                    static_cast<unsigned long long>(cycles), static_cast<unsigned long long>(missedDeadlines));
+    Fw::Logger::log("[INFO] Cycle wake-up lateness: mean %llu us, max %llu us\n",
+                    static_cast<unsigned long long>((wakeups > 0) ? latenessSum / wakeups / 1000 : 0),
+                    static_cast<unsigned long long>(latenessMax / 1000));
+}
+
+void startFastForwardCycle(U64 period, U64 cycles) {
+    FW_ASSERT(simTime.isVirtual());
+    struct timespec start;
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
 
-        cycleLock.lock();
-        cycling = cycleFlag;
-        cycleLock.unLock();
+    // Each cycle starts as soon as the previous one is done, with the virtual time one interval later
+    while (cycleFlag.load() && ((cycles == 0) || (simTime.getCycles() < cycles))) {
+        simTime.beginCycle(period);
+        LedBlinker::blockDrv.callIsr();
+        (void)simTime.waitCycle(SIM_CYCLE_STALL_US);
     }
+
+    struct timespec end;
+    (void)clock_gettime(CLOCK_MONOTONIC, &end);
+    Fw::Logger::log("[INFO] Fast-forward ran %llu cycles, %llu s of virtual time in %llu ms, with %u stalled cycles\n",
+                    static_cast<unsigned long long>(simTime.getCycles()),
+                    static_cast<unsigned long long>(simTime.getCycles() * period / NANOSECONDS_PER_SECOND),
+                    static_cast<unsigned long long>((toNanoseconds(end) - toNanoseconds(start)) / 1000000),
+                    simTime.getStalls());
 }
 
 void stopSimulatedCycle() {
-    cycleLock.lock();
-    cycleFlag = false;
-    cycleLock.unLock();
+    cycleFlag.store(false);
 }
 
 void teardownTopology(const TopologyState& state) {
+    // The stacks are measured while their threads still run
+    if (state.stackPaint) {
+        (void)taskMonitor.writeReport("StackReport.txt");
+    }
     // Autocoded (active component) task clean-up. Functions provided by topology autocoder.
     stopTasks(state);
     freeThreads(state);
 
     // Other task clean-up.
+    led.stopPwm();
+    led.stopEdgeLog();
+    simGpio.close();
     comDriver.stop();
     (void)comDriver.join();
+    // Stopped last, so the events of the shutdown are written too
+    textLogger.stop();
 
     // Resource deallocation
-    cmdSeq.deallocateBuffer(mallocator);
+    comDriver.deallocateBatching(arena);
     bufferManager.cleanup();
 }
 };  // namespace LedBlinker
@@ -60,25 +60,50 @@ void setupTopology(const TopologyState& state);
 void teardownTopology(const TopologyState& state);
 
 /**
- * \brief cycle the rate group driver at a crude rate
+ * \brief cycle the rate group driver at a fixed rate
  *
  * The reference topology does not have a true 1Hz input clock for the rate group driver because it is designed to
  * operate across various computing endpoints (e.g. laptops) where a clear 1Hz source may not be easily and generically
- * achieved. This function mimics the cycling via a Task::delay(milliseconds) loop that manually invokes the ISR call
- * to the example block driver.
+ * achieved. This function mimics the cycling via a loop that manually invokes the ISR call to the example block driver
+ * and then sleeps until an absolute deadline on the monotonic clock (clock_nanosleep with TIMER_ABSTIME). Deadlines
+ * are multiples of the interval from the first cycle so the cost of the ISR call does not drift the period. Cycles
+ * whose deadline has already passed are counted as missed and skipped. They are reported while running through the
+ * simTime CycleMissedDeadlines channel and CycleDeadlinesMissed event. The count is logged again when the loop stops,
+ * with the mean and maximum lateness of the wake-ups past their deadlines, the jitter of the cycles.
  *
- * This loop is stopped via a startSimulatedCycle call.
+ * This loop is stopped via a stopSimulatedCycle call.
  *
  * Note: projects should replace this with a component that produces an output port call at the appropriate frequency.
  *
- * \param milliseconds: milliseconds to delay for each cycle. Default: 1000 or 1Hz.
+ * \param period: period of each cycle in nanoseconds. Default: 1 second or 1Hz.
  */
-void startSimulatedCycle(Fw::TimeInterval interval = Fw::TimeInterval(1,0));
+void startSimulatedCycle(U64 period = 1000000000);
+
+/**
+ * \brief cycle the rate group driver in virtual time, as fast as the cycles complete
+ *
+ * Fast-forward simulation for long runs. Requires a topology set up with TopologyState::virtualTime, so that simTime
+ * serves a virtual time from the bring-up on. Each cycle sets the virtual time one interval after the previous cycle,
+ * invokes the ISR call of the block driver, then waits on the simTime barrier until every rate group run by that cycle
+ * and the led tick are done before starting the next cycle. Events and telemetry of those are therefore stamped with
+ * the same virtual times on every run. The active components the rate groups and the commands reach through their
+ * queues (cmdSeq, fileDownlink, ledBank, health, and led commands from cmdDisp) are not part of the barrier, so their
+ * work may spill into the next cycles. A cycle whose barrier is not complete within a second of real time is counted
+ * as stalled and the loop moves on.
+ *
+ * This loop is stopped via a stopSimulatedCycle call or once the requested number of cycles ran.
+ *
+ * \param period: virtual period of each cycle in nanoseconds
+ * \param cycles: number of cycles to run, 0 to run until stopped
+ */
+void startFastForwardCycle(U64 period, U64 cycles);
 
 /**
  * \brief stop the simulated cycle started by startSimulatedCycle
  *
- * This stops the cycle started by startSimulatedCycle.
+ * This stops the cycle started by startSimulatedCycle or startFastForwardCycle. It only stores to a lock-free flag and
+ * is therefore safe to call from a signal handler. A sleeping cycle loop wakes immediately when the signal is
+ * delivered to its thread.
  */
 void stopSimulatedCycle();
 
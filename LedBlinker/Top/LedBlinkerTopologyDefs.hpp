@@ -25,8 +25,25 @@ namespace LedBlinker {
 struct TopologyState {
     const CHAR* hostname;
     U16 port;
+    const CHAR* simGpio;  //!< Shared memory name the LED GPIO writes are published to, nullptr for none
+    bool stackPaint;      //!< Paint the thread stacks to report their high-water marks
+    bool hugePages;       //!< Back the memory arena with huge pages
+    bool batchDownlink;   //!< Coalesce the downlink frames into batched socket writes
+    bool parallelBoot;    //!< Open the devices and the listening socket while the parameters are loaded
+    bool virtualTime;     //!< Serve a virtual time advanced by the fast-forward cycle
+    bool realTime;        //!< Pin the threads to CPUs and run the timing-critical ones SCHED_FIFO
 };
 
+/**
+ * \brief telemetry channel table
+ *
+ * The IDs of the telemetry channels of the topology in increasing order, which give the telemetry store one slot each.
+ * The definitions are generated from the topology dictionary at build time by
+ * `Components/TlmStore/tools/tlm_channel_table.py`.
+ */
+extern const FwChanIdType TLM_CHANNELS[];
+extern const U32 TLM_CHANNEL_COUNT;
+
 /**
  * \brief required ping constants
  *